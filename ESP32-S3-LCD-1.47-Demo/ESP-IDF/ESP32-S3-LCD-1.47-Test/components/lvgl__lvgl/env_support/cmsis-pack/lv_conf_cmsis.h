@@ -59,9 +59,9 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
-/*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
- *You will see an error log message if there wasn't enough buffers. */
-#define LV_MEM_BUF_MAX_NUM 16
+/*Size of the memory chunks from which the intermediate buffers used during rendering and other internal
+ *processing mechanisms are allocated. A buffer larger than this gets a chunk of its own.*/
+#define LV_MEM_BUF_CHUNK_SIZE 4096
 
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
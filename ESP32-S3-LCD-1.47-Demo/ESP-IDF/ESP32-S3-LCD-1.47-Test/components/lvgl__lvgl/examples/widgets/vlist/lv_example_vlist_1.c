@@ -0,0 +1,23 @@
+#include "../../lv_examples.h"
+#if LV_USE_VLIST && LV_BUILD_EXAMPLES
+
+static void row_update_cb(lv_obj_t * vlist, lv_obj_t * row, uint32_t id)
+{
+    LV_UNUSED(vlist);
+    lv_label_set_text_fmt(row, "Item %"LV_PRIu32, id);
+}
+
+/**
+ * A list of 100000 items which uses only a few label objects
+ */
+void lv_example_vlist_1(void)
+{
+    lv_obj_t * vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 180, 220);
+    lv_obj_center(vlist);
+    lv_vlist_set_row_cb(vlist, NULL, row_update_cb);
+    lv_vlist_set_row_height(vlist, 30);
+    lv_vlist_set_row_cnt(vlist, 100000);
+}
+
+#endif
@@ -66,9 +66,9 @@
     #define LV_MEM_CUSTOM_REALLOC realloc
 #endif     /*LV_MEM_CUSTOM*/
 
-/*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
- *You will see an error log message if there wasn't enough buffers. */
-#define LV_MEM_BUF_MAX_NUM 16
+/*Size of the memory chunks from which the intermediate buffers used during rendering and other internal
+ *processing mechanisms are allocated. A buffer larger than this gets a chunk of its own.*/
+#define LV_MEM_BUF_CHUNK_SIZE 4096
 
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #define LV_MEMCPY_MEMSET_STD 0
@@ -83,6 +83,10 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*1: Refresh the display right after an input device changed something on it
+ *instead of waiting for the display's refresh period. Can be changed in `lv_indev_drv_t`.*/
+#define LV_INDEV_DEF_REFR_ON_INPUT 0
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -172,6 +176,23 @@
  *Only used if software rotation is enabled in the display driver.*/
 #define LV_DISP_ROT_MAX_BUF (10*1024)
 
+/*Split big fills and image blends into horizontal bands and blend them on several threads.
+ *The thread calling `lv_timer_handler()` blends a band too.*/
+#define LV_USE_DRAW_SW_PARALLEL 0
+#if LV_USE_DRAW_SW_PARALLEL
+    /*LV_OS_PTHREAD or LV_OS_FREERTOS*/
+    #define LV_DRAW_SW_PARALLEL_OS LV_OS_PTHREAD
+
+    /*Number of worker threads*/
+    #define LV_DRAW_SW_PARALLEL_WORKER_CNT 1
+
+    /*Blends smaller than this many pixels are not split*/
+    #define LV_DRAW_SW_PARALLEL_MIN_PX 8192
+
+    /*Stack size of a worker thread in bytes*/
+    #define LV_DRAW_SW_PARALLEL_STACK_SIZE 2048
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -306,6 +327,14 @@
 
 #define LV_USE_USER_DATA 1
 
+/*Number of entries in the cache of resolved style properties (power of 2). 0 to disable caching.
+ *An entry is about 20 bytes. Any style change invalidates the whole cache.*/
+#define LV_OBJ_STYLE_CACHE_SIZE 0
+
+/*Allocate the objects of the same size from chunks of this many bytes. 0 to allocate every object from the heap.
+ *Reduces heap fragmentation when screens are created and deleted, but a partially used chunk can't be used for other things.*/
+#define LV_OBJ_SLAB_CHUNK_SIZE 0
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -566,6 +595,8 @@
 
 #define LV_USE_TILEVIEW   1
 
+#define LV_USE_VLIST      1
+
 #define LV_USE_WIN        1
 
 /*-----------
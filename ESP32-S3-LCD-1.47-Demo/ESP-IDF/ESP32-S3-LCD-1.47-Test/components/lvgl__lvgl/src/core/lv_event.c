@@ -14,6 +14,9 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+/*The bit of `event_mask` the codes from here share*/
+#define EVENT_MASK_OTHER_BIT    63
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -23,11 +26,17 @@ typedef struct _lv_event_dsc_t {
     lv_event_code_t filter : 8;
 } lv_event_dsc_t;
 
+/*The built-in codes need to have their own bit*/
+typedef char event_mask_check_t[_LV_EVENT_LAST <= EVENT_MASK_OTHER_BIT ? 1 : -1];
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id);
 static lv_res_t event_send_core(lv_event_t * e);
+static void update_event_mask(lv_obj_t * obj);
+static inline uint64_t event_code_bit(uint32_t code);
+static inline bool has_event_cb(const lv_obj_t * obj, uint64_t code_bit);
 static bool event_is_bubbled(lv_event_t * e);
 
 
@@ -158,6 +167,17 @@ void _lv_event_mark_deleted(lv_obj_t * obj)
     }
 }
 
+bool _lv_event_has_draw_cb(const lv_obj_t * obj)
+{
+    uint32_t mask = 0;
+    uint32_t code;
+    for(code = LV_EVENT_DRAW_MAIN_BEGIN; code <= LV_EVENT_DRAW_PART_END; code++) {
+        mask |= (uint32_t)1 << (code & 0x1F);
+    }
+
+    return has_event_cb(obj, mask);
+}
+
 
 struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb, lv_event_code_t filter,
                                              void * user_data)
@@ -173,6 +193,7 @@ struct _lv_event_dsc_t * lv_obj_add_event_cb(lv_obj_t * obj, lv_event_cb_t event
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].cb = event_cb;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].filter = filter;
     obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1].user_data = user_data;
+    update_event_mask(obj);
 
     return &obj->spec_attr->event_dsc[obj->spec_attr->event_dsc_cnt - 1];
 }
@@ -193,6 +214,7 @@ bool lv_obj_remove_event_cb(lv_obj_t * obj, lv_event_cb_t event_cb)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -218,6 +240,7 @@ bool lv_obj_remove_event_cb_with_user_data(lv_obj_t * obj, lv_event_cb_t event_c
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -243,6 +266,7 @@ bool lv_obj_remove_event_dsc(lv_obj_t * obj, struct _lv_event_dsc_t * event_dsc)
             obj->spec_attr->event_dsc = lv_mem_realloc(obj->spec_attr->event_dsc,
                                                        obj->spec_attr->event_dsc_cnt * sizeof(lv_event_dsc_t));
             LV_ASSERT_MALLOC(obj->spec_attr->event_dsc);
+            update_event_mask(obj);
             return true;
         }
     }
@@ -423,6 +447,38 @@ static lv_event_dsc_t * lv_obj_get_event_dsc(const lv_obj_t * obj, uint32_t id)
     return &obj->spec_attr->event_dsc[id];
 }
 
+/**
+ * Collect the event codes the callbacks of an object are interested in.
+ * `LV_EVENT_ALL` enables all the bits.
+ * @param obj   pointer to an object
+ */
+static void update_event_mask(lv_obj_t * obj)
+{
+    uint64_t mask = 0;
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t code = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(code == LV_EVENT_ALL) {
+            mask = UINT64_MAX;
+            break;
+        }
+        mask |= event_code_bit(code);
+    }
+
+    obj->spec_attr->event_mask = mask;
+}
+
+/*Each built-in code has its own bit. The custom codes from `EVENT_MASK_OTHER_BIT` share the last one.*/
+static inline uint64_t event_code_bit(uint32_t code)
+{
+    return (uint64_t)1 << LV_MIN(code, EVENT_MASK_OTHER_BIT);
+}
+
+static inline bool has_event_cb(const lv_obj_t * obj, uint64_t code_bit)
+{
+    return obj->spec_attr && (obj->spec_attr->event_mask & code_bit);
+}
+
 static lv_res_t event_send_core(lv_event_t * e)
 {
     EVENT_TRACE("Sending event %d to %p with %p param", e->code, (void *)e->current_target, e->param);
@@ -436,7 +492,11 @@ static lv_res_t event_send_core(lv_event_t * e)
     }
 
     lv_res_t res = LV_RES_OK;
-    lv_event_dsc_t * event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+
+    /*Skip the event callbacks if none of them filters for this code*/
+    uint64_t code_bit = event_code_bit(e->code);
+    lv_event_dsc_t * event_dsc = NULL;
+    if(has_event_cb(e->current_target, code_bit)) event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
 
     uint32_t i = 0;
     while(event_dsc && res == LV_RES_OK) {
@@ -457,7 +517,11 @@ static lv_res_t event_send_core(lv_event_t * e)
 
     res = lv_obj_event_base(NULL, e);
 
-    event_dsc = res == LV_RES_INV ? NULL : lv_obj_get_event_dsc(e->current_target, 0);
+    /*The class's event handler might have added callbacks so check the mask again*/
+    event_dsc = NULL;
+    if(res != LV_RES_INV && has_event_cb(e->current_target, code_bit)) {
+        event_dsc = lv_obj_get_event_dsc(e->current_target, 0);
+    }
 
     i = 0;
     while(event_dsc && res == LV_RES_OK) {
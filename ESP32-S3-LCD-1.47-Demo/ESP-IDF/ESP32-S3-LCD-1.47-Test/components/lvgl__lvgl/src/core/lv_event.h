@@ -223,6 +223,13 @@ uint32_t lv_event_register_id(void);
  */
 void _lv_event_mark_deleted(struct _lv_obj_t * obj);
 
+/**
+ * Tell if the user added an event callback which might draw on an object.
+ * @param obj   pointer to an object
+ * @return      true: there might be a callback for one of the `LV_EVENT_DRAW_...` events
+ */
+bool _lv_event_has_draw_cb(const struct _lv_obj_t * obj);
+
 
 /**
  * Add an event handler function for an object.
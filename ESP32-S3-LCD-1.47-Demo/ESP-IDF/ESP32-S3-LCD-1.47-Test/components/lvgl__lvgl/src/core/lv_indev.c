@@ -41,6 +41,8 @@ static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(_lv_indev_proc_t * proc);
 static void indev_gesture(_lv_indev_proc_t * proc);
 static bool indev_reset_check(_lv_indev_proc_t * proc);
+static bool indev_data_changed(const lv_indev_t * indev, const lv_indev_data_t * data);
+static void indev_refr_on_input(lv_indev_t * indev);
 
 /**********************
  *  STATIC VARIABLES
@@ -78,8 +80,10 @@ void lv_indev_read_timer_cb(lv_timer_t * timer)
     if(indev_act->proc.disabled ||
        indev_act->driver->disp->prev_scr != NULL) return; /*Input disabled or screen animation active*/
     bool continue_reading;
+    bool changed = false;
     do {
         /*Read the data*/
+        uint32_t read_time = lv_tick_get();
         _lv_indev_read(indev_act, &data);
         continue_reading = data.continue_reading;
 
@@ -87,6 +91,12 @@ void lv_indev_read_timer_cb(lv_timer_t * timer)
         indev_proc_reset_query_handler(indev_act);
         indev_obj_act = NULL;
 
+        /*Measure the latency from the first change which is not shown yet*/
+        if(indev_data_changed(indev_act, &data)) {
+            if(!changed && !indev_act->proc.latency_pending) indev_act->proc.input_timestamp = read_time;
+            changed = true;
+        }
+
         indev_act->proc.state = data.state;
 
         /*Save the last activity time*/
@@ -113,6 +123,8 @@ void lv_indev_read_timer_cb(lv_timer_t * timer)
         indev_proc_reset_query_handler(indev_act);
     } while(continue_reading);
 
+    if(changed) indev_refr_on_input(indev_act);
+
     /*End of indev processing, so no act indev*/
     indev_act     = NULL;
     indev_obj_act = NULL;
@@ -1178,3 +1190,50 @@ static bool indev_reset_check(_lv_indev_proc_t * proc)
 
     return proc->reset_query ? true : false;
 }
+
+/**
+ * Check whether the read data differs from the previously read one
+ * @param indev pointer to an input device
+ * @param data the new data, not processed yet
+ * @return true: the state, the point, the key or the encoder position has changed
+ */
+static bool indev_data_changed(const lv_indev_t * indev, const lv_indev_data_t * data)
+{
+    if(data->state != indev->proc.state) return true;
+
+    switch(indev->driver->type) {
+        case LV_INDEV_TYPE_POINTER:
+            return data->point.x != indev->proc.types.pointer.last_raw_point.x ||
+                   data->point.y != indev->proc.types.pointer.last_raw_point.y;
+        case LV_INDEV_TYPE_KEYPAD:
+            return data->key != indev->proc.types.keypad.last_key;
+        case LV_INDEV_TYPE_ENCODER:
+            return data->enc_diff != 0 || data->key != indev->proc.types.keypad.last_key;
+        case LV_INDEV_TYPE_BUTTON:
+            if(indev->btn_points == NULL) return false;
+            return indev->btn_points[data->btn_id].x != indev->proc.types.pointer.act_point.x ||
+                   indev->btn_points[data->btn_id].y != indev->proc.types.pointer.act_point.y;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Called after the input device read some changes.
+ * If they invalidated something, start measuring the latency and refresh the display
+ * if `refr_on_input` is enabled.
+ * @param indev pointer to an input device
+ */
+static void indev_refr_on_input(lv_indev_t * indev)
+{
+    lv_disp_t * disp = indev->driver->disp;
+
+    /*Nothing to show*/
+    if(disp->inv_p == 0) return;
+
+    if(indev->driver->latency_cb) indev->proc.latency_pending = 1;
+
+    /*Only make the refresh timer ready instead of refreshing here. It runs later in the same
+     *`lv_timer_handler()` call, so all the buffered reads are drawn together.*/
+    if(indev->driver->refr_on_input && disp->refr_timer) lv_timer_ready(disp->refr_timer);
+}
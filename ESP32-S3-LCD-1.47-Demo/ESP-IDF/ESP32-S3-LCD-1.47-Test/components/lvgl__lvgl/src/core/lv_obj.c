@@ -49,6 +49,7 @@
 #define LV_OBJ_DEF_WIDTH    (LV_DPX(100))
 #define LV_OBJ_DEF_HEIGHT   (LV_DPX(50))
 #define STYLE_TRANSITION_MAX 32
+#define SPEC_ATTR_SLAB_CHUNK_CNT 16
 
 /**********************
  *      TYPEDEFS
@@ -65,6 +66,7 @@ static void draw_scrollbar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
+static bool state_diff_is_scrollbar_only(const lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
 /**********************
  *  STATIC VARIABLES
@@ -79,6 +81,7 @@ const lv_obj_class_t lv_obj_class = {
     .editable = LV_OBJ_CLASS_EDITABLE_FALSE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_FALSE,
     .instance_size = (sizeof(lv_obj_t)),
+    .scroll_copy = 1,
     .base_class = NULL,
 };
 
@@ -138,6 +141,7 @@ void lv_init(void)
 #endif
 
     _lv_obj_style_init();
+    lv_slab_init(&LV_GC_ROOT(_lv_obj_spec_attr_slab), sizeof(_lv_obj_spec_attr_t), SPEC_ATTR_SLAB_CHUNK_CNT);
     _lv_ll_init(&LV_GC_ROOT(_lv_disp_ll), sizeof(lv_disp_t));
     _lv_ll_init(&LV_GC_ROOT(_lv_indev_ll), sizeof(lv_indev_t));
 
@@ -360,9 +364,7 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
-        static uint32_t x = 0;
-        x++;
-        obj->spec_attr = lv_mem_alloc(sizeof(_lv_obj_spec_attr_t));
+        obj->spec_attr = lv_slab_alloc(&LV_GC_ROOT(_lv_obj_spec_attr_slab));
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -466,16 +468,16 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     if(group) lv_group_remove_obj(obj);
 
     if(obj->spec_attr) {
-        if(obj->spec_attr->children) {
+        if(obj->spec_attr->children && obj->spec_attr->children != &obj->spec_attr->child_single) {
             lv_mem_free(obj->spec_attr->children);
-            obj->spec_attr->children = NULL;
         }
+        obj->spec_attr->children = NULL;
         if(obj->spec_attr->event_dsc) {
             lv_mem_free(obj->spec_attr->event_dsc);
             obj->spec_attr->event_dsc = NULL;
         }
 
-        lv_mem_free(obj->spec_attr);
+        lv_slab_free(&LV_GC_ROOT(_lv_obj_spec_attr_slab), obj->spec_attr);
         obj->spec_attr = NULL;
     }
 }
@@ -943,7 +945,8 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     lv_mem_buf_release(ts);
 
     if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_REDRAW) {
-        lv_obj_invalidate(obj);
+        if(state_diff_is_scrollbar_only(obj, prev_state, new_state)) lv_obj_scrollbar_invalidate(obj);
+        else lv_obj_invalidate(obj);
     }
     else if(cmp_res == _LV_STYLE_STATE_CMP_DIFF_LAYOUT) {
         lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
@@ -954,6 +957,27 @@ static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state)
     }
 }
 
+/**
+ * Tell if only the styles of the scrollbar are different in two states, e.g. in `LV_STATE_SCROLLED`.
+ * @param obj       pointer to an object
+ * @param state1    a state
+ * @param state2    an other state
+ * @return          true: it's enough to redraw the scrollbars
+ */
+static bool state_diff_is_scrollbar_only(const lv_obj_t * obj, lv_state_t state1, lv_state_t state2)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        lv_state_t state_act = lv_obj_style_get_selector_state(obj->styles[i].selector);
+        bool valid1 = state_act & (~state1) ? false : true;
+        bool valid2 = state_act & (~state2) ? false : true;
+        if(valid1 == valid2) continue;
+        if(lv_obj_style_get_selector_part(obj->styles[i].selector) != LV_PART_SCROLLBAR) return false;
+    }
+
+    return true;
+}
+
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find)
 {
     /*Check all children of `parent`*/
@@ -154,10 +154,13 @@ extern const lv_obj_class_t lv_obj_class;
  */
 typedef struct {
     struct _lv_obj_t ** children;       /**< Store the pointer of the children in an array.*/
-    uint32_t child_cnt;                 /**< Number of children*/
+    struct _lv_obj_t * child_single;    /**< `children` points here if there is only one child*/
     lv_group_t * group_p;
 
     struct _lv_event_dsc_t * event_dsc; /**< Dynamically allocated event callback and user data array*/
+    uint64_t event_mask;                /**< Bit `code` is set if any callback in `event_dsc` filters for `code`.
+                                         *   The codes from 63 (custom codes only) share bit 63.*/
+    uint32_t child_cnt;                 /**< Number of children*/
     lv_point_t scroll;                  /**< The current X/Y scroll offset*/
 
     lv_coord_t ext_click_pad;           /**< Extra click padding in all direction*/
@@ -183,6 +186,7 @@ typedef struct _lv_obj_t {
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv : 1;
+    uint16_t child_layout_inv : 1;          /**< A descendant has `layout_inv` or `readjust_scroll_after_layout` set*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -190,6 +194,7 @@ typedef struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t being_deleted   : 1;
+    uint16_t from_slab  : 1;                /**< Allocated from `_lv_obj_slabs` instead of the heap*/
 } lv_obj_t;
 
 
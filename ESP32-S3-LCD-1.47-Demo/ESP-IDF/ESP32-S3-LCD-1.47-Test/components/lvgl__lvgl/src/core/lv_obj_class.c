@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_theme.h"
+#include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -27,10 +28,17 @@
  **********************/
 static void lv_obj_construct(lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+static lv_obj_t * obj_alloc(uint32_t size);
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    static lv_slab_t * get_slab(uint32_t size, bool create);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    static bool slab_enabled = true;
+#endif
 
 /**********************
  *      MACROS
@@ -44,9 +52,8 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
-    lv_obj_t * obj = lv_mem_alloc(s);
+    lv_obj_t * obj = obj_alloc(s);
     if(obj == NULL) return NULL;
-    lv_memset_00(obj, s);
     obj->class_p = class_p;
     obj->parent = parent;
 
@@ -56,7 +63,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_disp_t * disp = lv_disp_get_default();
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
-            lv_mem_free(obj);
+            _lv_obj_class_free_obj(obj, class_p);
             return NULL;
         }
 
@@ -81,21 +88,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
     else {
         LV_TRACE_OBJ_CREATE("creating normal object");
         LV_ASSERT_OBJ(parent, MY_CLASS);
-        if(parent->spec_attr == NULL) {
-            lv_obj_allocate_spec_attr(parent);
-        }
-
-        if(parent->spec_attr->children == NULL) {
-            parent->spec_attr->children = lv_mem_alloc(sizeof(lv_obj_t *));
-            parent->spec_attr->children[0] = obj;
-            parent->spec_attr->child_cnt = 1;
-        }
-        else {
-            parent->spec_attr->child_cnt++;
-            parent->spec_attr->children = lv_mem_realloc(parent->spec_attr->children,
-                                                         sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
-            parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
-        }
+        _lv_obj_add_child(parent, obj);
     }
 
     return obj;
@@ -168,6 +161,38 @@ bool lv_obj_is_group_def(lv_obj_t * obj)
     return class_p->group_def == LV_OBJ_CLASS_GROUP_DEF_TRUE ? true : false;
 }
 
+void _lv_obj_class_free_obj(lv_obj_t * obj, const lv_obj_class_t * class_p)
+{
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    if(obj->from_slab) {
+        lv_slab_free(get_slab(get_instance_size(class_p), false), obj);
+        return;
+    }
+#else
+    LV_UNUSED(class_p);
+#endif
+
+    lv_mem_free(obj);
+}
+
+void lv_obj_class_enable_slab(bool en)
+{
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    slab_enabled = en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+void lv_obj_class_trim_slabs(void)
+{
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    uint32_t i;
+    for(i = 0; i < _LV_OBJ_SLAB_CNT; i++) lv_slab_trim(&LV_GC_ROOT(_lv_obj_slabs)[i]);
+#endif
+    lv_slab_trim(&LV_GC_ROOT(_lv_obj_spec_attr_slab));
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -200,3 +225,53 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 
     return base->instance_size;
 }
+
+static lv_obj_t * obj_alloc(uint32_t size)
+{
+    lv_obj_t * obj = NULL;
+    bool from_slab = false;
+#if LV_OBJ_SLAB_CHUNK_SIZE
+    lv_slab_t * slab = slab_enabled ? get_slab(size, true) : NULL;
+    if(slab) {
+        obj = lv_slab_alloc(slab);
+        from_slab = true;
+    }
+    else
+#endif
+    {
+        obj = lv_mem_alloc(size);
+    }
+    if(obj == NULL) return NULL;
+
+    lv_memset_00(obj, size);
+    obj->from_slab = from_slab;
+    return obj;
+}
+
+#if LV_OBJ_SLAB_CHUNK_SIZE
+/**
+ * Get the slab of an instance size
+ * @param size      size of an instance
+ * @param create    true: take an unused slab if there is no slab for `size` yet
+ * @return          pointer to the slab or NULL if the objects of this size should be allocated from the heap
+ */
+static lv_slab_t * get_slab(uint32_t size, bool create)
+{
+    uint32_t block_size = LV_SLAB_BLOCK_SIZE(size);
+    uint32_t block_cnt = LV_OBJ_SLAB_CHUNK_SIZE / block_size;
+    if(block_cnt < 2) return NULL;  /*Large objects would waste too much in a partially used chunk*/
+
+    lv_slab_t * slabs = LV_GC_ROOT(_lv_obj_slabs);
+    uint32_t i;
+    for(i = 0; i < _LV_OBJ_SLAB_CNT; i++) {
+        if(slabs[i].block_size == block_size) return &slabs[i];
+        if(slabs[i].block_size == 0) {
+            if(!create) return NULL;
+            lv_slab_init(&slabs[i], size, LV_MIN(block_cnt, UINT16_MAX));
+            return &slabs[i];
+        }
+    }
+
+    return NULL;    /*All the slabs are used by other sizes*/
+}
+#endif
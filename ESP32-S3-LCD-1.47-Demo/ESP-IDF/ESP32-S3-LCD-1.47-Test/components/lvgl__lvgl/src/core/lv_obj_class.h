@@ -13,6 +13,8 @@ extern "C" {
 /*********************
  *      INCLUDES
  *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_slab.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -20,6 +22,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Number of different instance sizes which can have their own slab*/
+#define _LV_OBJ_SLAB_CNT    16
 
 /**********************
  *      TYPEDEFS
@@ -60,8 +64,12 @@ typedef struct _lv_obj_class_t {
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
     uint32_t instance_size : 16;
+    uint32_t scroll_copy : 1;          /**< 1: `event_cb` draws only what moves together with the scrolled content*/
 } lv_obj_class_t;
 
+/** Slabs of the objects by instance size. A slab is unused while its `block_size` is 0.*/
+typedef lv_slab_t _lv_obj_slab_arr_t[_LV_OBJ_SLAB_CNT];
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -78,6 +86,26 @@ void lv_obj_class_init_obj(struct _lv_obj_t * obj);
 
 void _lv_obj_destruct(struct _lv_obj_t * obj);
 
+/**
+ * Free the memory of an object created by `lv_obj_class_create_obj()`. Only for internal use.
+ * @param obj       pointer to an already destructed object
+ * @param class_p   the class the object was created with
+ */
+void _lv_obj_class_free_obj(struct _lv_obj_t * obj, const struct _lv_obj_class_t * class_p);
+
+/**
+ * Enable or disable allocating the new objects from slabs. The already created objects are not affected.
+ * Has effect only if `LV_OBJ_SLAB_CHUNK_SIZE > 0`. Mainly for testing and benchmarking.
+ * @param en        true: enable slabs; false: allocate every object from the heap
+ */
+void lv_obj_class_enable_slab(bool en);
+
+/**
+ * Give back the empty chunks kept by the slabs of the objects and their special attributes to the heap.
+ * Called at the end of each refresh and can be called before measuring the used memory.
+ */
+void lv_obj_class_trim_slabs(void);
+
 bool lv_obj_is_editable(struct _lv_obj_t * obj);
 
 bool lv_obj_is_group_def(struct _lv_obj_t * obj);
@@ -26,6 +26,7 @@
 static lv_coord_t calc_content_width(lv_obj_t * obj);
 static lv_coord_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_child_layout_as_dirty(lv_obj_t * obj);
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
@@ -201,6 +202,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_child_layout_as_dirty(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -288,6 +290,7 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_child_layout_as_dirty(obj);
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -1132,9 +1135,16 @@ static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+
+    /*Clean subtrees have nothing to update, don't walk them.
+     *Clear the flag first so that invalidations while updating the children mark the path again.
+     *A container with `layout_inv` still lets its layout place all of its children.*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv) {
@@ -1157,6 +1167,19 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the path from the screen to `obj` to tell `layout_update_core` which subtrees to walk.
+ * If an ancestor is already marked, its ancestors are marked too.
+ */
+static void mark_child_layout_as_dirty(lv_obj_t * obj)
+{
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent && parent->child_layout_inv == 0) {
+        parent->child_layout_inv = 1;
+        parent = lv_obj_get_parent(parent);
+    }
+}
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int16_t angle = lv_obj_get_style_transform_angle(obj, 0);
@@ -11,6 +11,7 @@
 #include "lv_indev.h"
 #include "lv_disp.h"
 #include "lv_indev_scroll.h"
+#include "lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -36,6 +37,13 @@ static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_anim_ready_cb(lv_anim_t * a);
 static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_point_t * scroll_value,
                                   lv_anim_enable_t anim_en);
+static bool scroll_copy(lv_obj_t * obj, lv_coord_t dy);
+static bool scroll_copy_draw_is_known(const lv_obj_t * obj);
+static bool scroll_copy_clip(const lv_obj_t * obj, lv_area_t * area);
+static void scroll_copy_inv_siblings(lv_disp_t * disp, const lv_obj_t * parent, uint32_t start,
+                                     const lv_area_t * region);
+static void scroll_copy_inv_obj(lv_disp_t * disp, const lv_obj_t * obj, const lv_area_t * region);
+static void scroll_copy_inv_overlay(lv_disp_t * disp, const lv_area_t * area, const lv_area_t * region);
 
 /**********************
  *  STATIC VARIABLES
@@ -419,9 +427,13 @@ lv_res_t _lv_obj_scroll_by_raw(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     obj->spec_attr->scroll.y += y;
 
     lv_obj_move_children_by(obj, x, y, true);
+
+    /*Move the pixels before the scroll event to not move what the event handlers invalidate*/
+    bool copied = x == 0 && scroll_copy(obj, y);
+
     lv_res_t res = lv_event_send(obj, LV_EVENT_SCROLL, NULL);
     if(res != LV_RES_OK) return res;
-    lv_obj_invalidate(obj);
+    if(!copied) lv_obj_invalidate(obj);
     return LV_RES_OK;
 }
 
@@ -798,3 +810,185 @@ static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_p
     scroll_value->y += anim_en == LV_ANIM_OFF ? 0 : y_scroll;
     lv_obj_scroll_by(parent, x_scroll, y_scroll, anim_en);
 }
+
+/**
+ * Move the pixels of the scrolled content on the display instead of redrawing them.
+ * The content is moved inside the background and border of the object. Everything drawn over it
+ * (scrollbars, floating children, younger siblings, the layers) is redrawn.
+ * @param obj   pointer to an object which was just scrolled vertically
+ * @param dy    the scrolled amount
+ * @return      true: the pixels will be moved; false: the object needs to be invalidated
+ */
+static bool scroll_copy(lv_obj_t * obj, lv_coord_t dy)
+{
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    if(!disp->driver->scroll_copy) return false;
+    if(disp->prev_scr || lv_obj_get_screen(obj) != disp->act_scr) return false;
+
+    /*The background has to be a solid color to look the same anywhere*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN)) return false;
+    if(lv_obj_get_style_blend_mode(obj, LV_PART_MAIN) != LV_BLEND_MODE_NORMAL) return false;
+
+    /*Nothing should be blended with what's under the object*/
+    const lv_obj_t * parent;
+    for(parent = obj; parent; parent = lv_obj_get_parent(parent)) {
+        if(!scroll_copy_draw_is_known(parent)) return false;
+        if(_lv_obj_get_layer_type(parent) != LV_LAYER_TYPE_NONE) return false;
+        if(parent != obj && lv_obj_get_style_clip_corner(parent, LV_PART_MAIN) &&
+           lv_obj_get_style_radius(parent, LV_PART_MAIN) > 0) return false;
+    }
+
+    lv_obj_t * top = lv_disp_get_layer_top(disp);
+    lv_obj_t * sys = lv_disp_get_layer_sys(disp);
+    if(lv_obj_get_style_bg_opa(top, LV_PART_MAIN) > LV_OPA_TRANSP) return false;
+    if(lv_obj_get_style_bg_opa(sys, LV_PART_MAIN) > LV_OPA_TRANSP) return false;
+
+    /*Leave out the border and the rounded corners*/
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+    lv_coord_t r = LV_MIN(lv_obj_get_style_radius(obj, LV_PART_MAIN), LV_MIN(w, h) / 2);
+    lv_coord_t inset = LV_MAX(lv_obj_get_style_border_width(obj, LV_PART_MAIN), r);
+    lv_area_t region = obj->coords;
+    lv_area_increase(&region, -inset, -inset);
+    if(!scroll_copy_clip(obj, &region)) return false;
+
+    /*Redraw what is over the region on the old and new place. The areas invalidated before the move are moved too.*/
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    ver_area.y1 = region.y1;
+    ver_area.y2 = region.y2;
+    scroll_copy_inv_overlay(disp, &hor_area, &region);
+    scroll_copy_inv_overlay(disp, &ver_area, &region);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) scroll_copy_inv_obj(disp, child, &region);
+    }
+
+    const lv_obj_t * child = obj;
+    for(parent = lv_obj_get_parent(obj); parent; parent = lv_obj_get_parent(parent)) {
+        scroll_copy_inv_siblings(disp, parent, lv_obj_get_index(child) + 1, &region);
+
+        lv_obj_get_scrollbar_area((lv_obj_t *)parent, &hor_area, &ver_area);
+        scroll_copy_inv_overlay(disp, &hor_area, &region);
+        scroll_copy_inv_overlay(disp, &ver_area, &region);
+
+        if(lv_obj_get_style_border_post(parent, LV_PART_MAIN)) {
+            lv_area_t inner = parent->coords;
+            lv_coord_t bw = lv_obj_get_style_border_width(parent, LV_PART_MAIN);
+            lv_area_increase(&inner, -bw, -bw);
+            lv_area_t border[4];
+            int8_t border_cnt = _lv_area_diff(border, &parent->coords, &inner);
+            int8_t j;
+            for(j = 0; j < border_cnt; j++) scroll_copy_inv_overlay(disp, &border[j], &region);
+        }
+        child = parent;
+    }
+
+    scroll_copy_inv_siblings(disp, top, 0, &region);
+    scroll_copy_inv_siblings(disp, sys, 0, &region);
+
+    if(!_lv_inv_scroll(disp, &region, dy)) return false;
+
+    /*Redraw the rest of the object*/
+    lv_area_t obj_area = obj->coords;
+    if(scroll_copy_clip(obj, &obj_area)) {
+        lv_area_t frame[4];
+        int8_t frame_cnt = _lv_area_diff(frame, &obj_area, &region);
+        int8_t j;
+        for(j = 0; j < frame_cnt; j++) _lv_inv_area(disp, &frame[j]);
+    }
+
+    return true;
+}
+
+/**
+ * Tell if everything an object draws is considered by `scroll_copy`.
+ * @param obj   pointer to an object
+ * @return      true: only the known classes and no user callbacks draw on the object
+ */
+static bool scroll_copy_draw_is_known(const lv_obj_t * obj)
+{
+    if(_lv_event_has_draw_cb(obj)) return false;
+
+    const lv_obj_class_t * class_p;
+    for(class_p = obj->class_p; class_p; class_p = class_p->base_class) {
+        if(class_p->event_cb && !class_p->scroll_copy) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Clip an area to the visible part of an object. There are no transformations on the object and its parents.
+ * @param obj   pointer to an object
+ * @param area  an area on the object, it's clipped in place
+ * @return      false: the area is not visible
+ */
+static bool scroll_copy_clip(const lv_obj_t * obj, lv_area_t * area)
+{
+    if(!_lv_area_intersect(area, area, &obj->coords)) return false;
+
+    const lv_obj_t * parent;
+    for(parent = obj; parent; parent = lv_obj_get_parent(parent)) {
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+        if(parent != obj && !lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE) &&
+           !_lv_area_intersect(area, area, &parent->coords)) return false;
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(obj);
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    return _lv_area_intersect(area, area, &scr_area);
+}
+
+/**
+ * Redraw the children of an object from an index over the moved region.
+ * @param disp      the display of the region
+ * @param parent    pointer to an object
+ * @param start     index of the first child to redraw
+ * @param region    the moved region
+ */
+static void scroll_copy_inv_siblings(lv_disp_t * disp, const lv_obj_t * parent, uint32_t start,
+                                     const lv_area_t * region)
+{
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    uint32_t i;
+    for(i = start; i < child_cnt; i++) {
+        scroll_copy_inv_obj(disp, parent->spec_attr->children[i], region);
+    }
+}
+
+/**
+ * Redraw an object drawn over the moved region.
+ * @param disp      the display of the region
+ * @param obj       pointer to an object
+ * @param region    the moved region
+ */
+static void scroll_copy_inv_obj(lv_disp_t * disp, const lv_obj_t * obj, const lv_area_t * region)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    lv_area_t area = obj->coords;
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&area, ext_size, ext_size);
+    scroll_copy_inv_overlay(disp, &area, region);
+}
+
+/**
+ * Invalidate the part of an area which is on the moved region.
+ * @param disp      the display of the region
+ * @param area      an area drawn over the region. Nothing happens if it's empty.
+ * @param region    the moved region
+ */
+static void scroll_copy_inv_overlay(lv_disp_t * disp, const lv_area_t * area, const lv_area_t * region)
+{
+    lv_area_t com;
+    if(_lv_area_intersect(&com, area, region)) _lv_inv_area(disp, &com);
+}
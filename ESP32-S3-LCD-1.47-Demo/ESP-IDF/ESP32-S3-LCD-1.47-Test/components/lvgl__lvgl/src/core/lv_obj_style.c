@@ -15,6 +15,10 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_OBJ_STYLE_CACHE_SIZE & (LV_OBJ_STYLE_CACHE_SIZE - 1)
+    #error "LV_OBJ_STYLE_CACHE_SIZE must be a power of 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +39,17 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 } cache_t;
 
+/*A resolved property of an object's part in a given state*/
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t version;               /*`_lv_style_version` when the entry was saved*/
+    lv_style_value_t value;
+    lv_style_prop_t prop;
+    lv_state_t state;
+    uint8_t part;                   /*The part shifted down to fit into 8 bits*/
+    uint8_t res;                    /*The `lv_style_res_t` of the lookup*/
+} style_cache_entry_t;
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -45,7 +60,11 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+static lv_style_res_t get_prop_styles(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
+static void invalidate_style_cache(const lv_obj_t * obj, lv_style_prop_t prop);
+static void own_style_set_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
+static bool own_style_remove_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
@@ -60,6 +79,15 @@ static void fade_in_anim_ready(lv_anim_t * a);
  **********************/
 static bool style_refr = true;
 
+/*Incremented by every change of a style, see lv_style.c*/
+extern uint32_t _lv_style_version;
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+    static style_cache_entry_t style_cache[LV_OBJ_STYLE_CACHE_SIZE];
+    static bool style_cache_en = true;
+    static lv_obj_style_cache_monitor_t style_cache_mon;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -127,7 +155,9 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         }
 
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
+            uint32_t version = _lv_style_version;
             lv_style_reset(obj->styles[i].style);
+            _lv_style_version = version;    /*Only `obj` used it, its entries are dropped below*/
             lv_mem_free(obj->styles[i].style);
             obj->styles[i].style = NULL;
         }
@@ -145,6 +175,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         /*The style from the current `i` index is removed, so `i` points to the next style.
          *Therefore it doesn't needs to be incremented*/
     }
+    if(deleted) invalidate_style_cache(obj, LV_STYLE_PROP_ANY);
     if(deleted && prop != LV_STYLE_PROP_INV) {
         lv_obj_refresh_style(obj, part, prop);
     }
@@ -168,9 +199,9 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    if(!style_refr) return;
+    invalidate_style_cache(obj, prop);
 
-    lv_obj_invalidate(obj);
+    if(!style_refr) return;
 
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
@@ -179,6 +210,11 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_INHERIT);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_LAYER_REFR);
 
+    /*E.g. the fading of the scrollbar shouldn't redraw the scrolled content*/
+    bool scrollbar_only = part == LV_PART_SCROLLBAR && prop != LV_STYLE_PROP_ANY && !is_layout_refr && !is_ext_draw;
+    if(scrollbar_only) lv_obj_scrollbar_invalidate(obj);
+    else lv_obj_invalidate(obj);
+
     if(is_layout_refr) {
         if(part == LV_PART_ANY ||
            part == LV_PART_MAIN ||
@@ -206,7 +242,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
         lv_obj_refresh_ext_draw_size(obj);
     }
-    lv_obj_invalidate(obj);
+    if(scrollbar_only) lv_obj_scrollbar_invalidate(obj);
+    else lv_obj_invalidate(obj);
 
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
         if(part != LV_PART_SCROLLBAR) {
@@ -220,6 +257,18 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+void lv_obj_enable_style_cache(bool en)
+{
+    style_cache_en = en;
+}
+
+void lv_obj_style_cache_monitor(lv_obj_style_cache_monitor_t * mon_p)
+{
+    *mon_p = style_cache_mon;
+}
+#endif
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     lv_style_value_t value_act;
@@ -271,7 +320,7 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
                                  lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
-    lv_style_set_prop(style, prop, value);
+    own_style_set_prop(obj, style, prop, value);
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -279,7 +328,9 @@ void lv_obj_set_local_style_prop_meta(lv_obj_t * obj, lv_style_prop_t prop, uint
                                       lv_style_selector_t selector)
 {
     lv_style_t * style = get_local_style(obj, selector);
+    uint32_t version = _lv_style_version;
     lv_style_set_prop_meta(style, prop, meta);
+    _lv_style_version = version;    /*`lv_obj_refresh_style` drops the entries of `obj`*/
     lv_obj_refresh_style(obj, selector, prop);
 }
 
@@ -314,7 +365,7 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
-    lv_res_t res = lv_style_remove_prop(obj->styles[i].style, prop);
+    lv_res_t res = own_style_remove_prop(obj, obj->styles[i].style, prop);
     if(res == LV_RES_OK) {
         lv_obj_refresh_style(obj, selector, prop);
     }
@@ -341,7 +392,7 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
     obj->state = new_state;
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
-    lv_style_set_prop(style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
+    own_style_set_prop(obj, style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -564,7 +615,9 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = lv_mem_alloc(sizeof(lv_style_t));
+    uint32_t version = _lv_style_version;
     lv_style_init(obj->styles[i].style);
+    _lv_style_version = version;    /*An empty style changes no property*/
     obj->styles[i].is_local = 1;
     obj->styles[i].selector = selector;
     return obj->styles[i].style;
@@ -596,14 +649,74 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 
     lv_memset_00(&obj->styles[0], sizeof(_lv_obj_style_t));
     obj->styles[0].style = lv_mem_alloc(sizeof(lv_style_t));
+    uint32_t version = _lv_style_version;
     lv_style_init(obj->styles[0].style);
+    _lv_style_version = version;    /*An empty style changes no property*/
     obj->styles[0].is_trans = 1;
     obj->styles[0].selector = selector;
     return &obj->styles[0];
 }
 
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Get the only cache entry which can hold a property of an object's part
+ * @param obj   pointer to an object
+ * @param part  a part of the object
+ * @param prop  a style property
+ * @return      pointer to the entry
+ */
+static style_cache_entry_t * style_cache_slot(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    uint32_t key = (uint32_t)(lv_uintptr_t)obj ^ ((uint32_t)prop * 0x9E3779B1U) ^ part;
+    return &style_cache[((key * 2654435761U) >> 16) & (LV_OBJ_STYLE_CACHE_SIZE - 1)];
+}
+#endif
+
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
+{
+    if(obj->style_cnt == 0) return LV_STYLE_RES_NOT_FOUND;
+
+#if LV_OBJ_STYLE_CACHE_SIZE
+    style_cache_mon.lookup_cnt++;
+
+    /*The transition styles are skipped only temporarily to get the original value*/
+    if(!style_cache_en || obj->skip_trans) return get_prop_styles(obj, part, prop, v);
+
+    style_cache_entry_t * e = style_cache_slot(obj, part, prop);
+    uint8_t part_id = (uint8_t)(part >> 16);
+    if(e->obj == obj && e->version == _lv_style_version && e->prop == prop && e->part == part_id &&
+       e->state == obj->state) {
+        style_cache_mon.hit_cnt++;
+        *v = e->value;
+        return e->res;
+    }
+
+    lv_style_res_t res = get_prop_styles(obj, part, prop, v);
+    e->obj = obj;
+    e->version = _lv_style_version;
+    e->prop = prop;
+    e->part = part_id;
+    e->state = obj->state;
+    e->res = res;
+    if(res == LV_STYLE_RES_FOUND) e->value = *v;
+    return res;
+#else
+    return get_prop_styles(obj, part, prop, v);
+#endif
+}
+
+/**
+ * Find a property in the styles of an object. The object's state and the transitions are considered
+ * but the property is not inherited.
+ * @param obj   pointer to an object
+ * @param part  a part of the object
+ * @param prop  a style property
+ * @param v     store the value here if found
+ * @return      LV_STYLE_RES_FOUND, LV_STYLE_RES_NOT_FOUND or LV_STYLE_RES_INHERIT
+ */
+static lv_style_res_t get_prop_styles(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
 {
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
     int32_t weight = -1;
@@ -691,6 +804,68 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+/**
+ * Drop the cached values of an object. The entries of other objects stay valid, even of the children:
+ * an entry holds only the value found in the object's own styles, inheritance is resolved after the cache.
+ * (A change of a shared style increments `_lv_style_version` which drops every entry.)
+ * @param obj   pointer to an object
+ * @param prop  the changed property or `LV_STYLE_PROP_ANY`
+ */
+static void invalidate_style_cache(const lv_obj_t * obj, lv_style_prop_t prop)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    if(prop == LV_STYLE_PROP_ANY) {
+        uint32_t i;
+        for(i = 0; i < LV_OBJ_STYLE_CACHE_SIZE; i++) {
+            if(style_cache[i].obj == obj) style_cache[i].obj = NULL;
+        }
+    }
+    else {
+        /*Only the slots of the property in each part can hold it*/
+        uint32_t part_id;
+        for(part_id = 0; part_id <= (LV_PART_ANY >> 16); part_id++) {
+            style_cache_entry_t * e = style_cache_slot(obj, part_id << 16, prop);
+            if(e->obj == obj && e->prop == prop) e->obj = NULL;
+        }
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(prop);
+#endif
+}
+
+/**
+ * Set a property in a local or transition style of an object. Only the object uses these styles,
+ * so only its cached values are dropped instead of the whole cache.
+ * @param obj   pointer to an object
+ * @param style a local or transition style of `obj`
+ * @param prop  the property to set
+ * @param value the new value
+ */
+static void own_style_set_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value)
+{
+    uint32_t version = _lv_style_version;
+    lv_style_set_prop(style, prop, value);
+    _lv_style_version = version;
+    invalidate_style_cache(obj, prop);
+}
+
+/**
+ * Remove a property from a local or transition style of an object, see `own_style_set_prop()`
+ * @param obj   pointer to an object
+ * @param style a local or transition style of `obj`
+ * @param prop  the property to remove
+ * @return      true: the property was found and removed
+ */
+static bool own_style_remove_prop(lv_obj_t * obj, lv_style_t * style, lv_style_prop_t prop)
+{
+    uint32_t version = _lv_style_version;
+    bool res = lv_style_remove_prop(style, prop);
+    _lv_style_version = version;
+    if(res) invalidate_style_cache(obj, prop);
+    return res;
+}
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -737,7 +912,7 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             uint32_t i;
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
-                    lv_style_remove_prop(obj->styles[i].style, tr->prop);
+                    own_style_remove_prop(obj, obj->styles[i].style, tr->prop);
                 }
             }
 
@@ -809,7 +984,7 @@ static void trans_anim_cb(void * _tr, int32_t v)
                 refr = false;
             }
         }
-        lv_style_set_prop(obj->styles[i].style, tr->prop, value_final);
+        own_style_set_prop(obj, obj->styles[i].style, tr->prop, value_final);
         if(refr) lv_obj_refresh_style(tr->obj, tr->selector, tr->prop);
         break;
 
@@ -834,7 +1009,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
     tr->prop = prop_tmp;
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
-    lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+    own_style_set_prop(tr->obj, style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
 
 }
 
@@ -864,7 +1039,7 @@ static void trans_anim_ready_cb(lv_anim_t * a)
                 lv_mem_free(tr);
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
-                lv_style_remove_prop(obj_style->style, prop);
+                own_style_remove_prop(obj, obj_style->style, prop);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
@@ -54,6 +54,11 @@ typedef struct {
 #endif
 } _lv_obj_style_transition_dsc_t;
 
+typedef struct {
+    uint32_t lookup_cnt;    /**< Number of property lookups on objects with styles*/
+    uint32_t hit_cnt;       /**< Number of lookups served from the cache*/
+} lv_obj_style_cache_monitor_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -118,6 +123,20 @@ void lv_obj_refresh_style(struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_CACHE_SIZE
+/**
+ * Enable or disable the cache of resolved style properties. Enabled by default.
+ * @param en        true: use the cache; false: always look up the properties in the styles
+ */
+void lv_obj_enable_style_cache(bool en);
+
+/**
+ * Get the number of property lookups and cache hits since `lv_init()`
+ * @param mon_p     pointer to a `lv_obj_style_cache_monitor_t` variable to store the result
+ */
+void lv_obj_style_cache_monitor(lv_obj_style_cache_monitor_t * mon_p);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include <stdlib.h>
+#include <string.h>
 
 #include "lv_obj.h"
 #include "lv_indev.h"
@@ -28,6 +29,7 @@
  **********************/
 static void lv_obj_del_async_cb(void * obj);
 static void obj_del_core(lv_obj_t * obj);
+static void del_children(lv_obj_t * obj);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 
 /**********************
@@ -84,11 +86,8 @@ void lv_obj_clean(lv_obj_t * obj)
 
     lv_obj_invalidate(obj);
 
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_del_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
+    del_children(obj);
+
     /*Just to remove scroll animations if any*/
     lv_obj_scroll_to(obj, 0, 0, LV_ANIM_OFF);
     if(obj->spec_attr) {
@@ -141,29 +140,12 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_invalidate(obj);
 
-    lv_obj_allocate_spec_attr(parent);
-
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
-    int32_t i;
-    for(i = lv_obj_get_index(obj); i <= (int32_t)lv_obj_get_child_cnt(old_parent) - 2; i++) {
-        old_parent->spec_attr->children[i] = old_parent->spec_attr->children[i + 1];
-    }
-    old_parent->spec_attr->child_cnt--;
-    if(old_parent->spec_attr->child_cnt) {
-        old_parent->spec_attr->children = lv_mem_realloc(old_parent->spec_attr->children,
-                                                         old_parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    }
-    else {
-        lv_mem_free(old_parent->spec_attr->children);
-        old_parent->spec_attr->children = NULL;
-    }
+    _lv_obj_remove_child(old_parent, obj);
 
     /*Add the child to the new parent as the last (newest child)*/
-    parent->spec_attr->child_cnt++;
-    parent->spec_attr->children = lv_mem_realloc(parent->spec_attr->children,
-                                                 parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    parent->spec_attr->children[lv_obj_get_child_cnt(parent) - 1] = obj;
+    _lv_obj_add_child(parent, obj);
 
     obj->parent = parent;
 
@@ -337,6 +319,67 @@ void lv_obj_tree_walk(lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * use
     walk_core(start_obj, cb, user_data);
 }
 
+void _lv_obj_add_child(lv_obj_t * parent, lv_obj_t * obj)
+{
+    lv_obj_allocate_spec_attr(parent);
+    _lv_obj_spec_attr_t * attr = parent->spec_attr;
+    if(attr == NULL) return;
+
+    /*Most parents have only one child (e.g. a button with a label) so store it without allocation*/
+    if(attr->child_cnt == 0) {
+        attr->child_single = obj;
+        attr->children = &attr->child_single;
+        attr->child_cnt = 1;
+        return;
+    }
+
+    lv_obj_t ** children;
+    if(attr->child_cnt == 1) {
+        children = lv_mem_alloc(2 * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(children);
+        if(children == NULL) return;
+        children[0] = attr->child_single;
+        attr->child_single = NULL;
+    }
+    else {
+        children = lv_mem_realloc(attr->children, (attr->child_cnt + 1) * sizeof(lv_obj_t *));
+        LV_ASSERT_MALLOC(children);
+        if(children == NULL) return;
+    }
+
+    children[attr->child_cnt] = obj;
+    attr->children = children;
+    attr->child_cnt++;
+}
+
+void _lv_obj_remove_child(lv_obj_t * parent, lv_obj_t * obj)
+{
+    _lv_obj_spec_attr_t * attr = parent->spec_attr;
+
+    uint32_t i;
+    for(i = 0; i < attr->child_cnt; i++) {
+        if(attr->children[i] == obj) break;
+    }
+    if(i == attr->child_cnt) return;
+
+    /*The children are deleted from the oldest, so shift the rest at once*/
+    memmove(&attr->children[i], &attr->children[i + 1], (attr->child_cnt - i - 1) * sizeof(lv_obj_t *));
+    attr->child_cnt--;
+
+    if(attr->child_cnt == 0) {
+        attr->child_single = NULL;
+        attr->children = NULL;
+    }
+    else if(attr->child_cnt == 1) {
+        attr->child_single = attr->children[0];
+        lv_mem_free(attr->children);
+        attr->children = &attr->child_single;
+    }
+    else {
+        attr->children = lv_mem_realloc(attr->children, attr->child_cnt * sizeof(lv_obj_t *));
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -357,11 +400,7 @@ static void obj_del_core(lv_obj_t * obj)
     obj->being_deleted = 1;
 
     /*Recursively delete the children*/
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_del_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
+    del_children(obj);
 
     lv_group_t * group = lv_obj_get_group(obj);
 
@@ -382,6 +421,7 @@ static void obj_del_core(lv_obj_t * obj)
     }
 
     /*All children deleted. Now clean up the object specific data*/
+    const lv_obj_class_t * class_p = obj->class_p;
     _lv_obj_destruct(obj);
 
     /*Remove the screen for the screen list*/
@@ -402,21 +442,27 @@ static void obj_del_core(lv_obj_t * obj)
     }
     /*Remove the object from the child list of its parent*/
     else {
-        uint32_t id = lv_obj_get_index(obj);
-        uint32_t i;
-        for(i = id; i < obj->parent->spec_attr->child_cnt - 1; i++) {
-            obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
-        }
-        obj->parent->spec_attr->child_cnt--;
-        obj->parent->spec_attr->children = lv_mem_realloc(obj->parent->spec_attr->children,
-                                                          obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        _lv_obj_remove_child(obj->parent, obj);
     }
 
     /*Free the object itself*/
-    lv_mem_free(obj);
+    _lv_obj_class_free_obj(obj, class_p);
 }
 
 
+/**
+ * Delete all the children of an object, from the oldest to the youngest
+ * @param obj       pointer to an object
+ */
+static void del_children(lv_obj_t * obj)
+{
+    lv_obj_t * child = lv_obj_get_child(obj, 0);
+    while(child) {
+        obj_del_core(child);
+        child = lv_obj_get_child(obj, 0);
+    }
+}
+
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
 {
     lv_obj_tree_walk_res_t res = LV_OBJ_TREE_WALK_NEXT;
@@ -160,6 +160,20 @@ uint32_t lv_obj_get_index(const struct _lv_obj_t * obj);
  */
 void lv_obj_tree_walk(struct _lv_obj_t * start_obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 
+/**
+ * Append an object to the child list of a parent. Only for internal use.
+ * @param parent    pointer to the parent
+ * @param obj       pointer to the new child
+ */
+void _lv_obj_add_child(struct _lv_obj_t * parent, struct _lv_obj_t * obj);
+
+/**
+ * Remove an object from the child list of its parent. Only for internal use.
+ * @param parent    pointer to the parent
+ * @param obj       pointer to a child of `parent`
+ */
+void _lv_obj_remove_child(struct _lv_obj_t * parent, struct _lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
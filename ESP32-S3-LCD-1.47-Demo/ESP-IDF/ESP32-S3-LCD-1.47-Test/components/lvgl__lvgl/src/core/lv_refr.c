@@ -11,6 +11,7 @@
 #include "lv_disp.h"
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
+#include "../hal/lv_hal_indev.h"
 #include "../misc/lv_timer.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
@@ -21,17 +22,21 @@
 
 #if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
     #include "../widgets/lv_label.h"
+    #include <string.h>
 #endif
 
 /*********************
  *      DEFINES
  *********************/
+#define COVER_CACHE_BITS    6
+#define COVER_CACHE_SIZE    (1 << COVER_CACHE_BITS)
+#define OCCLUDER_MAX        8
+#define MONITOR_PERIOD      300
 
 /**********************
  *      TYPEDEFS
  **********************/
 typedef struct {
-    uint32_t    perf_last_time;
     uint32_t    elaps_sum;
     uint32_t    frame_cnt;
     uint32_t    fps_sum_cnt;
@@ -42,23 +47,41 @@ typedef struct {
 } perf_monitor_t;
 
 typedef struct {
-    uint32_t     mem_last_time;
 #if LV_USE_LABEL
     lv_obj_t  *  mem_label;
 #endif
 } mem_monitor_t;
 
+typedef struct {
+    const lv_obj_t * obj;
+    lv_area_t opaque;       /*The object surely covers this area. Empty (x1 > x2) if nothing*/
+} cover_cache_t;
+
+/*The largest opaque areas of the children of a parent on the clip area*/
+typedef struct {
+    uint32_t cnt;
+    uint32_t id[OCCLUDER_MAX];      /*Index of the child*/
+    lv_area_t area[OCCLUDER_MAX];   /*Its opaque area clipped to the clip area*/
+} occluders_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_scroll_area(void);
+static void refr_report_latency(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static const lv_area_t * refr_get_opaque_area(lv_obj_t * obj);
+static void refr_get_occluders(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start_id, occluders_t * occ);
+static bool refr_obj_is_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t child_id,
+                                 const occluders_t * occ);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
@@ -69,6 +92,12 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 #if LV_USE_MEM_MONITOR
     static void mem_monitor_init(mem_monitor_t * mem_monitor);
 #endif
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    static void monitor_timer_cb(lv_timer_t * timer);
+#endif
+#if (LV_USE_PERF_MONITOR || (LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0)) && LV_USE_LABEL
+    static void monitor_label_set_text(lv_obj_t * label, const char * text);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -76,6 +105,10 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
 
+/*Result of the cover checks, valid only while a frame is being refreshed*/
+static cover_cache_t cover_cache[COVER_CACHE_SIZE];
+static bool cover_cache_valid;
+
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
 #endif
@@ -84,6 +117,10 @@ static lv_disp_t * disp_refr; /*Display being refreshed*/
     static mem_monitor_t    mem_monitor;
 #endif
 
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    static lv_timer_t * monitor_timer;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -108,6 +145,9 @@ void _lv_refr_init(void)
 #if LV_USE_MEM_MONITOR
     mem_monitor_init(&mem_monitor);
 #endif
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    monitor_timer = NULL;
+#endif
 }
 
 void lv_refr_now(lv_disp_t * disp)
@@ -175,9 +215,12 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
     if(refr_children) {
         draw_ctx->clip_area = &clip_coords_for_children;
+        occluders_t occ;
+        refr_get_occluders(draw_ctx, obj, 1, &occ);
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
+            if(refr_obj_is_occluded(draw_ctx, obj, i, &occ)) continue;
             lv_obj_t * child = obj->spec_attr->children[i];
             refr_obj(draw_ctx, child);
         }
@@ -251,15 +294,61 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save the area*/
     if(disp->inv_p < LV_INV_BUF_SIZE) {
         lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    else {   /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
+    else {   /*If no place for the area join it into the saved area which grows the least*/
+        inv_area_join_cheapest(disp, &com_area);
     }
-    disp->inv_p++;
     if(disp->refr_timer) lv_timer_resume(disp->refr_timer);
 }
 
+bool _lv_inv_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dy)
+{
+    if(!disp) disp = lv_disp_get_default();
+    if(!disp) return false;
+
+    lv_disp_drv_t * drv = disp->driver;
+    if(!drv->scroll_copy || drv->full_refresh || drv->rotated != LV_DISP_ROT_NONE) return false;
+    /*Without `scroll_cb` the pixels can be moved only in a screen sized buffer*/
+    if(drv->scroll_cb == NULL && (!drv->direct_mode || drv->set_px_cb || drv->screen_transp)) return false;
+    if(!lv_disp_is_invalidation_enabled(disp) || disp->rendering_in_progress) return false;
+
+    lv_area_t area;
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_disp_get_hor_res(disp) - 1, lv_disp_get_ver_res(disp) - 1);
+    if(!_lv_area_intersect(&area, area_p, &scr_area)) return false;
+    if(disp->scroll_dy != 0 && !_lv_area_is_equal(&disp->scroll_area, &area)) return false;
+    if(dy == 0) return true;
+
+    lv_coord_t h = lv_area_get_height(&area);
+    if(LV_ABS(disp->scroll_dy + dy) >= h) {
+        _lv_inv_area(disp, &area);
+        disp->scroll_dy = 0;
+        return true;
+    }
+
+    /*The pixels of the areas which are already invalid are moved too so they need to be redrawn on the new place too*/
+    uint16_t inv_p = disp->inv_p;
+    uint16_t i;
+    for(i = 0; i < inv_p; i++) {
+        lv_area_t moved;
+        if(!_lv_area_intersect(&moved, &disp->inv_areas[i], &area)) continue;
+        moved.y1 += dy;
+        moved.y2 += dy;
+        if(_lv_area_intersect(&moved, &moved, &area)) _lv_inv_area(disp, &moved);
+    }
+
+    /*Redraw the uncovered strip*/
+    lv_area_t strip = area;
+    if(dy > 0) strip.y2 = area.y1 + dy - 1;
+    else strip.y1 = area.y2 + dy + 1;
+    _lv_inv_area(disp, &strip);
+
+    disp->scroll_area = area;
+    disp->scroll_dy += dy;
+    return true;
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -293,18 +382,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     if(tmr) {
         disp_refr = tmr->user_data;
-#if LV_USE_PERF_MONITOR == 0 && LV_USE_MEM_MONITOR == 0
-        /**
-         * Ensure the timer does not run again automatically.
-         * This is done before refreshing in case refreshing invalidates something else.
-         */
-        lv_timer_pause(tmr);
-#endif
     }
     else {
         disp_refr = lv_disp_get_default();
     }
 
+    /*Keep the memory of the temporal buffers for the whole frame*/
+    lv_mem_buf_mark_t buf_mark = lv_mem_buf_mark();
+
     /*Refresh the screen's layout if required*/
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
@@ -312,9 +397,17 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
 
+    /**
+     * Ensure the timer does not run again automatically.
+     * This is done after the layout update because the areas invalidated by it are refreshed now,
+     * but before refreshing in case refreshing invalidates something else.
+     */
+    if(tmr) lv_timer_pause(tmr);
+
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        lv_mem_buf_release_to(buf_mark);
         LV_LOG_WARN("there is no active screen");
         REFR_TRACE("finished");
         return;
@@ -322,7 +415,12 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+    refr_scroll_area();
+
+    lv_memset_00(cover_cache, sizeof(cover_cache));
+    cover_cache_valid = true;
     refr_invalid_areas();
+    cover_cache_valid = false;
 
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
@@ -351,100 +449,31 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         if(disp_refr->driver->monitor_cb) {
             disp_refr->driver->monitor_cb(disp_refr->driver, elaps, px_num);
         }
+
+        refr_report_latency();
     }
 
-    lv_mem_buf_free_all();
+    /*Frees the chunks of the frame but the first which is kept for the next frame*/
+    lv_mem_buf_release_to(buf_mark);
+    lv_obj_class_trim_slabs();
     _lv_font_clean_up_fmt_txt();
 
 #if LV_DRAW_COMPLEX
     _lv_draw_mask_cleanup();
 #endif
 
-#if LV_USE_PERF_MONITOR && LV_USE_LABEL
-    lv_obj_t * perf_label = perf_monitor.perf_label;
-    if(perf_label == NULL) {
-        perf_label = lv_label_create(lv_layer_sys());
-        lv_obj_set_style_bg_opa(perf_label, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(perf_label, lv_color_black(), 0);
-        lv_obj_set_style_text_color(perf_label, lv_color_white(), 0);
-        lv_obj_set_style_pad_top(perf_label, 3, 0);
-        lv_obj_set_style_pad_bottom(perf_label, 3, 0);
-        lv_obj_set_style_pad_left(perf_label, 3, 0);
-        lv_obj_set_style_pad_right(perf_label, 3, 0);
-        lv_obj_set_style_text_align(perf_label, LV_TEXT_ALIGN_RIGHT, 0);
-        lv_label_set_text(perf_label, "?");
-        lv_obj_align(perf_label, LV_USE_PERF_MONITOR_POS, 0, 0);
-        perf_monitor.perf_label = perf_label;
-    }
-
-    if(lv_tick_elaps(perf_monitor.perf_last_time) < 300) {
-        if(px_num > 5000) {
-            perf_monitor.elaps_sum += elaps;
-            perf_monitor.frame_cnt ++;
-        }
-    }
-    else {
-        perf_monitor.perf_last_time = lv_tick_get();
-        uint32_t fps_limit;
-        uint32_t fps;
-
-        if(disp_refr->refr_timer) {
-            fps_limit = 1000 / disp_refr->refr_timer->period;
-        }
-        else {
-            fps_limit = 1000 / LV_DISP_DEF_REFR_PERIOD;
-        }
-
-        if(perf_monitor.elaps_sum == 0) {
-            perf_monitor.elaps_sum = 1;
-        }
-        if(perf_monitor.frame_cnt == 0) {
-            fps = fps_limit;
-        }
-        else {
-            fps = (1000 * perf_monitor.frame_cnt) / perf_monitor.elaps_sum;
-        }
-        perf_monitor.elaps_sum = 0;
-        perf_monitor.frame_cnt = 0;
-        if(fps > fps_limit) {
-            fps = fps_limit;
-        }
-
-        perf_monitor.fps_sum_all += fps;
-        perf_monitor.fps_sum_cnt ++;
-        uint32_t cpu = 100 - lv_timer_get_idle();
-        lv_label_set_text_fmt(perf_label, "%"LV_PRIu32" FPS\n%"LV_PRIu32"%% CPU", fps, cpu);
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    /*The monitors are updated by their own timer, so they don't keep the display refreshing*/
+    if(monitor_timer == NULL) {
+        monitor_timer = lv_timer_create(monitor_timer_cb, MONITOR_PERIOD, NULL);
+        monitor_timer_cb(monitor_timer);
     }
 #endif
 
-#if LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0 && LV_USE_LABEL
-    lv_obj_t * mem_label = mem_monitor.mem_label;
-    if(mem_label == NULL) {
-        mem_label = lv_label_create(lv_layer_sys());
-        lv_obj_set_style_bg_opa(mem_label, LV_OPA_50, 0);
-        lv_obj_set_style_bg_color(mem_label, lv_color_black(), 0);
-        lv_obj_set_style_text_color(mem_label, lv_color_white(), 0);
-        lv_obj_set_style_pad_top(mem_label, 3, 0);
-        lv_obj_set_style_pad_bottom(mem_label, 3, 0);
-        lv_obj_set_style_pad_left(mem_label, 3, 0);
-        lv_obj_set_style_pad_right(mem_label, 3, 0);
-        lv_label_set_text(mem_label, "?");
-        lv_obj_align(mem_label, LV_USE_MEM_MONITOR_POS, 0, 0);
-        mem_monitor.mem_label = mem_label;
-    }
-
-    if(lv_tick_elaps(mem_monitor.mem_last_time) > 300) {
-        mem_monitor.mem_last_time = lv_tick_get();
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        uint32_t used_size = mon.total_size - mon.free_size;;
-        uint32_t used_kb = used_size / 1024;
-        uint32_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
-        lv_label_set_text_fmt(mem_label,
-                              "%"LV_PRIu32 ".%"LV_PRIu32 " kB used (%d %%)\n"
-                              "%d%% frag.",
-                              used_kb, used_kb_tenth, mon.used_pct,
-                              mon.frag_pct);
+#if LV_USE_PERF_MONITOR
+    if(px_num > 5000) {
+        perf_monitor.elaps_sum += elaps;
+        perf_monitor.frame_cnt ++;
     }
 #endif
 
@@ -473,40 +502,75 @@ uint32_t lv_refr_get_fps_avg(void)
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the invalidated areas where drawing and flushing the joined area is cheaper
+ * than drawing and flushing them separately.
+ * The cost of an area is its size plus `flush_cost` of the display driver.
  */
 static void lv_refr_join_area(void)
 {
+    uint32_t flush_cost = disp_refr->driver->flush_cost;
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    bool joined;
+
+    /*A grown area might be worth joining with an area checked earlier, so repeat until nothing changes*/
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+                /*Without flush cost only areas on each other can be smaller joined*/
+                if(flush_cost == 0 &&
+                   _lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+                    continue;
+                }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two area only if the joined area costs less than the two separately*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) + flush_cost)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
         }
+    } while(joined);
+}
+
+/**
+ * Join an area into the saved invalidated area which grows the least by it.
+ * Used when there is no more place in `inv_areas`, instead of redrawing the whole screen.
+ * @param disp pointer to display
+ * @param area_p the area to join
+ */
+static void inv_area_join_cheapest(lv_disp_t * disp, const lv_area_t * area_p)
+{
+    uint32_t best_i = 0;
+    uint32_t best_growth = UINT32_MAX;
+    lv_area_t joined_area;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        _lv_area_join(&joined_area, &disp->inv_areas[i], area_p);
+        uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+        if(growth < best_growth) {
+            best_growth = growth;
+            best_i = i;
+        }
     }
+
+    _lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area_p);
 }
 
 /**
@@ -581,6 +645,77 @@ static void refr_sync_areas(void)
     _lv_ll_clear(&disp_refr->sync_areas);
 }
 
+/**
+ * Move the pixels of the scrolled area. In direct mode copy them in the buffer, else let the driver move them.
+ */
+static void refr_scroll_area(void)
+{
+    lv_coord_t dy = disp_refr->scroll_dy;
+    if(dy == 0) return;
+
+    lv_area_t area = disp_refr->scroll_area;
+    disp_refr->scroll_dy = 0;
+
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+
+    /*The pixels on the display shouldn't change while they are moved*/
+    while(draw_buf->flushing) {
+        if(drv->wait_cb) drv->wait_cb(drv);
+    }
+
+    if(drv->scroll_cb) {
+        lv_area_t offset_area = area;
+        lv_area_move(&offset_area, drv->offset_x, drv->offset_y);
+        if(!drv->scroll_cb(drv, &offset_area, dy)) _lv_inv_area(disp_refr, &area);
+        return;
+    }
+
+    /*In double buffered direct mode the last frame is in the other buffer*/
+    lv_color_t * buf_dest = draw_buf->buf_act;
+    lv_color_t * buf_src = buf_dest;
+    if(draw_buf->buf2) buf_src = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+
+    lv_coord_t stride = lv_disp_get_hor_res(disp_refr);
+    size_t line_size = lv_area_get_width(&area) * sizeof(lv_color_t);
+
+    /*Go against the direction of the move to not overwrite the lines which are not copied yet*/
+    lv_coord_t y;
+    if(dy > 0) {
+        for(y = area.y2; y >= area.y1 + dy; y--) {
+            lv_memcpy(buf_dest + y * stride + area.x1, buf_src + (y - dy) * stride + area.x1, line_size);
+        }
+    }
+    else {
+        for(y = area.y1; y <= area.y2 + dy; y++) {
+            lv_memcpy(buf_dest + y * stride + area.x1, buf_src + (y - dy) * stride + area.x1, line_size);
+        }
+    }
+
+    /*The other buffer needs the moved pixels too*/
+    if(draw_buf->buf2) {
+        lv_area_t * sync_area = _lv_ll_ins_tail(&disp_refr->sync_areas);
+        if(sync_area) *sync_area = area;
+    }
+}
+
+/**
+ * Tell the latency to the input devices whose changes were refreshed now
+ */
+static void refr_report_latency(void)
+{
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+    while(indev) {
+        if(indev->proc.latency_pending && indev->driver->disp == disp_refr) {
+            indev->proc.latency_pending = 0;
+            if(indev->driver->latency_cb) {
+                indev->driver->latency_cb(indev->driver, lv_tick_elaps(indev->proc.input_timestamp));
+            }
+        }
+        indev = lv_indev_get_next(indev);
+    }
+}
+
 /**
  * Refresh the joined areas
  */
@@ -699,6 +834,9 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
 
+    /*The temporal buffers used while drawing this part are given back at once at the end*/
+    lv_mem_buf_mark_t buf_mark = lv_mem_buf_mark();
+
     if(draw_ctx->init_buf)
         draw_ctx->init_buf(draw_ctx);
 
@@ -796,6 +934,8 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
 
     draw_buf_flush(disp_refr);
+
+    lv_mem_buf_release_to(buf_mark);
 }
 
 /**
@@ -816,8 +956,11 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     lv_cover_check_info_t info;
     info.res = LV_COVER_RES_COVER;
     info.area = area_p;
-    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
-    if(info.res == LV_COVER_RES_MASKED) return NULL;
+    /*The opaque area is computed once per frame, so most draw buffer parts don't need a cover check*/
+    if(_lv_area_is_in(area_p, refr_get_opaque_area(obj), 0) == false) {
+        lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+        if(info.res == LV_COVER_RES_MASKED) return NULL;
+    }
 
     int32_t i;
     int32_t child_cnt = lv_obj_get_child_cnt(obj);
@@ -864,6 +1007,8 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
     /*Do until not reach the screen*/
     while(parent != NULL) {
         bool go = false;
+        occluders_t occ;
+        refr_get_occluders(draw_ctx, parent, lv_obj_get_index(border_p) + 2, &occ);
         uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_cnt(parent);
         for(i = 0; i < child_cnt; i++) {
@@ -871,7 +1016,7 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
             if(!go) {
                 if(child == border_p) go = true;
             }
-            else {
+            else if(!refr_obj_is_occluded(draw_ctx, parent, i, &occ)) {
                 /*Refresh the objects*/
                 refr_obj(draw_ctx, child);
             }
@@ -890,6 +1035,128 @@ static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj)
     }
 }
 
+/**
+ * Get the area which is surely covered by an object, using the per frame cover check cache.
+ * Can be used only while refreshing, as the objects might change between frames.
+ * The cover check is sent for the whole object and, if it's rounded, for the object without the corners.
+ * @param obj pointer to an object
+ * @return the opaque area with absolute coordinates. Empty (x1 > x2) if the object doesn't cover anything
+ */
+static const lv_area_t * refr_get_opaque_area(lv_obj_t * obj)
+{
+    /*Colliding objects just replace each other*/
+    uint32_t hash = (uint32_t)((lv_uintptr_t)obj * 2654435761U) >> (32 - COVER_CACHE_BITS);
+    cover_cache_t * entry = &cover_cache[hash];
+    if(entry->obj == obj) return &entry->opaque;
+
+    entry->obj = obj;
+    lv_area_t * opaque = &entry->opaque;
+    lv_area_set(opaque, 0, 0, -1, -1);
+
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return opaque;
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return opaque;
+
+    lv_area_t area = obj->coords;
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &area;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res == LV_COVER_RES_COVER) {
+        *opaque = area;
+        return opaque;
+    }
+    if(info.res == LV_COVER_RES_MASKED) return opaque;
+
+    /*Maybe only the rounded corners are not covered*/
+    lv_coord_t r = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    lv_coord_t short_side = LV_MIN(lv_area_get_width(&area), lv_area_get_height(&area));
+    r = LV_MIN(r, short_side / 2);
+    if(r <= 0 || r * 2 >= short_side) return opaque;
+
+    lv_area_increase(&area, -r, -r);
+    info.res = LV_COVER_RES_COVER;
+    lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res == LV_COVER_RES_COVER) *opaque = area;
+
+    return opaque;
+}
+
+/**
+ * Collect the children which might cover their older siblings on the clip area.
+ * It's done once for the children of a parent so checking a child is not proportional to the number of its siblings.
+ * If there are more than `OCCLUDER_MAX` the largest ones are kept.
+ * @param draw_ctx pointer to the draw context, its `clip_area` is the area to be drawn
+ * @param parent pointer to the parent object
+ * @param start_id index of the first child to consider
+ * @param occ store the occluders here
+ */
+static void refr_get_occluders(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t start_id, occluders_t * occ)
+{
+    occ->cnt = 0;
+    if(!cover_cache_valid || !disp_refr->driver->cull_occluded) return;
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(parent);
+    for(i = start_id; i < child_cnt; i++) {
+        lv_obj_t * child = parent->spec_attr->children[i];
+        /*Don't bother the cache with children which surely don't cover anything here*/
+        if(_lv_area_is_on(draw_ctx->clip_area, &child->coords) == false) continue;
+
+        lv_area_t area;
+        if(!_lv_area_intersect(&area, draw_ctx->clip_area, refr_get_opaque_area(child))) continue;
+
+        uint32_t slot = occ->cnt;
+        if(occ->cnt < OCCLUDER_MAX) {
+            occ->cnt++;
+        }
+        else {
+            /*Replace the smallest one if this is larger*/
+            uint32_t j;
+            slot = 0;
+            for(j = 1; j < OCCLUDER_MAX; j++) {
+                if(lv_area_get_size(&occ->area[j]) < lv_area_get_size(&occ->area[slot])) slot = j;
+            }
+            if(lv_area_get_size(&area) <= lv_area_get_size(&occ->area[slot])) continue;
+        }
+
+        occ->id[slot] = i;
+        occ->area[slot] = area;
+    }
+}
+
+/**
+ * Check if a child doesn't need to be drawn because its younger siblings fully cover it on the clip area
+ * @param draw_ctx pointer to the draw context, its `clip_area` is the area to be drawn
+ * @param parent pointer to the parent object
+ * @param child_id index of the child to check
+ * @param occ the occluders of the children of `parent` collected by `refr_get_occluders()`
+ * @return true: the child and its children can be skipped
+ */
+static bool refr_obj_is_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * parent, uint32_t child_id,
+                                 const occluders_t * occ)
+{
+    if(occ->cnt == 0) return false;
+
+    lv_obj_t * obj = parent->spec_attr->children[child_id];
+
+    /*The object or its children might draw out of its area*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+    if(_lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return false;
+
+    lv_area_t obj_area;
+    lv_obj_get_coords(obj, &obj_area);
+    lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_area, ext_draw_size, ext_draw_size);
+    if(!_lv_area_intersect(&obj_area, draw_ctx->clip_area, &obj_area)) return false;
+
+    /*The occluders are clipped too but `obj_area` is in the clip area*/
+    uint32_t i;
+    for(i = 0; i < occ->cnt; i++) {
+        if(occ->id[i] > child_id && _lv_area_is_in(&obj_area, &occ->area[i], 0)) return true;
+    }
+
+    return false;
+}
 
 static lv_res_t layer_get_area(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj, lv_layer_type_t layer_type,
                                lv_area_t * layer_area_out)
@@ -1327,6 +1594,102 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
     drv->flush_cb(drv, &offset_area, color_p);
 }
 
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+static void monitor_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+
+#if LV_USE_PERF_MONITOR && LV_USE_LABEL
+    lv_obj_t * perf_label = perf_monitor.perf_label;
+    if(perf_label == NULL) {
+        perf_label = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_opa(perf_label, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(perf_label, lv_color_black(), 0);
+        lv_obj_set_style_text_color(perf_label, lv_color_white(), 0);
+        lv_obj_set_style_pad_top(perf_label, 3, 0);
+        lv_obj_set_style_pad_bottom(perf_label, 3, 0);
+        lv_obj_set_style_pad_left(perf_label, 3, 0);
+        lv_obj_set_style_pad_right(perf_label, 3, 0);
+        lv_obj_set_style_text_align(perf_label, LV_TEXT_ALIGN_RIGHT, 0);
+        lv_label_set_text(perf_label, "?");
+        lv_obj_align(perf_label, LV_USE_PERF_MONITOR_POS, 0, 0);
+        perf_monitor.perf_label = perf_label;
+    }
+
+    lv_disp_t * disp = lv_obj_get_disp(perf_label);
+    uint32_t fps_limit;
+    uint32_t fps;
+
+    if(disp->refr_timer) {
+        fps_limit = 1000 / disp->refr_timer->period;
+    }
+    else {
+        fps_limit = 1000 / LV_DISP_DEF_REFR_PERIOD;
+    }
+
+    if(perf_monitor.elaps_sum == 0) {
+        perf_monitor.elaps_sum = 1;
+    }
+    if(perf_monitor.frame_cnt == 0) {
+        fps = fps_limit;
+    }
+    else {
+        fps = (1000 * perf_monitor.frame_cnt) / perf_monitor.elaps_sum;
+    }
+    perf_monitor.elaps_sum = 0;
+    perf_monitor.frame_cnt = 0;
+    if(fps > fps_limit) {
+        fps = fps_limit;
+    }
+
+    perf_monitor.fps_sum_all += fps;
+    perf_monitor.fps_sum_cnt ++;
+    uint32_t cpu = 100 - lv_timer_get_idle();
+    char perf_buf[32];
+    lv_snprintf(perf_buf, sizeof(perf_buf), "%"LV_PRIu32" FPS\n%"LV_PRIu32"%% CPU", fps, cpu);
+    monitor_label_set_text(perf_label, perf_buf);
+#endif
+
+#if LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0 && LV_USE_LABEL
+    lv_obj_t * mem_label = mem_monitor.mem_label;
+    if(mem_label == NULL) {
+        mem_label = lv_label_create(lv_layer_sys());
+        lv_obj_set_style_bg_opa(mem_label, LV_OPA_50, 0);
+        lv_obj_set_style_bg_color(mem_label, lv_color_black(), 0);
+        lv_obj_set_style_text_color(mem_label, lv_color_white(), 0);
+        lv_obj_set_style_pad_top(mem_label, 3, 0);
+        lv_obj_set_style_pad_bottom(mem_label, 3, 0);
+        lv_obj_set_style_pad_left(mem_label, 3, 0);
+        lv_obj_set_style_pad_right(mem_label, 3, 0);
+        lv_label_set_text(mem_label, "?");
+        lv_obj_align(mem_label, LV_USE_MEM_MONITOR_POS, 0, 0);
+        mem_monitor.mem_label = mem_label;
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t used_size = mon.total_size - mon.free_size;;
+    uint32_t used_kb = used_size / 1024;
+    uint32_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
+    char mem_buf[64];
+    lv_snprintf(mem_buf, sizeof(mem_buf),
+                "%"LV_PRIu32 ".%"LV_PRIu32 " kB used (%d %%)\n"
+                "%d%% frag.",
+                used_kb, used_kb_tenth, mon.used_pct,
+                mon.frag_pct);
+    monitor_label_set_text(mem_label, mem_buf);
+#endif
+}
+#endif
+
+#if (LV_USE_PERF_MONITOR || (LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0)) && LV_USE_LABEL
+/*Don't redraw the label if the values are the same*/
+static void monitor_label_set_text(lv_obj_t * label, const char * text)
+{
+    if(strcmp(lv_label_get_text(label), text) != 0) lv_label_set_text(label, text);
+}
+#endif
+
 #if LV_USE_PERF_MONITOR
 static void perf_monitor_init(perf_monitor_t * _perf_monitor)
 {
@@ -1335,7 +1698,6 @@ static void perf_monitor_init(perf_monitor_t * _perf_monitor)
     _perf_monitor->fps_sum_all = 0;
     _perf_monitor->fps_sum_cnt = 0;
     _perf_monitor->frame_cnt = 0;
-    _perf_monitor->perf_last_time = 0;
     _perf_monitor->perf_label = NULL;
 }
 #endif
@@ -1344,7 +1706,6 @@ static void perf_monitor_init(perf_monitor_t * _perf_monitor)
 static void mem_monitor_init(mem_monitor_t * _mem_monitor)
 {
     LV_ASSERT_NULL(_mem_monitor);
-    _mem_monitor->mem_last_time = 0;
     _mem_monitor->mem_label = NULL;
 }
 #endif
@@ -71,6 +71,17 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+/**
+ * Move the pixels of an area vertically in the next refresh instead of redrawing them.
+ * Only the uncovered strip and what was invalidated before are redrawn.
+ * Requires `scroll_copy` in the display driver and only one area can be moved in a refresh.
+ * @param disp      pointer to display where the area is moved (NULL to use the default display)
+ * @param area_p    the area to move. The pixels moved out of it are dropped.
+ * @param dy        move the pixels down by this many pixels (negative: up)
+ * @return          true: the move is scheduled; false: not possible, the area should be invalidated
+ */
+bool _lv_inv_scroll(lv_disp_t * disp, const lv_area_t * area_p, lv_coord_t dy);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
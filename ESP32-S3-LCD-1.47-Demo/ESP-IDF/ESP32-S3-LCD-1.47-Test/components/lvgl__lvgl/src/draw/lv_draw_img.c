@@ -329,9 +329,10 @@ static lv_res_t LV_ATTRIBUTE_FAST_MEM decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
             read_res = lv_img_decoder_read_line(&cdsc->dec_dsc, x, y, width, buf);
             if(read_res != LV_RES_OK) {
-                lv_img_decoder_close(&cdsc->dec_dsc);
                 LV_LOG_WARN("Image draw can't read the line");
                 lv_mem_buf_release(buf);
+                /*Don't use the broken entry again. It's closed when it's released.*/
+                lv_img_cache_invalidate_src(src);
                 draw_cleanup(cdsc);
                 draw_ctx->clip_area = clip_area_ori;
                 return LV_RES_INV;
@@ -366,10 +367,5 @@ static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const
 
 static void draw_cleanup(_lv_img_cache_entry_t * cache)
 {
-    /*Automatically close images with no caching*/
-#if LV_IMG_CACHE_DEF_SIZE == 0
-    lv_img_decoder_close(&cache->dec_dsc);
-#else
-    LV_UNUSED(cache);
-#endif
+    _lv_img_cache_close(cache);
 }
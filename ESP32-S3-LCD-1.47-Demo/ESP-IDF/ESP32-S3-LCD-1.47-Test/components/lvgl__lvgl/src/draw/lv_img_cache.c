@@ -16,33 +16,33 @@
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
-
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_CACHE_DEF_SIZE
+/*The beginning of the key. The pointer of the variable or the path of the file follows it.*/
+typedef struct {
+    uint32_t color;
+    int32_t frame_id;
+    uint32_t src_type;
+} img_cache_key_head_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint8_t * get_key(const void * src, lv_color_t color, int32_t frame_id, size_t * key_size);
+    static size_t get_entry_size(const _lv_img_cache_entry_t * entry);
+    static bool entry_match_src(const void * key, size_t key_length, void * value, void * user_data);
+    static void entry_free(void * entry);
 #endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-#if LV_IMG_CACHE_DEF_SIZE
-    static uint16_t entry_cnt;
-#endif
 
 /**********************
  *      MACROS
@@ -55,7 +55,7 @@
 /**
  * Open an image using the image decoder interface and cache it.
  * The image will be left open meaning if the image decoder open callback allocated memory then it will remain.
- * The image is closed if a new image is opened and the new image takes its place in the cache.
+ * The entry is pinned until `_lv_img_cache_close()`, after that it can be closed to make room for other images.
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @return pointer to the cache entry or NULL if can open the image
@@ -66,55 +66,26 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     _lv_img_cache_entry_t * cached_src = NULL;
 
 #if LV_IMG_CACHE_DEF_SIZE
-    if(entry_cnt == 0) {
-        LV_LOG_WARN("lv_img_cache_open: the cache size is 0");
-        return NULL;
-    }
-
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
-
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
-           frame_id == cache[i].dec_dsc.frame_id &&
-           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
+    lv_lru_t * lru = LV_GC_ROOT(_lv_img_cache_lru);
+    uint8_t * key = NULL;
+    size_t key_size = 0;
+    if(lru) {
+        key = get_key(src, color, frame_id, &key_size);
+        lv_lru_item_t * item = lv_lru_pin(lru, key, key_size);
+        if(item) {
+            lv_mem_buf_release(key);
             LV_LOG_TRACE("image source found in the cache");
-            break;
-        }
-    }
-
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
-
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
+            return lv_lru_item_get_value(item);
         }
     }
 
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
-    }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+    cached_src = lv_mem_alloc(sizeof(_lv_img_cache_entry_t));
+    LV_ASSERT_MALLOC(cached_src);
+    if(cached_src == NULL) {
+        if(key) lv_mem_buf_release(key);
+        return NULL;
     }
+    lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
 #else
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
 #endif
@@ -123,13 +94,15 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
+#if LV_IMG_CACHE_DEF_SIZE
+        lv_mem_free(cached_src);
+        if(key) lv_mem_buf_release(key);
+#else
         lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
+#endif
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -137,9 +110,35 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    /*Cache it pinned. If it can't be cached (e.g. the budget is used by pinned entries)
+     *it's closed by `_lv_img_cache_close`*/
+    if(key) {
+        if(lv_lru_set_pinned(lru, key, key_size, cached_src, get_entry_size(cached_src),
+                             &cached_src->lru_item) == LV_LRU_OK) {
+            LV_LOG_INFO("image draw: cache miss, cached the image");
+        }
+        else {
+            LV_LOG_INFO("image draw: cache miss, can't cache the image");
+        }
+        lv_mem_buf_release(key);
+    }
+#endif
+
     return cached_src;
 }
 
+void _lv_img_cache_close(_lv_img_cache_entry_t * entry)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    if(entry->lru_item) lv_lru_unpin(LV_GC_ROOT(_lv_img_cache_lru), entry->lru_item);
+    else entry_free(entry);
+#else
+    /*Automatically close images with no caching*/
+    lv_img_decoder_close(&entry->dec_dsc);
+#endif
+}
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -152,23 +151,24 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
     LV_UNUSED(new_entry_cnt);
     LV_LOG_WARN("Can't change cache size because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
 #else
-    if(LV_GC_ROOT(_lv_img_cache_array) != NULL) {
-        /*Clean the cache before free it*/
-        lv_img_cache_invalidate_src(NULL);
-        lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
+    lv_lru_t * lru = LV_GC_ROOT(_lv_img_cache_lru);
+    if(new_entry_cnt == 0) {
+        /*Close all the images and disable the caching*/
+        if(lru) lv_lru_del(lru);
+        LV_GC_ROOT(_lv_img_cache_lru) = NULL;
+        return;
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
-    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
-    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
-        entry_cnt = 0;
-        return;
+    if(lru == NULL) {
+        /*The number of entries is limited, not their size. It can be limited by a budget too.
+         *The average length is chosen to get about `new_entry_cnt` slots in the hash table.*/
+        lru = lv_lru_create(SIZE_MAX, SIZE_MAX / new_entry_cnt, entry_free, NULL);
+        LV_ASSERT_MALLOC(lru);
+        if(lru == NULL) return;
+        LV_GC_ROOT(_lv_img_cache_lru) = lru;
     }
-    entry_cnt = new_entry_cnt;
 
-    /*Clean the cache*/
-    lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    lv_lru_set_max_item_cnt(lru, new_entry_cnt);
 #endif
 }
 
@@ -181,18 +181,20 @@ void lv_img_cache_invalidate_src(const void * src)
 {
     LV_UNUSED(src);
 #if LV_IMG_CACHE_DEF_SIZE
-    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    lv_lru_t * lru = LV_GC_ROOT(_lv_img_cache_lru);
+    if(lru == NULL) return;
 
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
+    /*The pinned entries are closed when they are released*/
+    lv_lru_remove_all(lru, src ? entry_match_src : NULL, (void *)src);
+#endif
+}
 
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
-        }
-    }
+lv_lru_t * lv_img_cache_get_lru(void)
+{
+#if LV_IMG_CACHE_DEF_SIZE
+    return LV_GC_ROOT(_lv_img_cache_lru);
+#else
+    return NULL;
 #endif
 }
 
@@ -212,4 +214,66 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * Create the key of an image: the opening parameters and the pointer of a variable or the path of a file
+ * @param src       the image source
+ * @param color     the color of `LV_IMG_CF_ALPHA_...` images
+ * @param frame_id  the index of the frame
+ * @param key_size  store the size of the key here
+ * @return          the key from `lv_mem_buf_get`. Release it with `lv_mem_buf_release`.
+ */
+static uint8_t * get_key(const void * src, lv_color_t color, int32_t frame_id, size_t * key_size)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    bool is_path = src_type == LV_IMG_SRC_FILE || src_type == LV_IMG_SRC_SYMBOL;
+    size_t src_size = is_path ? strlen(src) : sizeof(src);
+
+    *key_size = sizeof(img_cache_key_head_t) + src_size;
+    uint8_t * key = lv_mem_buf_get(*key_size);
+    if(key == NULL) return NULL;
+
+    img_cache_key_head_t head;
+    head.color = color.full;
+    head.frame_id = frame_id;
+    head.src_type = src_type;
+    lv_memcpy(key, &head, sizeof(head));
+    lv_memcpy(key + sizeof(head), is_path ? src : (const void *)&src, src_size);
+
+    return key;
+}
+
+/**
+ * Get the memory used by an entry. The decoded image counts only if the decoder allocated it,
+ * i.e. not for variables and mapped files.
+ * @param entry     pointer to an opened entry
+ * @return          size in bytes
+ */
+static size_t get_entry_size(const _lv_img_cache_entry_t * entry)
+{
+    const lv_img_decoder_dsc_t * dec_dsc = &entry->dec_dsc;
+    size_t size = sizeof(_lv_img_cache_entry_t);
+    if(dec_dsc->img_data == NULL) return size;
+    if(dec_dsc->src_type == LV_IMG_SRC_VARIABLE && dec_dsc->img_data == ((const lv_img_dsc_t *)dec_dsc->src)->data) {
+        return size;
+    }
+
+    if(_lv_img_decoder_built_in_is_mapped(dec_dsc)) return size;
+
+    return size + lv_img_buf_get_img_size(dec_dsc->header.w, dec_dsc->header.h, dec_dsc->header.cf);
+}
+
+static bool entry_match_src(const void * key, size_t key_length, void * value, void * user_data)
+{
+    LV_UNUSED(key);
+    LV_UNUSED(key_length);
+    _lv_img_cache_entry_t * entry = value;
+    return lv_img_cache_match(user_data, entry->dec_dsc.src);
+}
+
+static void entry_free(void * entry)
+{
+    lv_img_decoder_close(&((_lv_img_cache_entry_t *)entry)->dec_dsc);
+    lv_mem_free(entry);
+}
 #endif
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "lv_img_decoder.h"
+#include "../misc/lv_lru.h"
 
 /*********************
  *      DEFINES
@@ -31,10 +32,9 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    /** The item in the cache. The least recently used not pinned entry is closed if the cache is full.
+     * NULL if the entry is not cached.*/
+    lv_lru_item_t * lru_item;
 } _lv_img_cache_entry_t;
 
 /**********************
@@ -44,7 +44,7 @@ typedef struct {
 /**
  * Open an image using the image decoder interface and cache it.
  * The image will be left open meaning if the image decoder open callback allocated memory then it will remain.
- * The image is closed if a new image is opened and the new image takes its place in the cache.
+ * The entry is pinned until `_lv_img_cache_close()`, after that it can be closed to make room for other images.
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
@@ -52,6 +52,12 @@ typedef struct {
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Release an entry opened by `_lv_img_cache_open()`. If the entry is not cached the image is closed.
+ * @param entry pointer to a cache entry. It can't be used after this call.
+ */
+void _lv_img_cache_close(_lv_img_cache_entry_t * entry);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -67,6 +73,12 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Get the image cache, e.g. to share a memory budget with other caches by `lv_lru_set_budget()`
+ * @return the cache or NULL if the caching is disabled
+ */
+lv_lru_t * lv_img_cache_get_lru(void);
+
 /**********************
  *      MACROS
  **********************/
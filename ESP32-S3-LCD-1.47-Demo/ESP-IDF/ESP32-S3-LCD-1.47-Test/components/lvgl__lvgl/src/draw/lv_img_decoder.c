@@ -9,7 +9,6 @@
 #include "lv_img_decoder.h"
 #include "../misc/lv_assert.h"
 #include "../draw/lv_draw_img.h"
-#include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
 
 /*********************
@@ -37,6 +36,7 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
                                                    lv_coord_t len, uint8_t * buf);
 static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                      lv_coord_t len, uint8_t * buf);
+static const uint8_t * map_img_data(lv_img_decoder_dsc_t * dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -55,7 +55,8 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
  */
 void _lv_img_decoder_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_img_decoder_ll), sizeof(lv_img_decoder_t));
+    _lv_img_decoder_list_t * list = &LV_GC_ROOT(_lv_img_decoder_list);
+    _lv_svec_init(&list->vec, sizeof(lv_img_decoder_t *), list->local, _LV_IMG_DECODER_LOCAL_CNT);
 
     lv_img_decoder_t * decoder;
 
@@ -93,8 +94,10 @@ lv_res_t lv_img_decoder_get_info(const void * src, lv_img_header_t * header)
     }
 
     lv_res_t res = LV_RES_INV;
-    lv_img_decoder_t * d;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), d) {
+    const lv_svec_t * vec = &LV_GC_ROOT(_lv_img_decoder_list).vec;
+    uint32_t i;
+    for(i = 0; i < _lv_svec_get_cnt(vec); i++) {
+        lv_img_decoder_t * d = *(lv_img_decoder_t **)_lv_svec_get(vec, i);
         if(d->info_cb) {
             res = d->info_cb(d, src, header);
             if(res == LV_RES_OK) break;
@@ -135,8 +138,10 @@ lv_res_t lv_img_decoder_open(lv_img_decoder_dsc_t * dsc, const void * src, lv_co
 
     lv_res_t res = LV_RES_INV;
 
-    lv_img_decoder_t * decoder;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_img_decoder_ll), decoder) {
+    const lv_svec_t * vec = &LV_GC_ROOT(_lv_img_decoder_list).vec;
+    uint32_t i;
+    for(i = 0; i < _lv_svec_get_cnt(vec); i++) {
+        lv_img_decoder_t * decoder = *(lv_img_decoder_t **)_lv_svec_get(vec, i);
         /*Info and Open callbacks are required*/
         if(decoder->info_cb == NULL || decoder->open_cb == NULL) continue;
 
@@ -204,10 +209,18 @@ void lv_img_decoder_close(lv_img_decoder_dsc_t * dsc)
 lv_img_decoder_t * lv_img_decoder_create(void)
 {
     lv_img_decoder_t * decoder;
-    decoder = _lv_ll_ins_head(&LV_GC_ROOT(_lv_img_decoder_ll));
+    decoder = lv_mem_alloc(sizeof(lv_img_decoder_t));
     LV_ASSERT_MALLOC(decoder);
     if(decoder == NULL) return NULL;
 
+    /*The last created decoder is tried first*/
+    lv_img_decoder_t ** slot = _lv_svec_ins(&LV_GC_ROOT(_lv_img_decoder_list).vec, 0);
+    if(slot == NULL) {
+        lv_mem_free(decoder);
+        return NULL;
+    }
+    *slot = decoder;
+
     lv_memset_00(decoder, sizeof(lv_img_decoder_t));
 
     return decoder;
@@ -219,7 +232,9 @@ lv_img_decoder_t * lv_img_decoder_create(void)
  */
 void lv_img_decoder_delete(lv_img_decoder_t * decoder)
 {
-    _lv_ll_remove(&LV_GC_ROOT(_lv_img_decoder_ll), decoder);
+    lv_svec_t * vec = &LV_GC_ROOT(_lv_img_decoder_list).vec;
+    int32_t i = _lv_svec_find(vec, &decoder);
+    if(i >= 0) _lv_svec_remove(vec, (uint32_t)i);
     lv_mem_free(decoder);
 }
 
@@ -369,6 +384,10 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
             return LV_RES_OK;
         }
         else {
+            /*Use the pixels in place if the file can be mapped*/
+            dsc->img_data = map_img_data(dsc);
+            if(dsc->img_data) return LV_RES_OK;
+
             /*If it's a file, read all to memory*/
             uint32_t len = dsc->header.w * dsc->header.h;
             len *= cf == LV_IMG_CF_RGB565A8 ? 3 : 1;
@@ -396,7 +415,8 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
             return LV_RES_OK;
         }
         else {
-            /*If it's a file it need to be read line by line later*/
+            /*Use the pixels in place if the file can be mapped, else read them line by line later*/
+            dsc->img_data = map_img_data(dsc);
             return LV_RES_OK;
         }
     }
@@ -513,6 +533,15 @@ lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_de
  * @param decoder pointer to the decoder the function associated with
  * @param dsc pointer to decoder descriptor
  */
+bool _lv_img_decoder_built_in_is_mapped(const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->src_type != LV_IMG_SRC_FILE || dsc->img_data == NULL || dsc->decoder == NULL) return false;
+    if(dsc->decoder->open_cb != lv_img_decoder_built_in_open) return false;
+
+    const lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    return user_data && user_data->f.map && dsc->img_data == (const uint8_t *)user_data->f.map + 4;
+}
+
 void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
 {
     LV_UNUSED(decoder); /*Unused*/
@@ -534,6 +563,24 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the pixels of an opened image file in place if its driver can map it to the memory
+ * @param dsc   pointer to a decoder descriptor with an opened file
+ * @return      pointer to the pixels (after the header) or NULL if the file can't be mapped or it's too short
+ */
+static const uint8_t * map_img_data(lv_img_decoder_dsc_t * dsc)
+{
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    uint32_t size;
+    const uint8_t * map = lv_fs_mmap(&user_data->f, &size);
+    if(map == NULL) return NULL;
+
+    uint32_t len = lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+    if(size < len + 4) return NULL;
+
+    return map + 4; /*Skip the header*/
+}
+
 static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
                                                         lv_coord_t len, uint8_t * buf)
 {
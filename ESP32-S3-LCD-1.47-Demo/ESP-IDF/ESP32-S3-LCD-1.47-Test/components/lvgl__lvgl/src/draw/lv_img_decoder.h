@@ -20,10 +20,12 @@ extern "C" {
 #include "../misc/lv_fs.h"
 #include "../misc/lv_types.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_svec.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define _LV_IMG_DECODER_LOCAL_CNT 8  /*Number of decoders stored without heap allocation in the decoder list*/
 
 /**********************
  *      TYPEDEFS
@@ -131,6 +133,15 @@ typedef struct _lv_img_decoder_dsc_t {
     void * user_data;
 } lv_img_decoder_dsc_t;
 
+/**
+ * The created image decoders in a contiguous array, the last created first.
+ * Internally used by the library, you should not need to touch it.
+ */
+typedef struct {
+    lv_svec_t vec;                                          /**< Pointers to the decoders*/
+    lv_img_decoder_t * local[_LV_IMG_DECODER_LOCAL_CNT];    /**< Storage of `vec` for the first decoders*/
+} _lv_img_decoder_list_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -263,6 +274,13 @@ lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_de
  */
 void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
 
+/**
+ * Tell if the built-in decoder uses the pixels of a file in place because its driver mapped it to the memory
+ * @param dsc pointer to an opened decoder descriptor
+ * @return true: `img_data` points into the mapped file and doesn't use RAM
+ */
+bool _lv_img_decoder_built_in_is_mapped(const lv_img_decoder_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
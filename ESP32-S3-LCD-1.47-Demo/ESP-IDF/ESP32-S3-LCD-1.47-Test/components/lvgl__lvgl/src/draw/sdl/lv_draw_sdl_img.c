@@ -219,13 +219,11 @@ bool lv_draw_sdl_img_load_texture(lv_draw_sdl_ctx_t * ctx, lv_draw_sdl_cache_key
         else {
             *texture = upload_img_texture(ctx->renderer, dsc);
         }
-#if LV_IMG_CACHE_DEF_SIZE == 0
-        lv_img_decoder_close(dsc);
-#endif
     }
     if(texture && cdsc) {
         *header = lv_mem_alloc(sizeof(lv_draw_sdl_img_header_t));
         SDL_memcpy(&(*header)->base, &cdsc->dec_dsc.header, sizeof(lv_img_header_t));
+        _lv_img_cache_close(cdsc);
         (*header)->rect = rect;
         (*header)->managed = (tex_flags & LV_DRAW_SDL_CACHE_FLAG_MANAGED) != 0;
         *texture_in_cache = lv_draw_sdl_texture_cache_put_advanced(ctx, key, key_size, *texture, *header, SDL_free,
@@ -233,6 +231,7 @@ bool lv_draw_sdl_img_load_texture(lv_draw_sdl_ctx_t * ctx, lv_draw_sdl_cache_key
         return true;
     }
     else {
+        if(cdsc) _lv_img_cache_close(cdsc);
         *texture_in_cache = lv_draw_sdl_texture_cache_put(ctx, key, key_size, NULL);
         return false;
     }
@@ -6,6 +6,7 @@ CSRCS += lv_draw_sw_gradient.c
 CSRCS += lv_draw_sw_img.c
 CSRCS += lv_draw_sw_letter.c
 CSRCS += lv_draw_sw_line.c
+CSRCS += lv_draw_sw_parallel.c
 CSRCS += lv_draw_sw_polygon.c
 CSRCS += lv_draw_sw_rect.c
 CSRCS += lv_draw_sw_transform.c
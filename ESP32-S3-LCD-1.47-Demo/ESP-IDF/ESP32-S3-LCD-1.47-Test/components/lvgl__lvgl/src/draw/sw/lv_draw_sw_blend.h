@@ -59,6 +59,29 @@ void lv_draw_sw_blend(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_d
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_basic(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_sw_blend_dsc_t * dsc);
 
+#if LV_USE_DRAW_SW_PARALLEL
+/**
+ * Start the worker threads of `lv_draw_sw_blend_parallel()`.
+ * Can be called multiple times, the workers are stopped by the last `_lv_draw_sw_parallel_deinit()` call.
+ */
+void _lv_draw_sw_parallel_init(void);
+
+/**
+ * Stop the worker threads of `lv_draw_sw_blend_parallel()` if it's the last user.
+ */
+void _lv_draw_sw_parallel_deinit(void);
+
+/**
+ * Blend function which splits big areas into horizontal bands and blends them with
+ * `lv_draw_sw_blend_basic()` on the worker threads and on the calling thread.
+ * Blends smaller than `LV_DRAW_SW_PARALLEL_MIN_PX` are blended on the calling thread only.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           pointer to an initialized blend descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_parallel(struct _lv_draw_ctx_t * draw_ctx,
+                                                           const lv_draw_sw_blend_dsc_t * dsc);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -28,45 +28,56 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+/*Used only to size the hash table of the cache initially*/
+#define GRAD_AVG_ITEM_SIZE  (ALIGN(sizeof(lv_grad_t)) + ALIGN(64 * sizeof(lv_grad_color_t)))
+
 #if LV_GRAD_CACHE_DEF_SIZE != 0 && LV_GRAD_CACHE_DEF_SIZE < 256
     #error "LV_GRAD_CACHE_DEF_SIZE is too small"
 #endif
 
 /**********************
- *  STATIC PROTOTYPES
+ *      TYPEDEFS
  **********************/
-static lv_grad_t * next_in_cache(lv_grad_t * item);
+/*The content of the gradient used as the cache key. Unused bytes are 0 to compare it with memcmp*/
+typedef struct {
+    lv_gradient_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    lv_coord_t size;
+    lv_coord_t w;
+    uint8_t stops_count;
+    uint8_t dir;
+    uint8_t dither;
+} grad_key_t;
 
-typedef lv_res_t (*op_cache_t)(lv_grad_t * c, void * ctx);
-static lv_res_t iterate_cache(op_cache_t func, void * ctx, lv_grad_t ** out);
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
 static size_t get_cache_item_size(lv_grad_t * c);
 static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
-static lv_res_t find_oldest_item_life(lv_grad_t * c, void * ctx);
-static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx);
-static lv_res_t find_item(lv_grad_t * c, void * ctx);
-static void free_item(lv_grad_t * c);
-static  uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h);
+static void compute_key(grad_key_t * key, const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w);
 
 
 /**********************
  *   STATIC VARIABLE
  **********************/
 static size_t    grad_cache_size = 0;
-static uint8_t * grad_cache_end = 0;
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-union void_cast {
-    const void * ptr;
-    const uint32_t value;
-};
-
-static uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w)
+static void compute_key(grad_key_t * key, const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w)
 {
-    union void_cast v;
-    v.ptr = g;
-    return (v.value ^ size ^ (w >> 1)); /*Yes, this is correct, it's like a hash that changes if the width changes*/
+    /*Set the fields one by one to keep the padding 0*/
+    lv_memset_00(key, sizeof(grad_key_t));
+    uint8_t i;
+    for(i = 0; i < g->stops_count; i++) {
+        key->stops[i].color = g->stops[i].color;
+        key->stops[i].frac = g->stops[i].frac;
+    }
+    key->stops_count = g->stops_count;
+    key->dir = g->dir;
+    key->dither = g->dither;
+    key->size = size;
+    key->w = w;
 }
 
 static size_t get_cache_item_size(lv_grad_t * c)
@@ -81,80 +92,6 @@ static size_t get_cache_item_size(lv_grad_t * c)
     return s;
 }
 
-static lv_grad_t * next_in_cache(lv_grad_t * item)
-{
-    if(grad_cache_size == 0) return NULL;
-
-    if(item == NULL)
-        return (lv_grad_t *)LV_GC_ROOT(_lv_grad_cache_mem);
-
-    size_t s = get_cache_item_size(item);
-    /*Compute the size for this cache item*/
-    if((uint8_t *)item + s >= grad_cache_end) return NULL;
-    else return (lv_grad_t *)((uint8_t *)item + s);
-}
-
-static lv_res_t iterate_cache(op_cache_t func, void * ctx, lv_grad_t ** out)
-{
-    lv_grad_t * first = next_in_cache(NULL);
-    while(first != NULL && first->life) {
-        if((*func)(first, ctx) == LV_RES_OK) {
-            if(out != NULL) *out = first;
-            return LV_RES_OK;
-        }
-        first = next_in_cache(first);
-    }
-    return LV_RES_INV;
-}
-
-static lv_res_t find_oldest_item_life(lv_grad_t * c, void * ctx)
-{
-    uint32_t * min_life = (uint32_t *)ctx;
-    if(c->life < *min_life) *min_life = c->life;
-    return LV_RES_INV;
-}
-
-static void free_item(lv_grad_t * c)
-{
-    size_t size = get_cache_item_size(c);
-    size_t next_items_size = (size_t)(grad_cache_end - (uint8_t *)c) - size;
-    grad_cache_end -= size;
-    if(next_items_size) {
-        uint8_t * old = (uint8_t *)c;
-        lv_memcpy(c, ((uint8_t *)c) + size, next_items_size);
-        /* Then need to fix all internal pointers too */
-        while((uint8_t *)c != grad_cache_end) {
-            c->map = (lv_color_t *)(((uint8_t *)c->map) - size);
-#if _DITHER_GRADIENT
-            c->hmap = (lv_color32_t *)(((uint8_t *)c->hmap) - size);
-#if LV_DITHER_ERROR_DIFFUSION == 1
-            c->error_acc = (lv_scolor24_t *)(((uint8_t *)c->error_acc) - size);
-#endif
-#endif
-            c = (lv_grad_t *)(((uint8_t *)c) + get_cache_item_size(c));
-        }
-        lv_memset_00(old + next_items_size, size);
-    }
-}
-
-static lv_res_t kill_oldest_item(lv_grad_t * c, void * ctx)
-{
-    uint32_t * min_life = (uint32_t *)ctx;
-    if(c->life == *min_life) {
-        /*Found, let's kill it*/
-        free_item(c);
-        return LV_RES_OK;
-    }
-    return LV_RES_INV;
-}
-
-static lv_res_t find_item(lv_grad_t * c, void * ctx)
-{
-    uint32_t * k = (uint32_t *)ctx;
-    if(c->key == *k) return LV_RES_OK;
-    return LV_RES_INV;
-}
-
 static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
 {
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
@@ -169,62 +106,26 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
 #endif
 #endif
 
-    size_t act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
-    lv_grad_t * item = NULL;
-    if(req_size + act_size < grad_cache_size) {
-        item = (lv_grad_t *)grad_cache_end;
-        item->not_cached = 0;
-    }
-    else {
-        /*Need to evict items from cache until we find enough space to allocate this one */
-        if(req_size <= grad_cache_size) {
-            while(act_size + req_size > grad_cache_size) {
-                uint32_t oldest_life = UINT32_MAX;
-                iterate_cache(&find_oldest_item_life, &oldest_life, NULL);
-                iterate_cache(&kill_oldest_item, &oldest_life, NULL);
-                act_size = (size_t)(grad_cache_end - LV_GC_ROOT(_lv_grad_cache_mem));
-            }
-            item = (lv_grad_t *)grad_cache_end;
-            item->not_cached = 0;
-        }
-        else {
-            /*The cache is too small. Allocate the item manually and free it later.*/
-            item = lv_mem_alloc(req_size);
-            LV_ASSERT_MALLOC(item);
-            if(item == NULL) return NULL;
-            item->not_cached = 1;
-        }
-    }
+    /*The item is handed over to the cache only when it's filled*/
+    lv_grad_t * item = lv_mem_alloc(req_size);
+    LV_ASSERT_MALLOC(item);
+    if(item == NULL) return NULL;
 
-    item->key = compute_key(g, size, w);
-    item->life = 1;
+    item->lru_item = NULL;
+    item->not_cached = 1;
     item->filled = 0;
     item->alloc_size = map_size;
     item->size = size;
-    if(item->not_cached) {
-        uint8_t * p = (uint8_t *)item;
-        item->map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
+    uint8_t * p = (uint8_t *)item;
+    item->map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
 #if _DITHER_GRADIENT
-        item->hmap = (lv_color32_t *)(p + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
+    item->hmap = (lv_color32_t *)(p + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
 #if LV_DITHER_ERROR_DIFFUSION == 1
-        item->error_acc = (lv_scolor24_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
-                                            ALIGN(map_size * sizeof(lv_color_t)));
-        item->w = w;
+    item->error_acc = (lv_scolor24_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
+                                        ALIGN(map_size * sizeof(lv_color_t)));
+    item->w = w;
 #endif
 #endif
-    }
-    else {
-        item->map = (lv_color_t *)(grad_cache_end + ALIGN(sizeof(*item)));
-#if _DITHER_GRADIENT
-        item->hmap = (lv_color32_t *)(grad_cache_end + ALIGN(sizeof(*item)) + ALIGN(map_size * sizeof(lv_color_t)));
-#if LV_DITHER_ERROR_DIFFUSION == 1
-        item->error_acc = (lv_scolor24_t *)(grad_cache_end + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_grad_color_t)) +
-                                            ALIGN(map_size * sizeof(lv_color_t)));
-        item->w = w;
-#endif
-#endif
-        grad_cache_end += req_size;
-    }
     return item;
 }
 
@@ -234,20 +135,31 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord
  **********************/
 void lv_gradient_free_cache(void)
 {
-    lv_mem_free(LV_GC_ROOT(_lv_grad_cache_mem));
-    LV_GC_ROOT(_lv_grad_cache_mem) = grad_cache_end = NULL;
+    if(LV_GC_ROOT(_lv_grad_cache_lru)) lv_lru_del(LV_GC_ROOT(_lv_grad_cache_lru));
+    LV_GC_ROOT(_lv_grad_cache_lru) = NULL;
     grad_cache_size = 0;
 }
 
 void lv_gradient_set_cache_size(size_t max_bytes)
 {
-    lv_mem_free(LV_GC_ROOT(_lv_grad_cache_mem));
-    grad_cache_end = LV_GC_ROOT(_lv_grad_cache_mem) = lv_mem_alloc(max_bytes);
-    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_grad_cache_mem));
-    lv_memset_00(LV_GC_ROOT(_lv_grad_cache_mem), max_bytes);
+    lv_lru_budget_t * budget = NULL;
+    if(LV_GC_ROOT(_lv_grad_cache_lru)) budget = LV_GC_ROOT(_lv_grad_cache_lru)->budget;
+    lv_gradient_free_cache();
+    if(max_bytes == 0) return;
+
+    LV_GC_ROOT(_lv_grad_cache_lru) = lv_lru_create(max_bytes, GRAD_AVG_ITEM_SIZE, NULL, NULL);
+    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_grad_cache_lru));
+    if(LV_GC_ROOT(_lv_grad_cache_lru) == NULL) return;
+
+    if(budget) lv_lru_set_budget(LV_GC_ROOT(_lv_grad_cache_lru), budget);
     grad_cache_size = max_bytes;
 }
 
+lv_lru_t * lv_gradient_get_cache(void)
+{
+    return LV_GC_ROOT(_lv_grad_cache_lru);
+}
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
 {
     /* No gradient, no cache */
@@ -260,13 +172,15 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
         inited = true;
     }
 
-    /* Step 1: Search cache for the given key */
+    /* Step 1: Search cache for the given gradient. It's pinned until `lv_gradient_cleanup`*/
     lv_coord_t size = g->dir == LV_GRAD_DIR_HOR ? w : h;
-    uint32_t key = compute_key(g, size, w);
+    grad_key_t key;
+    compute_key(&key, g, size, w);
+    lv_lru_t * lru = LV_GC_ROOT(_lv_grad_cache_lru);
     lv_grad_t * item = NULL;
-    if(iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
-        item->life++; /* Don't forget to bump the counter */
-        return item;
+    if(lru) {
+        lv_lru_item_t * lru_item = lv_lru_pin(lru, &key, sizeof(key));
+        if(lru_item) return lv_lru_item_get_value(lru_item);
     }
 
     /* Step 2: Need to allocate an item for it */
@@ -290,6 +204,15 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     }
 #endif
 
+    /* Step 4: Cache it. If the cache is too small it's freed in `lv_gradient_cleanup`*/
+    if(lru) {
+        lv_lru_item_t * lru_item;
+        if(lv_lru_set_pinned(lru, &key, sizeof(key), item, get_cache_item_size(item), &lru_item) == LV_LRU_OK) {
+            item->lru_item = lru_item;
+            item->not_cached = 0;
+        }
+    }
+
     return item;
 }
 
@@ -343,4 +266,7 @@ void lv_gradient_cleanup(lv_grad_t * grad)
     if(grad->not_cached) {
         lv_mem_free(grad);
     }
+    else {
+        lv_lru_unpin(LV_GC_ROOT(_lv_grad_cache_lru), grad->lru_item);
+    }
 }
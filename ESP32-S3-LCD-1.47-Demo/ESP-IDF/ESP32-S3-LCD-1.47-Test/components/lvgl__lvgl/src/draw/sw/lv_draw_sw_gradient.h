@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_style.h"
+#include "../../misc/lv_lru.h"
 #include "lv_draw_sw_dither.h"
 
 /*********************
@@ -38,10 +39,7 @@ typedef lv_color_t lv_grad_color_t;
  *  it's possible to cache the computation in this structure instance.
  *  Whenever possible, this structure is reused instead of recomputing the gradient map */
 typedef struct _lv_gradient_cache_t {
-    uint32_t        key;          /**< A discriminating key that's built from the drawing operation.
-                                   * If the key does not match, the cache item is not used */
-    uint32_t        life : 30;    /**< A life counter that's incremented on usage. Higher counter is
-                                   * less likely to be evicted from the cache */
+    lv_lru_item_t * lru_item;     /**< The item in the gradient cache, pinned by `lv_gradient_get`*/
     uint32_t        filled : 1;   /**< Used to skip dithering in it if already done */
     uint32_t        not_cached: 1; /**< The cache was too small so this item is not managed by the cache*/
     lv_color_t   *  map;          /**< The computed gradient low bitdepth color map, points into the
@@ -81,7 +79,13 @@ void lv_gradient_set_cache_size(size_t max_bytes);
 /** Free the gradient cache */
 void lv_gradient_free_cache(void);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Get the gradient cache, e.g. to share a memory budget with other caches by `lv_lru_set_budget()`
+ * @return the cache or NULL if the cache size is 0
+ */
+lv_lru_t * lv_gradient_get_cache(void);
+
+/** Get a gradient cache from the given parameters. It's not evicted until `lv_gradient_cleanup`.*/
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, lv_coord_t w, lv_coord_t h);
 
 /**
@@ -0,0 +1,179 @@
+/**
+ * @file lv_draw_sw_parallel.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+
+#if LV_USE_DRAW_SW_PARALLEL
+
+#include "../../misc/lv_thread.h"
+#include "../../misc/lv_log.h"
+#include "../../core/lv_refr.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_DRAW_SW_PARALLEL_WORKER_CNT < 1
+    #error "LV_DRAW_SW_PARALLEL_WORKER_CNT must be at least 1"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t start;
+    lv_thread_sync_t done;
+    lv_draw_ctx_t draw_ctx;                 /*Copy of the caller's draw context, clipped to the band*/
+    lv_area_t clip_area;
+    const lv_draw_sw_blend_dsc_t * dsc;
+    bool exit;
+} worker_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void worker_cb(void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static worker_t workers[LV_DRAW_SW_PARALLEL_WORKER_CNT];
+static uint32_t worker_ref_cnt;
+static bool workers_ready;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_draw_sw_parallel_init(void)
+{
+    worker_ref_cnt++;
+    if(worker_ref_cnt > 1) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_PARALLEL_WORKER_CNT; i++) {
+        worker_t * w = &workers[i];
+        lv_memset_00(w, sizeof(worker_t));
+        if(lv_thread_sync_init(&w->start) != LV_RES_OK) break;
+        if(lv_thread_sync_init(&w->done) != LV_RES_OK) {
+            lv_thread_sync_delete(&w->start);
+            break;
+        }
+        if(lv_thread_init(&w->thread, worker_cb, LV_DRAW_SW_PARALLEL_STACK_SIZE, w) != LV_RES_OK) {
+            lv_thread_sync_delete(&w->start);
+            lv_thread_sync_delete(&w->done);
+            break;
+        }
+    }
+
+    if(i < LV_DRAW_SW_PARALLEL_WORKER_CNT) {
+        LV_LOG_WARN("Couldn't start the blend workers, blending on one thread");
+        /*Stop the workers started so far*/
+        while(i > 0) {
+            i--;
+            workers[i].exit = true;
+            lv_thread_sync_signal(&workers[i].start);
+            lv_thread_delete(&workers[i].thread);
+            lv_thread_sync_delete(&workers[i].start);
+            lv_thread_sync_delete(&workers[i].done);
+        }
+        return;
+    }
+
+    workers_ready = true;
+}
+
+void _lv_draw_sw_parallel_deinit(void)
+{
+    if(worker_ref_cnt == 0) return;
+    worker_ref_cnt--;
+    if(worker_ref_cnt > 0 || !workers_ready) return;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_PARALLEL_WORKER_CNT; i++) {
+        workers[i].exit = true;
+        lv_thread_sync_signal(&workers[i].start);
+        lv_thread_delete(&workers[i].thread);
+        lv_thread_sync_delete(&workers[i].start);
+        lv_thread_sync_delete(&workers[i].done);
+    }
+
+    workers_ready = false;
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_parallel(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    lv_coord_t h = lv_area_get_height(&blend_area);
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    /* Blend on this thread if
+     * - it's not worth to wake up the workers
+     * - `set_px_cb` is a user callback which might not be thread safe
+     * - the mask would be rounded in place by each band if anti-aliasing is disabled
+     * - the non-normal blend modes use a static color cache*/
+    if(!workers_ready ||
+       lv_area_get_size(&blend_area) < LV_DRAW_SW_PARALLEL_MIN_PX ||
+       h < LV_DRAW_SW_PARALLEL_WORKER_CNT + 1 ||
+       disp->driver->set_px_cb ||
+       (dsc->mask_buf && disp->driver->antialiasing == 0) ||
+       dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    /*Give a band to each worker and keep the last one for this thread*/
+    lv_coord_t band_h = h / (LV_DRAW_SW_PARALLEL_WORKER_CNT + 1);
+    lv_coord_t y = blend_area.y1;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_SW_PARALLEL_WORKER_CNT; i++) {
+        worker_t * w = &workers[i];
+        w->draw_ctx = *draw_ctx;
+        w->clip_area = blend_area;
+        w->clip_area.y1 = y;
+        w->clip_area.y2 = y + band_h - 1;
+        w->draw_ctx.clip_area = &w->clip_area;
+        w->dsc = dsc;
+        lv_thread_sync_signal(&w->start);
+        y += band_h;
+    }
+
+    lv_draw_ctx_t own_ctx = *draw_ctx;
+    lv_area_t own_clip_area = blend_area;
+    own_clip_area.y1 = y;
+    own_ctx.clip_area = &own_clip_area;
+    lv_draw_sw_blend_basic(&own_ctx, dsc);
+
+    for(i = 0; i < LV_DRAW_SW_PARALLEL_WORKER_CNT; i++) {
+        lv_thread_sync_wait(&workers[i].done);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void worker_cb(void * user_data)
+{
+    worker_t * w = user_data;
+    while(1) {
+        lv_thread_sync_wait(&w->start);
+        if(w->exit) break;
+
+        lv_draw_sw_blend_basic(&w->draw_ctx, w->dsc);
+        lv_thread_sync_signal(&w->done);
+    }
+}
+
+#endif /*LV_USE_DRAW_SW_PARALLEL*/
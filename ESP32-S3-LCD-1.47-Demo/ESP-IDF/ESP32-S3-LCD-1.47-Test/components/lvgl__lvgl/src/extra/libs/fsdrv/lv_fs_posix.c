@@ -20,6 +20,14 @@
     #include <windows.h>
 #endif
 
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define FS_USE_MMAP 1
+#else
+    #define FS_USE_MMAP 0
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -41,6 +49,10 @@ static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_
 static lv_fs_res_t fs_write(lv_fs_drv_t * drv, void * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
 static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+#if FS_USE_MMAP
+    static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t * size);
+    static void fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size);
+#endif
 static void * fs_dir_open(lv_fs_drv_t * drv, const char * path);
 static lv_fs_res_t fs_dir_read(lv_fs_drv_t * drv, void * dir_p, char * fn);
 static lv_fs_res_t fs_dir_close(lv_fs_drv_t * drv, void * dir_p);
@@ -80,6 +92,10 @@ void lv_fs_posix_init(void)
     fs_drv.write_cb = fs_write;
     fs_drv.seek_cb = fs_seek;
     fs_drv.tell_cb = fs_tell;
+#if FS_USE_MMAP
+    fs_drv.mmap_cb = fs_mmap;
+    fs_drv.munmap_cb = fs_munmap;
+#endif
 
     fs_drv.dir_close_cb = fs_dir_close;
     fs_drv.dir_open_cb = fs_dir_open;
@@ -196,6 +212,43 @@ static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
     return offset < 0 ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
 }
 
+#if FS_USE_MMAP
+/**
+ * Map the whole content of a file to the memory
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable
+ * @param size pointer to store the size of the file
+ * @return pointer to the content of the file or NULL if it can't be mapped (e.g. empty or opened for writes only)
+ */
+static const void * fs_mmap(lv_fs_drv_t * drv, void * file_p, uint32_t * size)
+{
+    LV_UNUSED(drv);
+    int fd = (lv_uintptr_t)file_p;
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) return NULL;
+
+    void * addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if(addr == MAP_FAILED) return NULL;
+
+    *size = st.st_size;
+    return addr;
+}
+
+/**
+ * Unmap a file mapped by `fs_mmap`
+ * @param drv pointer to a driver where this function belongs
+ * @param file_p a file handle variable
+ * @param addr the address returned by `fs_mmap`
+ * @param size the size of the mapping
+ */
+static void fs_munmap(lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(file_p);
+    munmap((void *)addr, size);
+}
+#endif
+
 #ifdef WIN32
     static char next_fn[256];
 #endif
@@ -108,11 +108,11 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
     f_gif_read(gif_base, &aspect, 1);
     /* Create gd_GIF Structure. */
 #if LV_COLOR_DEPTH == 32
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 5 * width * height);
+    gif = lv_mem_alloc_hint(sizeof(gd_GIF) + 5 * width * height, LV_MEM_HINT_LARGE);
 #elif LV_COLOR_DEPTH == 16
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 4 * width * height);
+    gif = lv_mem_alloc_hint(sizeof(gd_GIF) + 4 * width * height, LV_MEM_HINT_LARGE);
 #elif LV_COLOR_DEPTH == 8 || LV_COLOR_DEPTH == 1
-    gif = lv_mem_alloc(sizeof(gd_GIF) + 3 * width * height);
+    gif = lv_mem_alloc_hint(sizeof(gd_GIF) + 3 * width * height, LV_MEM_HINT_LARGE);
 #endif
 
     if (!gif) goto fail;
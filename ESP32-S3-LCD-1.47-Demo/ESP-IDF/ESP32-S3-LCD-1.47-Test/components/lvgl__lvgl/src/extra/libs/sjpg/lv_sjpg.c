@@ -396,7 +396,8 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
             sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
+            sjpeg->frame_cache = (void *)lv_mem_alloc_hint(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/,
+                                                           LV_MEM_HINT_LARGE);
             if(! sjpeg->frame_cache) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
@@ -459,7 +460,7 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 sjpeg->frame_base_array[0] = img_frame_base;
 
                 sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_mem_alloc_hint(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3, LV_MEM_HINT_LARGE);
                 if(! sjpeg->frame_cache) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
@@ -578,7 +579,7 @@ end:
                 }
 
                 sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_mem_alloc_hint(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3, LV_MEM_HINT_LARGE);
                 if(! sjpeg->frame_cache) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
@@ -666,7 +667,7 @@ end:
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
                 sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
+                sjpeg->frame_cache = (void *)lv_mem_alloc_hint(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3, LV_MEM_HINT_LARGE);
                 if(! sjpeg->frame_cache) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
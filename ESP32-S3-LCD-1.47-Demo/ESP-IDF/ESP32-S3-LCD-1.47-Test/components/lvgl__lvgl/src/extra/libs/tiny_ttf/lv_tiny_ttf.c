@@ -155,7 +155,7 @@ static const uint8_t * ttf_get_glyph_bitmap_cb(const lv_font_t * font, uint32_t
     LV_LOG_TRACE("cache miss for letter: %u", unicode_letter);
     /*Prepare space in cache*/
     size_t szb = h * stride;
-    buffer = lv_mem_alloc(szb);
+    buffer = lv_mem_alloc_hint(szb, LV_MEM_HINT_LARGE);
     if(!buffer) {
         LV_LOG_ERROR("failed to allocate cache value");
         return NULL;
@@ -265,6 +265,11 @@ void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size)
     font->line_height = (lv_coord_t)(dsc->scale * (dsc->ascent - dsc->descent + line_gap));
     font->base_line = (lv_coord_t)(dsc->scale * (line_gap - dsc->descent));
 }
+lv_lru_t * lv_tiny_ttf_get_cache(lv_font_t * font)
+{
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    return dsc->bitmap_cache;
+}
 void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     if(font != NULL) {
@@ -46,6 +46,9 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, lv_c
 /* set the size of the font to a new font_size*/
 void lv_tiny_ttf_set_size(lv_font_t * font, lv_coord_t font_size);
 
+/* get the glyph bitmap cache of the font, e.g. to share a memory budget with other caches by lv_lru_set_budget()*/
+lv_lru_t * lv_tiny_ttf_get_cache(lv_font_t * font);
+
 /* destroy a font previously created with lv_tiny_ttf_create_xxxx()*/
 void lv_tiny_ttf_destroy(lv_font_t * font);
 
@@ -166,7 +166,7 @@ lv_img_dsc_t * lv_snapshot_take(lv_obj_t * obj, lv_img_cf_t cf)
     LV_ASSERT_NULL(obj);
     uint32_t buff_size = lv_snapshot_buf_size_needed(obj, cf);
 
-    void * buf = lv_mem_alloc(buff_size);
+    void * buf = lv_mem_alloc_hint(buff_size, LV_MEM_HINT_LARGE);
     LV_ASSERT_MALLOC(buf);
     if(buf == NULL) {
         return NULL;
@@ -0,0 +1,438 @@
+/**
+ * @file lv_vlist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_vlist.h"
+#if LV_USE_VLIST
+
+#include "../../../widgets/lv_label.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS    &lv_vlist_class
+
+/*Only a window of this height is scrollable. When the viewport gets close to an edge of it
+ *the window is moved along the list, so the coordinates fit into `lv_coord_t` for any number of rows.*/
+#define WIN_H_MAX   LV_MIN(LV_COORD_MAX / 2, 4096)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void list_changed(lv_obj_t * obj);
+static void pool_update(lv_obj_t * obj);
+static lv_res_t win_follow(lv_obj_t * obj);
+static void win_set(lv_obj_t * obj, int32_t ofs);
+static void rows_update(lv_obj_t * obj);
+static void rows_reposition(lv_obj_t * obj);
+static uint32_t get_shown_row_cnt(const lv_vlist_t * vlist);
+static int32_t get_total_h(const lv_vlist_t * vlist);
+static lv_coord_t get_win_h(const lv_vlist_t * vlist);
+static uint32_t slot_to_id(uint32_t first, uint32_t slot, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_vlist_class = {
+    .constructor_cb = lv_vlist_constructor,
+    .event_cb = lv_vlist_event,
+    .width_def = LV_PCT(100),
+    .height_def = LV_PCT(100),
+    .instance_size = sizeof(lv_vlist_t),
+    .scroll_copy = 1,
+    .base_class = &lv_obj_class
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_vlist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_vlist_set_row_cb(lv_obj_t * obj, lv_vlist_row_create_cb_t create_cb, lv_vlist_row_update_cb_t update_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_obj_clean(obj);
+    vlist->pool_cnt = 0;
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+    vlist->create_cb = create_cb;
+    vlist->update_cb = update_cb;
+
+    list_changed(obj);
+}
+
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->row_cnt = cnt;
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+
+    list_changed(obj);
+}
+
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(h < 1) h = 1;
+    if(vlist->row_h == h) return;
+
+    vlist->row_h = h;
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+
+    uint32_t i;
+    for(i = 0; i < vlist->pool_cnt; i++) {
+        lv_obj_set_height(lv_obj_get_child(obj, i), h);
+    }
+
+    list_changed(obj);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_vlist_get_row_cnt(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return vlist->row_cnt;
+}
+
+lv_coord_t lv_vlist_get_row_height(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    return vlist->row_h;
+}
+
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t id)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->bound_first == LV_VLIST_ROW_NONE) return NULL;
+    if(id < vlist->bound_first || id >= vlist->bound_first + vlist->pool_cnt) return NULL;
+
+    return lv_obj_get_child(obj, id % vlist->pool_cnt);
+}
+
+uint32_t lv_vlist_get_row_id(const lv_obj_t * obj, const lv_obj_t * row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->bound_first == LV_VLIST_ROW_NONE) return LV_VLIST_ROW_NONE;
+    if(lv_obj_get_parent(row) != obj) return LV_VLIST_ROW_NONE;
+
+    uint32_t slot = lv_obj_get_index(row);
+    if(slot >= vlist->pool_cnt) return LV_VLIST_ROW_NONE;
+
+    return slot_to_id(vlist->bound_first, slot, vlist->pool_cnt);
+}
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t id, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_obj_update_layout(obj);
+
+    int32_t total_h = get_total_h(vlist);
+    lv_coord_t win_h = get_win_h(vlist);
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+
+    int32_t y = (int32_t)LV_MIN(id, get_shown_row_cnt(vlist)) * vlist->row_h;
+    if(y > total_h - view_h) y = total_h - view_h;
+    if(y < 0) y = 0;
+
+    /*Move the window if it can't be scrolled to the row. It's not smooth but the row is far anyway.*/
+    if(y < vlist->win_ofs || y > vlist->win_ofs + win_h - view_h) {
+        win_set(obj, y - (win_h - view_h) / 2);
+        lv_obj_update_layout(obj);
+    }
+
+    lv_obj_scroll_to_y(obj, (lv_coord_t)(y - vlist->win_ofs), anim_en);
+    rows_update(obj);
+}
+
+void lv_vlist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+    rows_update(obj);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    vlist->row_h = LV_DPI_DEF / 3;
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_res_t res;
+
+    /*Call the ancestor's event handler*/
+    res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RES_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*The window is the scrollable area*/
+        lv_point_t * p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, get_win_h(vlist));
+    }
+    else if(code == LV_EVENT_SCROLL) {
+        if(vlist->win_moving) return;
+
+        /*Scroll animations step to absolute positions so don't move the window under them*/
+        if(lv_anim_get(obj, NULL) == NULL) {
+            res = win_follow(obj);
+            if(res != LV_RES_OK) return;
+        }
+        rows_update(obj);
+    }
+    else if(code == LV_EVENT_SCROLL_END) {
+        res = win_follow(obj);
+        if(res != LV_RES_OK) return;
+        rows_update(obj);
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        pool_update(obj);
+        rows_update(obj);
+    }
+}
+
+/**
+ * Apply a change of the row count, row height or row callbacks.
+ */
+static void list_changed(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    lv_obj_update_layout(obj);
+    pool_update(obj);
+    win_set(obj, vlist->win_ofs);
+    rows_update(obj);
+
+    lv_obj_refresh_self_size(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Create or delete row objects to have as many as can be visible at once.
+ */
+static void pool_update(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    /*+2 for the partially visible rows at the top and bottom*/
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+    uint32_t cnt = view_h > 0 ? view_h / vlist->row_h + 2 : 0;
+    if(cnt > get_shown_row_cnt(vlist)) cnt = get_shown_row_cnt(vlist);
+    if(cnt > UINT16_MAX) cnt = UINT16_MAX;
+    if(cnt == vlist->pool_cnt) return;
+
+    /*The rows are bound to the row objects by `id % pool_cnt` so all of them need to be bound again*/
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+
+    while(vlist->pool_cnt > cnt) {
+        vlist->pool_cnt--;
+        lv_obj_del(lv_obj_get_child(obj, vlist->pool_cnt));
+    }
+
+    while(vlist->pool_cnt < cnt) {
+        lv_obj_t * row = vlist->create_cb ? vlist->create_cb(obj) : lv_label_create(obj);
+        lv_obj_set_size(row, LV_PCT(100), vlist->row_h);
+        vlist->pool_cnt++;
+    }
+}
+
+/**
+ * Move the window along the list if the viewport got close to one of its edges.
+ * The window is centered on the viewport and it's scrolled by the same amount so nothing moves on the screen.
+ * The scrolling of the input devices is relative so it goes on seamlessly.
+ * @return      LV_RES_INV if the object was deleted in a scroll event
+ */
+static lv_res_t win_follow(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    int32_t total_h = get_total_h(vlist);
+    lv_coord_t win_h = get_win_h(vlist);
+    lv_coord_t view_h = lv_obj_get_content_height(obj);
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(obj);
+
+    bool near_top = scroll_y < view_h && vlist->win_ofs > 0;
+    bool near_bottom = scroll_y > win_h - 2 * view_h && vlist->win_ofs + win_h < total_h;
+    if(!near_top && !near_bottom) return LV_RES_OK;
+
+    int32_t ofs = vlist->win_ofs + scroll_y - (win_h - view_h) / 2;
+    ofs = LV_CLAMP(0, ofs, total_h - win_h);
+    lv_coord_t diff = (lv_coord_t)(ofs - vlist->win_ofs);
+    if(diff == 0) return LV_RES_OK;
+
+    vlist->win_ofs = ofs;
+    vlist->win_moving = 1;
+    lv_res_t res = _lv_obj_scroll_by_raw(obj, 0, diff);
+    if(res != LV_RES_OK) return res;
+    vlist->win_moving = 0;
+
+    rows_reposition(obj);
+
+    return LV_RES_OK;
+}
+
+/**
+ * Move the window to a new position without keeping the visible rows in place.
+ * @param ofs   the new position, it's clamped to the list
+ */
+static void win_set(lv_obj_t * obj, int32_t ofs)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    ofs = LV_CLAMP(0, ofs, get_total_h(vlist) - get_win_h(vlist));
+    if(ofs == vlist->win_ofs) return;
+
+    /*The bound rows might be too far to have a coordinate in the new window*/
+    vlist->win_ofs = ofs;
+    vlist->bound_first = LV_VLIST_ROW_NONE;
+}
+
+/**
+ * Bind the rows of the viewport to the row objects.
+ * Only the row objects whose row has changed are updated.
+ */
+static void rows_update(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    uint32_t cnt = vlist->pool_cnt;
+    if(cnt == 0) return;
+
+    int32_t y = vlist->win_ofs + lv_obj_get_scroll_y(obj);
+    uint32_t first = y > 0 ? (uint32_t)(y / vlist->row_h) : 0;
+    uint32_t row_cnt = get_shown_row_cnt(vlist);
+    if(first > row_cnt - cnt) first = row_cnt - cnt;
+    if(first == vlist->bound_first) return;
+
+    uint32_t bound_first = vlist->bound_first;
+    vlist->bound_first = first;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        uint32_t id = slot_to_id(first, i, cnt);
+        if(bound_first != LV_VLIST_ROW_NONE && slot_to_id(bound_first, i, cnt) == id) continue;
+
+        lv_obj_t * row = lv_obj_get_child(obj, i);
+        lv_obj_set_y(row, (lv_coord_t)((int32_t)id * vlist->row_h - vlist->win_ofs));
+        if(vlist->update_cb) vlist->update_cb(obj, row, id);
+    }
+}
+
+/**
+ * Set the position of the row objects in the window after it was moved.
+ */
+static void rows_reposition(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    if(vlist->bound_first == LV_VLIST_ROW_NONE) return;
+
+    uint32_t i;
+    for(i = 0; i < vlist->pool_cnt; i++) {
+        uint32_t id = slot_to_id(vlist->bound_first, i, vlist->pool_cnt);
+        lv_obj_set_y(lv_obj_get_child(obj, i), (lv_coord_t)((int32_t)id * vlist->row_h - vlist->win_ofs));
+    }
+}
+
+/**
+ * Get the number of rows which can be shown. The height of the whole list is stored on 32 bits,
+ * so the rows below `INT32_MAX` pixels are left out. It's still millions of rows.
+ * @param vlist     pointer to a virtual list
+ * @return          `row_cnt` or less
+ */
+static uint32_t get_shown_row_cnt(const lv_vlist_t * vlist)
+{
+    int64_t total_h = (int64_t)vlist->row_cnt * vlist->row_h;
+    if(total_h <= INT32_MAX) return vlist->row_cnt;
+    else return INT32_MAX / vlist->row_h;
+}
+
+static int32_t get_total_h(const lv_vlist_t * vlist)
+{
+    return (int32_t)get_shown_row_cnt(vlist) * vlist->row_h;
+}
+
+static lv_coord_t get_win_h(const lv_vlist_t * vlist)
+{
+    return (lv_coord_t)LV_MIN(get_total_h(vlist), WIN_H_MAX);
+}
+
+/**
+ * Get the row bound to a row object. The row objects are used as a ring buffer: row `id` is on `id % cnt`.
+ * @param first     the first bound row
+ * @param slot      index of the row object
+ * @param cnt       number of row objects
+ * @return          the row bound to `slot`
+ */
+static uint32_t slot_to_id(uint32_t first, uint32_t slot, uint32_t cnt)
+{
+    return first + (slot + cnt - first % cnt) % cnt;
+}
+
+#endif /*LV_USE_VLIST*/
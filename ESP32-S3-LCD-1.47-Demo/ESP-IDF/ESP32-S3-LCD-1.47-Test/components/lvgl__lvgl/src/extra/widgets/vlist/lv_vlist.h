@@ -0,0 +1,162 @@
+/**
+ * @file lv_vlist.h
+ *
+ */
+
+#ifndef LV_VLIST_H
+#define LV_VLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../core/lv_obj.h"
+
+#if LV_USE_VLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_VLIST_ROW_NONE   0xFFFFFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create a row object. Called only while the pool of rows grows.
+ * @param vlist     pointer to the virtual list, the parent of the new row
+ * @return          the created row
+ */
+typedef lv_obj_t * (*lv_vlist_row_create_cb_t)(lv_obj_t * vlist);
+
+/**
+ * Show the data of a row on a row object, e.g. set the text of a label.
+ * @param vlist     pointer to the virtual list
+ * @param row       a row object created by `lv_vlist_row_create_cb_t`
+ * @param id        index of the row in the data source
+ */
+typedef void (*lv_vlist_row_update_cb_t)(lv_obj_t * vlist, lv_obj_t * row, uint32_t id);
+
+/*Data of virtual list*/
+typedef struct {
+    lv_obj_t obj;
+    lv_vlist_row_create_cb_t create_cb;
+    lv_vlist_row_update_cb_t update_cb;
+    uint32_t row_cnt;           /*Number of rows in the data source*/
+    uint32_t bound_first;       /*The first row bound to the pool or `LV_VLIST_ROW_NONE`*/
+    int32_t win_ofs;            /*Position of the scrollable window in the whole list*/
+    lv_coord_t row_h;
+    uint16_t pool_cnt;          /*Number of row objects*/
+    uint8_t win_moving : 1;     /*Ignore the scroll events while the window is moved*/
+} lv_vlist_t;
+
+extern const lv_obj_class_t lv_vlist_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtual list object.
+ * Only as many row objects are created as fit in the viewport. They are reused for the
+ * rows scrolled into view so the memory usage doesn't depend on the number of rows.
+ * @param parent    pointer to an object, it will be the parent of the new virtual list
+ * @return          pointer to the created virtual list
+ */
+lv_obj_t * lv_vlist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the callbacks to create the row objects and to show the data on them.
+ * The existing row objects are deleted and created again.
+ * @param obj       pointer to a virtual list object
+ * @param create_cb creates a row object. If `NULL` the rows will be labels.
+ * @param update_cb shows the data of a row on a row object
+ */
+void lv_vlist_set_row_cb(lv_obj_t * obj, lv_vlist_row_create_cb_t create_cb, lv_vlist_row_update_cb_t update_cb);
+
+/**
+ * Set the number of rows in the data source.
+ * If `cnt * row height` exceeds `INT32_MAX` only the rows above `INT32_MAX` pixels are shown.
+ * @param obj       pointer to a virtual list object
+ * @param cnt       number of rows
+ */
+void lv_vlist_set_row_cnt(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the height of the rows. All rows have the same height.
+ * @param obj       pointer to a virtual list object
+ * @param h         height of a row in pixels
+ */
+void lv_vlist_set_row_height(lv_obj_t * obj, lv_coord_t h);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of rows in the data source.
+ * @param obj       pointer to a virtual list object
+ * @return          number of rows
+ */
+uint32_t lv_vlist_get_row_cnt(const lv_obj_t * obj);
+
+/**
+ * Get the height of the rows.
+ * @param obj       pointer to a virtual list object
+ * @return          height of a row in pixels
+ */
+lv_coord_t lv_vlist_get_row_height(const lv_obj_t * obj);
+
+/**
+ * Get the row object showing a row of the data source.
+ * @param obj       pointer to a virtual list object
+ * @param id        index of the row in the data source
+ * @return          the row object or `NULL` if the row is not in or close to the viewport
+ */
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t id);
+
+/**
+ * Get the index of the data source's row shown by a row object.
+ * @param obj       pointer to a virtual list object
+ * @param row       a row object of the virtual list
+ * @return          index of the row in the data source or `LV_VLIST_ROW_NONE` if the row object is unused
+ */
+uint32_t lv_vlist_get_row_id(const lv_obj_t * obj, const lv_obj_t * row);
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Scroll a row to the top of the viewport.
+ * @param obj       pointer to a virtual list object
+ * @param id        index of the row in the data source
+ * @param anim_en   LV_ANIM_ON: scroll with animation; LV_ANIM_OFF: scroll immediately
+ */
+void lv_vlist_scroll_to_row(lv_obj_t * obj, uint32_t id, lv_anim_enable_t anim_en);
+
+/**
+ * Call the update callback again on every row object, e.g. when the data source has changed.
+ * @param obj       pointer to a virtual list object
+ */
+void lv_vlist_refresh(lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_H*/
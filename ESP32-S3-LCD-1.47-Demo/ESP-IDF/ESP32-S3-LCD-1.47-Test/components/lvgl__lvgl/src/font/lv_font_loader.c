@@ -14,6 +14,15 @@
 #include "../misc/lv_fs.h"
 #include "lv_font_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_FONT_FMT_TXT_LARGE == 0
+    #define BITMAP_INDEX_MAX    ((1UL << 20) - 1)
+#else
+    #define BITMAP_INDEX_MAX    UINT32_MAX
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,6 +69,13 @@ typedef struct cmap_table_bin {
     uint8_t padding;
 } cmap_table_bin_t;
 
+/*The `dsc` of the loaded fonts. If the glyph bitmaps are used in place from a mapped file, it stays open.*/
+typedef struct {
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_fs_file_t file;
+    bool mapped;
+} loaded_font_dsc_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -105,7 +121,14 @@ lv_font_t * lv_font_load(const char * font_name)
         }
     }
 
-    lv_fs_close(&file);
+    /*Keep the file open while its mapped glyph bitmaps are used. `lv_font_free` will close it.*/
+    loaded_font_dsc_t * loaded_dsc = font ? (loaded_font_dsc_t *)font->dsc : NULL;
+    if(loaded_dsc && loaded_dsc->mapped) {
+        lv_memcpy(&loaded_dsc->file, &file, sizeof(file));
+    }
+    else {
+        lv_fs_close(&file);
+    }
 
     return font;
 }
@@ -166,7 +189,12 @@ void lv_font_free(lv_font_t * font)
                 lv_mem_free(cmaps);
             }
 
-            if(NULL != dsc->glyph_bitmap) {
+            loaded_font_dsc_t * loaded_dsc = (loaded_font_dsc_t *)dsc;
+            if(loaded_dsc->mapped) {
+                /*The bitmaps are in the file. It's not open if the loading failed.*/
+                if(loaded_dsc->file.drv) lv_fs_close(&loaded_dsc->file);
+            }
+            else if(NULL != dsc->glyph_bitmap) {
                 lv_mem_free((void *)dsc->glyph_bitmap);
             }
             if(NULL != dsc->glyph_dsc) {
@@ -414,6 +442,21 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
         }
     }
 
+    /*Use the bitmaps in place if the file is mapped and they start on byte boundaries.
+     *The glyph headers have the same size, so the bitmaps are right after them.*/
+    uint32_t map_size;
+    const uint8_t * map = lv_fs_mmap(fp, &map_size);
+    uint32_t header_bits = header->advance_width_bits + 2 * header->xy_bits + 2 * header->wh_bits;
+    if(map && header_bits % 8 == 0 && start + (uint32_t)glyph_length <= map_size &&
+       (uint32_t)glyph_length <= BITMAP_INDEX_MAX) {
+        for(unsigned int i = 1; i < loca_count; ++i) {
+            glyph_dsc[i].bitmap_index = glyph_offset[i] + header_bits / 8;
+        }
+        font_dsc->glyph_bitmap = map + start;
+        ((loaded_font_dsc_t *)font_dsc)->mapped = true;
+        return glyph_length;
+    }
+
     uint8_t * glyph_bmp = (uint8_t *)lv_mem_alloc(sizeof(uint8_t) * cur_bmp_size);
 
     font_dsc->glyph_bitmap = glyph_bmp;
@@ -483,9 +526,9 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
 static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 {
     lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
-                                       lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
+                                       lv_mem_alloc(sizeof(loaded_font_dsc_t));
 
-    memset(font_dsc, 0, sizeof(lv_font_fmt_txt_dsc_t));
+    memset(font_dsc, 0, sizeof(loaded_font_dsc_t));
 
     font->dsc = font_dsc;
 
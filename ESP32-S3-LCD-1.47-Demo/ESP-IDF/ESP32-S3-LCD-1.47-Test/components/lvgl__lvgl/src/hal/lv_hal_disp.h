@@ -99,9 +99,17 @@ typedef struct _lv_disp_drv_t {
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
     uint32_t screen_transp : 1;      /**Handle if the screen doesn't have a solid (opa == LV_OPA_COVER) background.
                                        * Use only if required because it's slower.*/
+    uint32_t cull_occluded : 1;      /**< 1: Don't draw the objects which are fully covered by their opaque younger siblings*/
+    uint32_t scroll_copy : 1;        /**< 1: Move the pixels of the scrolled objects instead of redrawing them.
+                                       * Needs `direct_mode` or `scroll_cb`*/
 
     uint32_t dpi : 10;              /** DPI (dot per inch) of the display. Default value is `LV_DPI_DEF`.*/
 
+    /** Fixed cost of a flush (setting the window, starting the transfer, etc.) expressed in pixels.
+     * Invalidated areas are joined if redrawing the extra pixels of their bounding box is cheaper.
+     * 0: join only if the joined area is smaller than the two areas separately*/
+    uint32_t flush_cost;
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_disp_flush_ready()' has to be
      * called when finished*/
     void (*flush_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
@@ -118,6 +126,11 @@ typedef struct _lv_disp_drv_t {
 
     void (*clear_cb)(struct _lv_disp_drv_t * disp_drv, uint8_t * buf, uint32_t size);
 
+    /** OPTIONAL: Move the pixels of an area vertically on the display, e.g. with the hardware scrolling of the controller.
+     * Called with `scroll_copy` before rendering, when the previous flush is ready.
+     * Return false if it's not possible for the given area. The area will be redrawn then.*/
+    bool (*scroll_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dy);
+
 
     /** OPTIONAL: Called after every refresh cycle to tell the rendering and flushing time + the
      * number of flushed pixels*/
@@ -188,6 +201,10 @@ typedef struct _lv_disp_t {
     uint16_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Area to move by `scroll_dy` pixels before the next refresh*/
+    lv_area_t scroll_area;
+    lv_coord_t scroll_dy;
+
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
 
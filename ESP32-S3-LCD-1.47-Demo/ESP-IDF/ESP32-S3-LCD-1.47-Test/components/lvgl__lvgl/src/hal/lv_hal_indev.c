@@ -65,6 +65,7 @@ void lv_indev_drv_init(lv_indev_drv_t * driver)
     driver->long_press_repeat_time  = LV_INDEV_DEF_LONG_PRESS_REP_TIME;
     driver->gesture_limit        = LV_INDEV_DEF_GESTURE_LIMIT;
     driver->gesture_min_velocity = LV_INDEV_DEF_GESTURE_MIN_VELOCITY;
+    driver->refr_on_input        = LV_INDEV_DEF_REFR_ON_INPUT;
 }
 
 /**
@@ -97,6 +97,10 @@ typedef struct _lv_indev_drv_t {
      * The second parameter is the event from `lv_event_t`*/
     void (*feedback_cb)(struct _lv_indev_drv_t *, uint8_t);
 
+    /** Called when the changes made by the input device were refreshed. The second parameter is the latency:
+     * the time from reading the change in `read_cb` until the last area is passed to `flush_cb` [ms]*/
+    void (*latency_cb)(struct _lv_indev_drv_t *, uint32_t);
+
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
@@ -124,6 +128,10 @@ typedef struct _lv_indev_drv_t {
 
     /**< Repeated trigger period in long press [ms]*/
     uint16_t long_press_repeat_time;
+
+    /**< 1: Refresh the display right after the input changed something on it instead of waiting for
+     * the refresh period*/
+    uint8_t refr_on_input : 1;
 } lv_indev_drv_t;
 
 /** Run time data of input devices
@@ -136,6 +144,7 @@ typedef struct _lv_indev_proc_t {
     uint8_t reset_query : 1;
     uint8_t disabled : 1;
     uint8_t wait_until_release : 1;
+    uint8_t latency_pending : 1;
 
     union {
         struct {
@@ -169,6 +178,7 @@ typedef struct _lv_indev_proc_t {
 
     uint32_t pr_timestamp;         /**< Pressed time stamp*/
     uint32_t longpr_rep_timestamp; /**< Long press repeat time stamp*/
+    uint32_t input_timestamp;      /**< Read time of the first change which is not refreshed yet*/
 } _lv_indev_proc_t;
 
 /** The main input device descriptor with driver, runtime data ('proc') and some additional
@@ -31,6 +31,7 @@
 #if !LV_TICK_CUSTOM
     static uint32_t sys_time = 0;
     static volatile uint8_t tick_irq_flag;
+    static lv_tick_get_cb_t tick_get_cb;
 #endif
 
 /**********************
@@ -51,6 +52,11 @@ void LV_ATTRIBUTE_TICK_INC lv_tick_inc(uint32_t tick_period)
     tick_irq_flag = 0;
     sys_time += tick_period;
 }
+
+void lv_tick_set_cb(lv_tick_get_cb_t cb)
+{
+    tick_get_cb = cb;
+}
 #endif
 
 /**
@@ -60,6 +66,7 @@ void LV_ATTRIBUTE_TICK_INC lv_tick_inc(uint32_t tick_period)
 uint32_t lv_tick_get(void)
 {
 #if LV_TICK_CUSTOM == 0
+    if(tick_get_cb) return tick_get_cb();
 
     /*If `lv_tick_inc` is called from an interrupt while `sys_time` is read
      *the result might be corrupted.
@@ -29,6 +29,10 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if !LV_TICK_CUSTOM
+typedef uint32_t (*lv_tick_get_cb_t)(void);
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -45,6 +49,15 @@ void /* LV_ATTRIBUTE_TICK_INC */ lv_tick_inc(uint32_t tick_period);
 
 //! @endcond
 
+#if !LV_TICK_CUSTOM
+/**
+ * Set a function which returns the elapsed milliseconds from a monotonic clock.
+ * If it's set `lv_tick_inc()` is not needed, so no periodic interrupt has to wake up the CPU.
+ * @param cb the callback or NULL to count the time with `lv_tick_inc()` again
+ */
+void lv_tick_set_cb(lv_tick_get_cb_t cb);
+#endif
+
 /**
  * Get the elapsed milliseconds since start up
  * @return the elapsed milliseconds
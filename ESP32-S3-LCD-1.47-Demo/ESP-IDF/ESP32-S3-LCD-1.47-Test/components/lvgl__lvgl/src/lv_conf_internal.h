@@ -188,13 +188,13 @@
     #endif
 #endif     /*LV_MEM_CUSTOM*/
 
-/*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
- *You will see an error log message if there wasn't enough buffers. */
-#ifndef LV_MEM_BUF_MAX_NUM
-    #ifdef CONFIG_LV_MEM_BUF_MAX_NUM
-        #define LV_MEM_BUF_MAX_NUM CONFIG_LV_MEM_BUF_MAX_NUM
+/*Size of the memory chunks from which the intermediate buffers used during rendering and other internal
+ *processing mechanisms are allocated. A buffer larger than this gets a chunk of its own.*/
+#ifndef LV_MEM_BUF_CHUNK_SIZE
+    #ifdef CONFIG_LV_MEM_BUF_CHUNK_SIZE
+        #define LV_MEM_BUF_CHUNK_SIZE CONFIG_LV_MEM_BUF_CHUNK_SIZE
     #else
-        #define LV_MEM_BUF_MAX_NUM 16
+        #define LV_MEM_BUF_CHUNK_SIZE 4096
     #endif
 #endif
 
@@ -229,6 +229,16 @@
     #endif
 #endif
 
+/*1: Refresh the display right after an input device changed something on it
+ *instead of waiting for the display's refresh period. Can be changed in `lv_indev_drv_t`.*/
+#ifndef LV_INDEV_DEF_REFR_ON_INPUT
+    #ifdef CONFIG_LV_INDEV_DEF_REFR_ON_INPUT
+        #define LV_INDEV_DEF_REFR_ON_INPUT CONFIG_LV_INDEV_DEF_REFR_ON_INPUT
+    #else
+        #define LV_INDEV_DEF_REFR_ON_INPUT 0
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -412,6 +422,57 @@
     #endif
 #endif
 
+/*Split big fills and image blends into horizontal bands and blend them on several threads.
+ *The thread calling `lv_timer_handler()` blends a band too.*/
+#ifndef LV_USE_DRAW_SW_PARALLEL
+    #ifdef CONFIG_LV_USE_DRAW_SW_PARALLEL
+        #define LV_USE_DRAW_SW_PARALLEL CONFIG_LV_USE_DRAW_SW_PARALLEL
+    #else
+        #define LV_USE_DRAW_SW_PARALLEL 0
+    #endif
+#endif
+#if LV_USE_DRAW_SW_PARALLEL
+    /*LV_OS_PTHREAD or LV_OS_FREERTOS*/
+    #ifndef LV_DRAW_SW_PARALLEL_OS
+        #ifdef CONFIG_LV_DRAW_SW_PARALLEL_OS
+            #define LV_DRAW_SW_PARALLEL_OS CONFIG_LV_DRAW_SW_PARALLEL_OS
+        #else
+            #define LV_DRAW_SW_PARALLEL_OS LV_OS_PTHREAD
+        #endif
+    #endif
+
+    /*Number of worker threads*/
+    #ifndef LV_DRAW_SW_PARALLEL_WORKER_CNT
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_DRAW_SW_PARALLEL_WORKER_CNT
+                #define LV_DRAW_SW_PARALLEL_WORKER_CNT CONFIG_LV_DRAW_SW_PARALLEL_WORKER_CNT
+            #else
+                #define LV_DRAW_SW_PARALLEL_WORKER_CNT 0
+            #endif
+        #else
+            #define LV_DRAW_SW_PARALLEL_WORKER_CNT 1
+        #endif
+    #endif
+
+    /*Blends smaller than this many pixels are not split*/
+    #ifndef LV_DRAW_SW_PARALLEL_MIN_PX
+        #ifdef CONFIG_LV_DRAW_SW_PARALLEL_MIN_PX
+            #define LV_DRAW_SW_PARALLEL_MIN_PX CONFIG_LV_DRAW_SW_PARALLEL_MIN_PX
+        #else
+            #define LV_DRAW_SW_PARALLEL_MIN_PX 8192
+        #endif
+    #endif
+
+    /*Stack size of a worker thread in bytes*/
+    #ifndef LV_DRAW_SW_PARALLEL_STACK_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_PARALLEL_STACK_SIZE
+            #define LV_DRAW_SW_PARALLEL_STACK_SIZE CONFIG_LV_DRAW_SW_PARALLEL_STACK_SIZE
+        #else
+            #define LV_DRAW_SW_PARALLEL_STACK_SIZE 2048
+        #endif
+    #endif
+#endif
+
 /*-------------
  * GPU
  *-----------*/
@@ -848,6 +909,26 @@
     #endif
 #endif
 
+/*Number of entries in the cache of resolved style properties (power of 2). 0 to disable caching.
+ *An entry is about 20 bytes. Any style change invalidates the whole cache.*/
+#ifndef LV_OBJ_STYLE_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+        #define LV_OBJ_STYLE_CACHE_SIZE CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+    #else
+        #define LV_OBJ_STYLE_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Allocate the objects of the same size from chunks of this many bytes. 0 to allocate every object from the heap.
+ *Reduces heap fragmentation when screens are created and deleted, but a partially used chunk can't be used for other things.*/
+#ifndef LV_OBJ_SLAB_CHUNK_SIZE
+    #ifdef CONFIG_LV_OBJ_SLAB_CHUNK_SIZE
+        #define LV_OBJ_SLAB_CHUNK_SIZE CONFIG_LV_OBJ_SLAB_CHUNK_SIZE
+    #else
+        #define LV_OBJ_SLAB_CHUNK_SIZE 0
+    #endif
+#endif
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #ifndef LV_ENABLE_GC
@@ -1854,6 +1935,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_VLIST
+    #ifdef _LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_VLIST
+            #define LV_USE_VLIST CONFIG_LV_USE_VLIST
+        #else
+            #define LV_USE_VLIST 0
+        #endif
+    #else
+        #define LV_USE_VLIST      1
+    #endif
+#endif
+
 #ifndef LV_USE_WIN
     #ifdef _LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_WIN
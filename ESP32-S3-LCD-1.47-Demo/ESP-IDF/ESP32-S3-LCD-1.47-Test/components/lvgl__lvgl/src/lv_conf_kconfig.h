@@ -154,6 +154,15 @@ extern "C" {
 #  define CONFIG_LV_FONT_DEFAULT &lv_font_unscii_16
 #endif
 
+/*------------------
+ * PARALLEL DRAWING
+ *-----------------*/
+#ifdef CONFIG_LV_DRAW_SW_PARALLEL_OS_FREERTOS
+#  define CONFIG_LV_DRAW_SW_PARALLEL_OS LV_OS_FREERTOS
+#elif defined(CONFIG_LV_DRAW_SW_PARALLEL_OS_PTHREAD)
+#  define CONFIG_LV_DRAW_SW_PARALLEL_OS LV_OS_PTHREAD
+#endif
+
 /*------------------
  * TEXT ENCODING
  *-----------------*/
@@ -18,28 +18,60 @@
 /*********************
  *      DEFINES
  *********************/
-#define LV_ANIM_RESOLUTION 1024
-#define LV_ANIM_RES_SHIFT 10
+#define ANIM_SLAB_CHUNK_CNT 16  /*Number of animations allocated at once*/
+#define ANIM_TABLE_MIN_SIZE 16
 
 /**********************
  *      TYPEDEFS
  **********************/
+/*The progress on a path in [0..LV_BEZIER_VAL_MAX] range (can overshoot) from the progress in time*/
+typedef int32_t (*path_step_cb_t)(int32_t t);
+
+/*The last evaluated step of a path. The animations started together share it.*/
+typedef struct {
+    lv_anim_path_cb_t path_cb;
+    path_step_cb_t step_cb;
+    int32_t act_time;
+    int32_t time;
+    int32_t step;
+} path_step_cache_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
-static void anim_mark_list_change(void);
-static void anim_ready_handler(lv_anim_t * a);
+static void anim_update_timer(void);
+static void anim_ready_handler(uint32_t i);
+static bool anim_table_add(lv_anim_t * a);
+static void anim_table_remove(uint32_t i);
+static void anim_table_compact(void);
+static int32_t anim_path_value(lv_anim_t * a, path_step_cache_t * cache);
+static int32_t path_interpolate(const lv_anim_t * a, int32_t step);
+static int32_t path_step_linear(int32_t t);
+static int32_t path_step_ease_in(int32_t t);
+static int32_t path_step_ease_out(int32_t t);
+static int32_t path_step_ease_in_out(int32_t t);
+static int32_t path_step_overshoot(int32_t t);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t last_timer_run;
-static bool anim_list_changed;
-static bool anim_run_round;
+static uint16_t iter_depth;   /*The table is being iterated so it can't be compacted*/
 static lv_timer_t * _lv_anim_tmr;
 
+/*The built-in paths which depend only on the progress in time. The bounce also scales the distance so it's not here.*/
+static const struct {
+    lv_anim_path_cb_t path_cb;
+    path_step_cb_t step_cb;
+} path_steps[] = {
+    {lv_anim_path_linear, path_step_linear},
+    {lv_anim_path_ease_in, path_step_ease_in},
+    {lv_anim_path_ease_out, path_step_ease_out},
+    {lv_anim_path_ease_in_out, path_step_ease_in_out},
+    {lv_anim_path_overshoot, path_step_overshoot},
+};
+
 /**********************
  *      MACROS
  **********************/
@@ -56,10 +88,13 @@ static lv_timer_t * _lv_anim_tmr;
 
 void _lv_anim_core_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_anim_ll), sizeof(lv_anim_t));
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    lv_memset_00(table, sizeof(_lv_anim_table_t));
+    lv_slab_init(&table->slab, sizeof(lv_anim_t), ANIM_SLAB_CHUNK_CNT);
+    iter_depth = 0;
+
     _lv_anim_tmr = lv_timer_create(anim_timer, LV_DISP_DEF_REFR_PERIOD, NULL);
-    anim_mark_list_change(); /*Turn off the animation timer*/
-    anim_list_changed = false;
+    anim_update_timer(); /*Turn off the animation timer*/
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -80,20 +115,27 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
     if(a->exec_cb != NULL) lv_anim_del(a->var, a->exec_cb); /*exec_cb == NULL would delete all animations of var*/
 
-    /*If the list is empty the anim timer was suspended and it's last run measure is invalid*/
-    if(_lv_ll_is_empty(&LV_GC_ROOT(_lv_anim_ll))) {
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+
+    /*If there are no animations the anim timer was suspended and it's last run measure is invalid*/
+    if(table->anim_cnt == 0) {
         last_timer_run = lv_tick_get();
     }
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = _lv_ll_ins_head(&LV_GC_ROOT(_lv_anim_ll));
+    lv_anim_t * new_anim = lv_slab_alloc(&table->slab);
     LV_ASSERT_MALLOC(new_anim);
     if(new_anim == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
-    new_anim->run_round = anim_run_round;
+
+    /*Add the new animation to the end of the table. So the animations of the same tick run in
+     *the order they were started, unlike the head insert of the former list (newest first).*/
+    if(!anim_table_add(new_anim)) {
+        lv_slab_free(&table->slab, new_anim);
+        return NULL;
+    }
 
     /*Set the start value*/
     if(new_anim->early_apply) {
@@ -106,10 +148,6 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         if(new_anim->exec_cb && new_anim->var) new_anim->exec_cb(new_anim->var, new_anim->start_value);
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
-    anim_mark_list_change();
-
     TRACE_ANIM("finished");
     return new_anim;
 }
@@ -137,41 +175,62 @@ uint32_t lv_anim_get_playtime(lv_anim_t * a)
 
 bool lv_anim_del(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    lv_anim_t * a_next;
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
     bool del = false;
-    a        = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-    while(a != NULL) {
-        /*'a' might be deleted, so get the next object while 'a' is valid*/
-        a_next = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
 
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
+    /*The table can change in `deleted_cb` so always index it. The animations started meanwhile
+     *are added after `cnt` and are not checked.*/
+    iter_depth++;
+    uint32_t cnt = table->cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = table->entries[i].anim;
+        if(a == NULL) continue;
+
+        if((table->entries[i].var == var || var == NULL) && (table->entries[i].exec_cb == exec_cb || exec_cb == NULL)) {
+            anim_table_remove(i);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_mem_free(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+            lv_slab_free(&table->slab, a);
             del = true;
         }
-
-        a = a_next;
     }
+    iter_depth--;
+
+    anim_table_compact();
 
     return del;
 }
 
 void lv_anim_del_all(void)
 {
-    _lv_ll_clear(&LV_GC_ROOT(_lv_anim_ll));
-    anim_mark_list_change();
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    uint32_t i;
+    for(i = 0; i < table->cnt; i++) {
+        if(table->entries[i].anim) {
+            lv_slab_free(&table->slab, table->entries[i].anim);
+            table->entries[i].anim = NULL;
+        }
+    }
+
+    table->anim_cnt = 0;
+    anim_table_compact();
+    anim_update_timer();
+
+    if(table->cnt == 0) {
+        lv_mem_free(table->entries);
+        table->entries = NULL;
+        table->size = 0;
+    }
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            return a;
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    uint32_t i;
+    for(i = 0; i < table->cnt; i++) {
+        _lv_anim_table_entry_t * e = &table->entries[i];
+        if(e->anim && e->var == var && (e->exec_cb == exec_cb || exec_cb == NULL)) {
+            return e->anim;
         }
     }
 
@@ -185,11 +244,7 @@ struct _lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) cnt++;
-
-    return cnt;
+    return (uint16_t)LV_GC_ROOT(_lv_anim_table).anim_cnt;
 }
 
 uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end)
@@ -211,73 +266,32 @@ void lv_anim_refr_now(void)
 
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    int32_t step = lv_map(a->act_time, 0, a->time, 0, LV_ANIM_RESOLUTION);
-
-    /*Get the new value which will be proportional to `step`
-     *and the `start` and `end` values*/
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_ANIM_RES_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    int32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+    return path_interpolate(a, path_step_linear(t));
 }
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 50, 100, LV_BEZIER_VAL_MAX);
-
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    int32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+    return path_interpolate(a, path_step_ease_in(t));
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 900, 950, LV_BEZIER_VAL_MAX);
-
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    int32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+    return path_interpolate(a, path_step_ease_out(t));
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 50, 952, LV_BEZIER_VAL_MAX);
-
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    int32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+    return path_interpolate(a, path_step_ease_in_out(t));
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    /*Calculate the current step*/
-    uint32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
-    int32_t step = lv_bezier3(t, 0, 1000, 1300, LV_BEZIER_VAL_MAX);
-
-    int32_t new_value;
-    new_value = step * (a->end_value - a->start_value);
-    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
-    new_value += a->start_value;
-
-    return new_value;
+    int32_t t = lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX);
+    return path_interpolate(a, path_step_overshoot(t));
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -351,72 +365,142 @@ static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
-    uint32_t elaps = lv_tick_elaps(last_timer_run);
-
-    /*Flip the run round*/
-    anim_run_round = anim_run_round ? false : true;
-
-    lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
 
-    while(a != NULL) {
-        /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        anim_list_changed = false;
-
-        if(a->run_round != anim_run_round) {
-            a->run_round = anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+    /*Measure from the beginning of this run to not lose the time spent in the callbacks*/
+    uint32_t elaps = lv_tick_elaps(last_timer_run);
+    last_timer_run = lv_tick_get();
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            int32_t new_act_time = a->act_time + elaps;
-            if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
+    path_step_cache_t path_cache;
+    lv_memset_00(&path_cache, sizeof(path_cache));
+
+    /*The animations deleted meanwhile become NULL and the started ones are added after `cnt`
+     *so they will run only in the next round*/
+    iter_depth++;
+    uint32_t cnt = table->cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_anim_t * a = table->entries[i].anim;
+        if(a == NULL) continue;
+
+        /*The animation will run now for the first time. Call `start_cb`*/
+        int32_t new_act_time = a->act_time + elaps;
+        if(!a->start_cb_called && a->act_time <= 0 && new_act_time >= 0) {
+            if(a->early_apply == 0 && a->get_value_cb) {
+                int32_t v_ofs = a->get_value_cb(a);
+                a->start_value += v_ofs;
+                a->end_value += v_ofs;
+            }
+            a->start_cb_called = 1;
+            if(a->start_cb) {
+                a->start_cb(a);
+                if(table->entries[i].anim != a) continue;   /*Deleted in `start_cb`*/
+            }
+        }
+        a->act_time += elaps;
+        if(a->act_time >= 0) {
+            if(a->act_time > a->time) a->act_time = a->time;
+
+            int32_t new_value;
+            new_value = anim_path_value(a, &path_cache);
+
+            if(new_value != a->current_value) {
+                a->current_value = new_value;
+                /*Apply the calculated value*/
+                if(a->exec_cb) {
+                    a->exec_cb(a->var, new_value);
+                    if(table->entries[i].anim != a) continue;   /*Deleted in `exec_cb`*/
                 }
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
             }
-            a->act_time += elaps;
-            if(a->act_time >= 0) {
-                if(a->act_time > a->time) a->act_time = a->time;
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+            /*If the time is elapsed the animation is ready*/
+            if(a->act_time >= a->time) {
+                anim_ready_handler(i);
+            }
+        }
+    }
+    iter_depth--;
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                }
+    anim_table_compact();
+}
 
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->time) {
-                    anim_ready_handler(a);
-                }
-            }
+/**
+ * Get the current value of an animation.
+ * The step of the built-in paths is evaluated only once for the consecutive animations
+ * with the same path and timing, e.g. the animations of a list or the transitions of a style.
+ * @param a pointer to an animation
+ * @param cache the last evaluated step, updated if not matching
+ * @return the value to apply
+ */
+static int32_t anim_path_value(lv_anim_t * a, path_step_cache_t * cache)
+{
+    if(a->path_cb != cache->path_cb) {
+        cache->path_cb = a->path_cb;
+        cache->step_cb = NULL;
+        cache->time = -1;
+        uint32_t i;
+        for(i = 0; i < sizeof(path_steps) / sizeof(path_steps[0]); i++) {
+            if(path_steps[i].path_cb == a->path_cb) cache->step_cb = path_steps[i].step_cb;
         }
+    }
+
+    if(cache->step_cb == NULL) return a->path_cb(a);
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(anim_list_changed)
-            a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
-        else
-            a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
+    if(a->act_time != cache->act_time || a->time != cache->time) {
+        cache->act_time = a->act_time;
+        cache->time = a->time;
+        cache->step = cache->step_cb(lv_map(a->act_time, 0, a->time, 0, LV_BEZIER_VAL_MAX));
     }
 
-    last_timer_run = lv_tick_get();
+    return path_interpolate(a, cache->step);
+}
+
+/*Get the value proportional to `step` between the start and end values*/
+static int32_t path_interpolate(const lv_anim_t * a, int32_t step)
+{
+    int32_t new_value;
+    new_value = step * (a->end_value - a->start_value);
+    new_value = new_value >> LV_BEZIER_VAL_SHIFT;
+    new_value += a->start_value;
+
+    return new_value;
+}
+
+static int32_t path_step_linear(int32_t t)
+{
+    return t;
+}
+
+static int32_t path_step_ease_in(int32_t t)
+{
+    return lv_bezier3(t, 0, 50, 100, LV_BEZIER_VAL_MAX);
+}
+
+static int32_t path_step_ease_out(int32_t t)
+{
+    return lv_bezier3(t, 0, 900, 950, LV_BEZIER_VAL_MAX);
+}
+
+static int32_t path_step_ease_in_out(int32_t t)
+{
+    return lv_bezier3(t, 0, 50, 952, LV_BEZIER_VAL_MAX);
+}
+
+static int32_t path_step_overshoot(int32_t t)
+{
+    return lv_bezier3(t, 0, 1000, 1300, LV_BEZIER_VAL_MAX);
 }
 
 /**
  * Called when an animation is ready to do the necessary thinks
  * e.g. repeat, play back, delete etc.
- * @param a pointer to an animation descriptor
+ * @param i index of the animation in the table
  */
-static void anim_ready_handler(lv_anim_t * a)
+static void anim_ready_handler(uint32_t i)
 {
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    lv_anim_t * a = table->entries[i].anim;
+
     /*In the end of a forward anim decrement repeat cnt.*/
     if(a->playback_now == 0 && a->repeat_cnt > 0 && a->repeat_cnt != LV_ANIM_REPEAT_INFINITE) {
         a->repeat_cnt--;
@@ -427,16 +511,14 @@ static void anim_ready_handler(lv_anim_t * a)
      * - no repeat, play back is enabled and play back is ready*/
     if(a->repeat_cnt == 0 && (a->playback_time == 0 || a->playback_now == 1)) {
 
-        /*Delete the animation from the list.
+        /*Delete the animation from the table.
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
-        _lv_ll_remove(&LV_GC_ROOT(_lv_anim_ll), a);
-        /*Flag that the list has changed*/
-        anim_mark_list_change();
+        anim_table_remove(i);
 
         /*Call the callback function at the end*/
         if(a->ready_cb != NULL) a->ready_cb(a);
         if(a->deleted_cb != NULL) a->deleted_cb(a);
-        lv_mem_free(a);
+        lv_slab_free(&table->slab, a);
     }
     /*If the animation is not deleted then restart it*/
     else {
@@ -460,11 +542,83 @@ static void anim_ready_handler(lv_anim_t * a)
     }
 }
 
-static void anim_mark_list_change(void)
+static void anim_update_timer(void)
 {
-    anim_list_changed = true;
-    if(_lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll)) == NULL)
+    if(LV_GC_ROOT(_lv_anim_table).anim_cnt == 0)
         lv_timer_pause(_lv_anim_tmr);
     else
         lv_timer_resume(_lv_anim_tmr);
 }
+
+/**
+ * Add an animation to the end of the table. Grow the table if it's full.
+ * @param a pointer to an animation
+ * @return true: added; false: out of memory
+ */
+static bool anim_table_add(lv_anim_t * a)
+{
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+
+    if(table->cnt == table->size) {
+        anim_table_compact();
+        if(table->cnt == table->size) {
+            uint32_t new_size = table->size ? table->size * 2 : ANIM_TABLE_MIN_SIZE;
+            _lv_anim_table_entry_t * entries = lv_mem_realloc(table->entries, new_size * sizeof(_lv_anim_table_entry_t));
+            LV_ASSERT_MALLOC(entries);
+            if(entries == NULL) return false;
+            table->entries = entries;
+            table->size = new_size;
+        }
+    }
+
+    _lv_anim_table_entry_t * e = &table->entries[table->cnt];
+    e->var = a->var;
+    e->exec_cb = a->exec_cb;
+    e->anim = a;
+    table->cnt++;
+    table->anim_cnt++;
+
+    anim_update_timer();
+    return true;
+}
+
+/**
+ * Mark an animation deleted in the table. It's removed from the table on the next compaction.
+ * @param i index of the animation in the table
+ */
+static void anim_table_remove(uint32_t i)
+{
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    table->entries[i].anim = NULL;
+    table->anim_cnt--;
+    anim_update_timer();
+}
+
+/**
+ * Remove the deleted animations from the table keeping the order of the others
+ * and shrink the table if it's mostly empty. Does nothing while the table is being iterated.
+ */
+static void anim_table_compact(void)
+{
+    _lv_anim_table_t * table = &LV_GC_ROOT(_lv_anim_table);
+    if(iter_depth > 0) return;
+
+    if(table->anim_cnt != table->cnt) {
+        uint32_t i;
+        uint32_t j = 0;
+        for(i = 0; i < table->cnt; i++) {
+            if(table->entries[i].anim) table->entries[j++] = table->entries[i];
+        }
+        table->cnt = j;
+    }
+
+    /*Keep the smallest table to not allocate it again and again when an animation starts*/
+    if(table->size > ANIM_TABLE_MIN_SIZE && table->cnt < table->size / 4) {
+        uint32_t new_size = table->size / 2;
+        _lv_anim_table_entry_t * entries = lv_mem_realloc(table->entries, new_size * sizeof(_lv_anim_table_entry_t));
+        if(entries) {
+            table->entries = entries;
+            table->size = new_size;
+        }
+    }
+}
@@ -18,6 +18,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "lv_slab.h"
 
 /*********************
  *      DEFINES
@@ -94,10 +95,25 @@ typedef struct _lv_anim_t {
 
     /*Animation system use these - user shouldn't set*/
     uint8_t playback_now : 1; /**< Play back is in progress*/
-    uint8_t run_round : 1;    /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;    /**< Indicates that the `start_cb` was already called*/
 } lv_anim_t;
 
+/** An element of the animation table*/
+typedef struct {
+    void * var;                         /**< `var` of the animation to find it without reading the animation*/
+    lv_anim_exec_xcb_t exec_cb;         /**< `exec_cb` of the animation*/
+    lv_anim_t * anim;                   /**< The animation or NULL if it was deleted since the last compaction*/
+} _lv_anim_table_entry_t;
+
+/** The running animations. Internally used by the library, you should not need to touch it.*/
+typedef struct {
+    lv_slab_t slab;                     /**< The animations are allocated from it*/
+    _lv_anim_table_entry_t * entries;   /**< The animations in the order of starting them*/
+    uint32_t cnt;                       /**< Number of used entries, including the deleted ones*/
+    uint32_t size;                      /**< Number of allocated entries*/
+    uint32_t anim_cnt;                  /**< Number of running animations*/
+} _lv_anim_table_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -305,7 +321,8 @@ static inline void lv_anim_set_user_data(lv_anim_t * a, void * user_data)
 /**
  * Create an animation
  * @param a         an initialized 'anim_t' variable. Not required after call.
- * @return          pointer to the created animation (different from the `a` parameter)
+ * @return          pointer to the created animation (different from the `a` parameter).
+ *                  Its `var` and `exec_cb` shouldn't be changed while it's running.
  */
 lv_anim_t * lv_anim_start(const lv_anim_t * a);
 
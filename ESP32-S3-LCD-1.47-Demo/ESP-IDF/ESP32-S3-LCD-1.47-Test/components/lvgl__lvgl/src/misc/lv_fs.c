@@ -21,10 +21,20 @@
  *      TYPEDEFS
  **********************/
 
+/*Header of a block in the shared block cache. The data follows it.*/
+typedef struct {
+    uint32_t size;
+} block_head_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static const char * lv_fs_get_real_path(const char * path);
+static lv_fs_res_t read_at(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t fill_cache(lv_fs_file_t * file_p, uint32_t pos);
+static bool get_shared_block(lv_fs_file_t * file_p, uint32_t block_id, void * buf, uint32_t * size);
+static void set_shared_block(lv_fs_file_t * file_p, uint32_t block_id, const void * buf, uint32_t size);
+static void invalidate_cache(lv_fs_file_t * file_p, uint32_t start, uint32_t end);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,13 +100,24 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
 
     file_p->drv = drv;
     file_p->file_d = file_d;
+    file_p->map = NULL;
+    file_p->map_size = 0;
 
     if(drv->cache_size) {
         file_p->cache = lv_mem_alloc(sizeof(lv_fs_file_cache_t));
         LV_ASSERT_MALLOC(file_p->cache);
-        lv_memset_00(file_p->cache, sizeof(lv_fs_file_cache_t));
-        file_p->cache->start = UINT32_MAX;  /*Set an invalid range by default*/
-        file_p->cache->end = UINT32_MAX - 1;
+        lv_memset_00(file_p->cache, sizeof(lv_fs_file_cache_t));  /*The range is empty*/
+        file_p->cache->ahead_cnt = 1;
+
+        /*The key is the block index and the full path. Only the index will change.*/
+        if(LV_GC_ROOT(_lv_fs_block_cache)) {
+            size_t path_len = strlen(path);
+            file_p->cache->block_key = lv_mem_alloc(sizeof(uint32_t) + path_len);
+            if(file_p->cache->block_key) {
+                lv_memcpy(file_p->cache->block_key + sizeof(uint32_t), path, path_len);
+                file_p->cache->block_key_size = sizeof(uint32_t) + path_len;
+            }
+        }
     }
 
     return LV_FS_RES_OK;
@@ -112,6 +133,10 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
         return LV_FS_RES_NOT_IMP;
     }
 
+    if(file_p->map && file_p->drv->munmap_cb) {
+        file_p->drv->munmap_cb(file_p->drv, file_p->file_d, file_p->map, file_p->map_size);
+    }
+
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
     if(file_p->drv->cache_size && file_p->cache) {
@@ -119,84 +144,60 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
             lv_mem_free(file_p->cache->buffer);
         }
 
+        if(file_p->cache->block_key) {
+            lv_mem_free(file_p->cache->block_key);
+        }
+
         lv_mem_free(file_p->cache);
     }
 
-    file_p->file_d = NULL;
-    file_p->drv    = NULL;
-    file_p->cache  = NULL;
+    file_p->file_d   = NULL;
+    file_p->drv      = NULL;
+    file_p->cache    = NULL;
+    file_p->map      = NULL;
+    file_p->map_size = 0;
 
     return res;
 }
 
 static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, char * buf, uint32_t btr, uint32_t * br)
 {
+    lv_fs_file_cache_t * cache = file_p->cache;
+    uint32_t block_size = file_p->drv->cache_size;
     lv_fs_res_t res = LV_FS_RES_OK;
-    uint32_t file_position = file_p->cache->file_position;
-    uint32_t start = file_p->cache->start;
-    uint32_t end = file_p->cache->end;
-    char * buffer = file_p->cache->buffer;
-    uint16_t buffer_size = file_p->drv->cache_size;
-
-    if(start <= file_position && file_position < end) {
-        /* Data can be read from cache buffer */
-        uint16_t buffer_offset = file_position - start;
-        uint32_t buffer_remaining_length = LV_MIN((uint32_t)buffer_size - buffer_offset, (uint32_t)end - file_position);
-
-        if(btr <= buffer_remaining_length) {
-            /*Data is in cache buffer, and buffer end not reached, no need to read from FS*/
-            lv_memcpy(buf, buffer + buffer_offset, btr);
-            *br = btr;
-        }
-        else {
-            /*First part of data is in cache buffer, but we need to read rest of data from FS*/
-            lv_memcpy(buf, buffer + buffer_offset, buffer_remaining_length);
-
-            uint32_t bytes_read_to_buffer = 0;
-            if(btr > buffer_size) {
-                /*If remaining data chuck is bigger than buffer size, then do not use cache, instead read it directly from FS*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)(buf + buffer_remaining_length),
-                                           btr - buffer_remaining_length, &bytes_read_to_buffer);
-            }
-            else {
-                /*If remaining data chunk is smaller than buffer size, then read into cache buffer*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buffer, buffer_size, &bytes_read_to_buffer);
-                file_p->cache->start = file_p->cache->end;
-                file_p->cache->end = file_p->cache->start + bytes_read_to_buffer;
 
-                uint16_t data_chunk_remaining = LV_MIN(btr - buffer_remaining_length, bytes_read_to_buffer);
-                lv_memcpy(buf + buffer_remaining_length, buffer, data_chunk_remaining);
-            }
-            *br = LV_MIN(buffer_remaining_length + bytes_read_to_buffer, btr);
+    *br = 0;
+    while(btr > 0) {
+        uint32_t pos = cache->file_position;
+        if(cache->start <= pos && pos < cache->end) {
+            /*Copy what's in the buffer*/
+            uint32_t n = LV_MIN(btr, cache->end - pos);
+            lv_memcpy(buf, (char *)cache->buffer + (pos - cache->start), n);
+            buf += n;
+            btr -= n;
+            *br += n;
+            cache->file_position += n;
+            continue;
         }
-    }
-    else {
-        /*Data is not in cache buffer*/
-        if(btr > buffer_size) {
-            /*If bigger data is requested, then do not use cache, instead read it directly*/
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buf, btr, br);
-        }
-        else {
-            /*If small data is requested, then read from FS into cache buffer*/
-            if(buffer == NULL) {
-                file_p->cache->buffer = lv_mem_alloc(buffer_size);
-                LV_ASSERT_MALLOC(file_p->cache->buffer);
-                buffer = file_p->cache->buffer;
-            }
-
-            uint32_t bytes_read_to_buffer = 0;
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buffer, buffer_size, &bytes_read_to_buffer);
-            file_p->cache->start = file_position;
-            file_p->cache->end = file_p->cache->start + bytes_read_to_buffer;
-
-            *br = LV_MIN(btr, bytes_read_to_buffer);
-            lv_memcpy(buf, buffer, *br);
 
+        bool shared = cache->block_key != NULL;
+        if(btr >= block_size && (pos % block_size == 0 || !shared)) {
+            /*Large reads go directly into `buf`. Copying them through the buffer wouldn't help.
+             *Only whole blocks if they are shared, so that the next fills stay aligned to the blocks.*/
+            uint32_t n = shared ? btr - btr % block_size : btr;
+            uint32_t br_tmp = 0;
+            res = read_at(file_p, pos, buf, n, &br_tmp);
+            if(res != LV_FS_RES_OK) break;
+            buf += br_tmp;
+            btr -= br_tmp;
+            *br += br_tmp;
+            cache->file_position += br_tmp;
+            if(br_tmp < n) break;   /*End of file*/
+            continue;
         }
-    }
 
-    if(res == LV_FS_RES_OK) {
-        file_p->cache->file_position += *br;
+        res = fill_cache(file_p, pos);
+        if(res != LV_FS_RES_OK || cache->end <= pos) break;     /*Error or end of file*/
     }
 
     return res;
@@ -236,7 +237,32 @@ lv_fs_res_t lv_fs_write(lv_fs_file_t * file_p, const void * buf, uint32_t btw, u
     }
 
     uint32_t bw_tmp = 0;
-    lv_fs_res_t res = file_p->drv->write_cb(file_p->drv, file_p->file_d, buf, btw, &bw_tmp);
+    lv_fs_res_t res;
+    if(file_p->drv->cache_size) {
+        lv_fs_file_cache_t * cache = file_p->cache;
+        res = LV_FS_RES_OK;
+        if(cache->drv_position != cache->file_position) {
+            res = file_p->drv->seek_cb ? file_p->drv->seek_cb(file_p->drv, file_p->file_d, cache->file_position,
+                                                              LV_FS_SEEK_SET) : LV_FS_RES_NOT_IMP;
+            if(res == LV_FS_RES_OK) cache->drv_position = cache->file_position;
+        }
+
+        if(res == LV_FS_RES_OK) {
+            res = file_p->drv->write_cb(file_p->drv, file_p->file_d, buf, btw, &bw_tmp);
+            /*Don't read the old content from the caches*/
+            invalidate_cache(file_p, cache->file_position, cache->file_position + btw);
+            if(res == LV_FS_RES_OK) {
+                cache->file_position += bw_tmp;
+                cache->drv_position = cache->file_position;
+            }
+            else {
+                cache->drv_position = UINT32_MAX;   /*Unknown, seek before the next access*/
+            }
+        }
+    }
+    else {
+        res = file_p->drv->write_cb(file_p->drv, file_p->file_d, buf, btw, &bw_tmp);
+    }
     if(bw != NULL) *bw = bw_tmp;
 
     return res;
@@ -254,29 +280,19 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
 
     lv_fs_res_t res = LV_FS_RES_OK;
     if(file_p->drv->cache_size) {
+        /*The driver is seeked only before the next read or write that needs it*/
         switch(whence) {
             case LV_FS_SEEK_SET: {
                     file_p->cache->file_position = pos;
-
-                    /*FS seek if new position is outside cache buffer*/
-                    if(file_p->cache->file_position < file_p->cache->start || file_p->cache->file_position > file_p->cache->end) {
-                        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, file_p->cache->file_position, LV_FS_SEEK_SET);
-                    }
-
                     break;
                 }
             case LV_FS_SEEK_CUR: {
                     file_p->cache->file_position += pos;
-
-                    /*FS seek if new position is outside cache buffer*/
-                    if(file_p->cache->file_position < file_p->cache->start || file_p->cache->file_position > file_p->cache->end) {
-                        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, file_p->cache->file_position, LV_FS_SEEK_SET);
-                    }
-
                     break;
                 }
             case LV_FS_SEEK_END: {
                     /*Because we don't know the file size, we do a little trick: do a FS seek, then get new file position from FS*/
+                    file_p->cache->drv_position = UINT32_MAX;
                     res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, whence);
                     if(res == LV_FS_RES_OK) {
                         uint32_t tmp_position;
@@ -284,6 +300,7 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
 
                         if(res == LV_FS_RES_OK) {
                             file_p->cache->file_position = tmp_position;
+                            file_p->cache->drv_position = tmp_position;
                         }
                     }
                     break;
@@ -321,6 +338,21 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+const void * lv_fs_mmap(lv_fs_file_t * file_p, uint32_t * size)
+{
+    if(size) *size = 0;
+    if(file_p->drv == NULL || file_p->drv->mmap_cb == NULL) return NULL;
+
+    /*Map only once, the next calls return the same memory*/
+    if(file_p->map == NULL) {
+        file_p->map = file_p->drv->mmap_cb(file_p->drv, file_p->file_d, &file_p->map_size);
+        if(file_p->map == NULL) file_p->map_size = 0;
+    }
+
+    if(size) *size = file_p->map_size;
+    return file_p->map;
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -500,10 +532,170 @@ const char * lv_fs_get_last(const char * path)
 
     return &path[i + 1];
 }
+void lv_fs_set_block_cache_size(size_t size)
+{
+    lv_lru_budget_t * budget = NULL;
+    if(LV_GC_ROOT(_lv_fs_block_cache)) {
+        budget = LV_GC_ROOT(_lv_fs_block_cache)->budget;
+        lv_lru_del(LV_GC_ROOT(_lv_fs_block_cache));
+        LV_GC_ROOT(_lv_fs_block_cache) = NULL;
+    }
+
+    if(size == 0) return;
+
+    LV_GC_ROOT(_lv_fs_block_cache) = lv_lru_create(size, 512, NULL, NULL);
+    LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_fs_block_cache));
+    if(LV_GC_ROOT(_lv_fs_block_cache) && budget) lv_lru_set_budget(LV_GC_ROOT(_lv_fs_block_cache), budget);
+}
+
+lv_lru_t * lv_fs_get_block_cache(void)
+{
+    return LV_GC_ROOT(_lv_fs_block_cache);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Read from a position of a cached file. The driver is seeked only if it's not there already.
+ * @param file_p    pointer to a file with cache
+ * @param pos       position to read from
+ * @param buf       store the data here
+ * @param btr       Bytes To Read
+ * @param br        the number of real read bytes
+ * @return          LV_FS_RES_OK or any error from 'fs_res_t'
+ */
+static lv_fs_res_t read_at(lv_fs_file_t * file_p, uint32_t pos, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_fs_res_t res;
+    *br = 0;
+    if(cache->drv_position != pos) {
+        if(file_p->drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
+        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, LV_FS_SEEK_SET);
+        if(res != LV_FS_RES_OK) return res;
+        cache->drv_position = pos;
+    }
+
+    res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, br);
+    if(res == LV_FS_RES_OK) cache->drv_position += *br;
+    else cache->drv_position = UINT32_MAX;      /*Unknown, seek before the next read*/
+
+    return res;
+}
+
+/**
+ * Load the block of a position into the buffer. If the block follows the previous one,
+ * the reading is sequential and more and more blocks are read ahead at once.
+ * @param file_p    pointer to a file with cache
+ * @param pos       the position to load
+ * @return          LV_FS_RES_OK or any error from 'fs_res_t'
+ */
+static lv_fs_res_t fill_cache(lv_fs_file_t * file_p, uint32_t pos)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    uint32_t block_size = file_p->drv->cache_size;
+    uint32_t max_block_cnt = LV_MAX(file_p->drv->cache_block_cnt, 1);
+    /*Shared blocks need to be aligned. Else start at `pos` to read the most useful bytes with one call.*/
+    bool shared = cache->block_key != NULL;
+    uint32_t block_start = shared ? pos - pos % block_size : pos;
+
+    if(block_start == cache->end && cache->start != cache->end) {
+        cache->ahead_cnt = LV_MIN(cache->ahead_cnt * 2, max_block_cnt);
+    }
+    else {
+        cache->ahead_cnt = 1;
+    }
+
+    if(cache->buffer == NULL) {
+        cache->buffer = lv_mem_alloc(max_block_cnt * block_size);
+        LV_ASSERT_MALLOC(cache->buffer);
+        if(cache->buffer == NULL) return LV_FS_RES_OUT_OF_MEM;
+    }
+
+    cache->start = block_start;
+    cache->end = block_start;
+
+    /*Another open file might have read it already*/
+    uint32_t size;
+    if(shared && get_shared_block(file_p, block_start / block_size, cache->buffer, &size)) {
+        cache->end = block_start + size;
+        return LV_FS_RES_OK;
+    }
+
+    uint32_t br = 0;
+    lv_fs_res_t res = read_at(file_p, block_start, cache->buffer, cache->ahead_cnt * block_size, &br);
+    if(res != LV_FS_RES_OK) return res;
+    cache->end = block_start + br;
+
+    uint32_t i;
+    for(i = 0; shared && i * block_size < br; i++) {
+        set_shared_block(file_p, block_start / block_size + i, (char *)cache->buffer + i * block_size,
+                         LV_MIN(block_size, br - i * block_size));
+    }
+
+    return LV_FS_RES_OK;
+}
+
+static bool get_shared_block(lv_fs_file_t * file_p, uint32_t block_id, void * buf, uint32_t * size)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_lru_t * lru = LV_GC_ROOT(_lv_fs_block_cache);
+    if(lru == NULL || cache->block_key == NULL) return false;
+
+    lv_memcpy(cache->block_key, &block_id, sizeof(block_id));
+    block_head_t * block;
+    lv_lru_get(lru, cache->block_key, cache->block_key_size, (void **)&block);
+    if(block == NULL) return false;
+
+    *size = block->size;
+    lv_memcpy(buf, block + 1, block->size);
+    return true;
+}
+
+static void set_shared_block(lv_fs_file_t * file_p, uint32_t block_id, const void * buf, uint32_t size)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    lv_lru_t * lru = LV_GC_ROOT(_lv_fs_block_cache);
+    if(lru == NULL || cache->block_key == NULL) return;
+
+    block_head_t * block = lv_mem_alloc(sizeof(block_head_t) + size);
+    if(block == NULL) return;
+    block->size = size;
+    lv_memcpy(block + 1, buf, size);
+
+    lv_memcpy(cache->block_key, &block_id, sizeof(block_id));
+    if(lv_lru_set(lru, cache->block_key, cache->block_key_size, block, sizeof(block_head_t) + size) != LV_LRU_OK) {
+        lv_mem_free(block);
+    }
+}
+
+/**
+ * Drop the cached bytes of a range from the buffer and from the shared block cache
+ * @param file_p    pointer to a file with cache
+ * @param start     first position of the range
+ * @param end       the position after the range
+ */
+static void invalidate_cache(lv_fs_file_t * file_p, uint32_t start, uint32_t end)
+{
+    lv_fs_file_cache_t * cache = file_p->cache;
+    if(start < cache->end && cache->start < end) {
+        cache->start = 0;
+        cache->end = 0;
+    }
+
+    lv_lru_t * lru = LV_GC_ROOT(_lv_fs_block_cache);
+    if(lru == NULL || cache->block_key == NULL || start >= end) return;
+
+    uint32_t block_size = file_p->drv->cache_size;
+    uint32_t block_id;
+    for(block_id = start / block_size; block_id <= (end - 1) / block_size; block_id++) {
+        lv_memcpy(cache->block_key, &block_id, sizeof(block_id));
+        lv_lru_remove(lru, cache->block_key, cache->block_key_size);
+    }
+}
+
 /**
  * Skip the driver letter and the possible : after the letter
  * @param path path string (E.g. S:/folder/file.txt)
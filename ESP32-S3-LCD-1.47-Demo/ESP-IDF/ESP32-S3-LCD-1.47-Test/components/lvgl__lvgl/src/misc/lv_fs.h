@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../lv_conf_internal.h"
+#include "lv_lru.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -68,7 +69,8 @@ typedef enum {
 
 typedef struct _lv_fs_drv_t {
     char letter;
-    uint16_t cache_size;
+    uint16_t cache_size;        /**< Size of a cached block in bytes. 0: no caching.*/
+    uint8_t cache_block_cnt;    /**< Up to this many blocks are read at once on sequential reads. 0 or 1: one.*/
     bool (*ready_cb)(struct _lv_fs_drv_t * drv);
 
     void * (*open_cb)(struct _lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
@@ -78,6 +80,12 @@ typedef struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /** Optional. Return the whole content of the file in memory (e.g. flash mapped to the address space)
+     *  and store its size in `size`. NULL if the file can't be mapped.*/
+    const void * (*mmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, uint32_t * size);
+    /** Optional. Release the memory returned by `mmap_cb`. Called before `close_cb`.*/
+    void (*munmap_cb)(struct _lv_fs_drv_t * drv, void * file_p, const void * addr, uint32_t size);
+
     void * (*dir_open_cb)(struct _lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(struct _lv_fs_drv_t * drv, void * rddir_p, char * fn);
     lv_fs_res_t (*dir_close_cb)(struct _lv_fs_drv_t * drv, void * rddir_p);
@@ -88,16 +96,22 @@ typedef struct _lv_fs_drv_t {
 } lv_fs_drv_t;
 
 typedef struct {
-    uint32_t start;
+    uint32_t start;             /**< The buffer holds the bytes `start..end-1`. Block aligned if the blocks are shared.*/
     uint32_t end;
     uint32_t file_position;
-    void * buffer;
+    uint32_t drv_position;      /**< The position of the driver. It's seeked only before reads and writes.*/
+    void * buffer;              /**< `cache_block_cnt` blocks*/
+    uint8_t * block_key;        /**< Block index and path to find the blocks in the shared block cache*/
+    uint16_t block_key_size;
+    uint8_t ahead_cnt;          /**< Number of blocks to read at once. Doubles on sequential reads.*/
 } lv_fs_file_cache_t;
 
 typedef struct {
     void * file_d;
     lv_fs_drv_t * drv;
     lv_fs_file_cache_t * cache;
+    const void * map;           /**< The content of the file if it was mapped by `lv_fs_mmap()`*/
+    uint32_t map_size;
 } lv_fs_file_t;
 
 typedef struct {
@@ -198,6 +212,16 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Get the whole content of a file in memory without copying it, if the driver supports it.
+ * E.g. images and fonts in a memory mapped flash can be used in place this way.
+ * The memory is valid until the file is closed. It mustn't be written.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param size      store the size of the file here. Can be NULL.
+ * @return          pointer to the content of the file or NULL if it can't be mapped
+ */
+const void * lv_fs_mmap(lv_fs_file_t * file_p, uint32_t * size);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
@@ -250,6 +274,20 @@ char * lv_fs_up(char * path);
  */
 const char * lv_fs_get_last(const char * path);
 
+/**
+ * Set the size of the block cache shared by the files of the drivers with `cache_size`.
+ * The blocks are found by the path of the file, so e.g. a file opened again is read from memory.
+ * Only the files opened after it use the cache.
+ * @param size      size of the cache in bytes, 0 to disable it
+ */
+void lv_fs_set_block_cache_size(size_t size);
+
+/**
+ * Get the shared block cache, e.g. to share a memory budget with other caches by `lv_lru_set_budget()`
+ * @return          the cache or NULL if it's disabled
+ */
+lv_lru_t * lv_fs_get_block_cache(void);
+
 /**********************
  *      MACROS
  **********************/
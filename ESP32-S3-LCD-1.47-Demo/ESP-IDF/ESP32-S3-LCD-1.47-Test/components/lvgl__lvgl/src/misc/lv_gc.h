@@ -17,11 +17,17 @@ extern "C" {
 #include <stdint.h>
 #include "lv_mem.h"
 #include "lv_ll.h"
+#include "lv_ilist.h"
+#include "lv_svec.h"
+#include "lv_slab.h"
+#include "lv_lru.h"
 #include "lv_timer.h"
+#include "lv_anim.h"
 #include "lv_types.h"
 #include "../draw/lv_img_cache.h"
 #include "../draw/lv_draw_mask.h"
 #include "../core/lv_obj_pos.h"
+#include "../core/lv_obj_class.h"
 
 /*********************
  *      DEFINES
@@ -32,6 +38,12 @@ extern "C" {
 #    define LV_IMG_CACHE_DEF            0
 #endif
 
+#if LV_OBJ_SLAB_CHUNK_SIZE
+#    define LV_OBJ_SLAB_DEF             1
+#else
+#    define LV_OBJ_SLAB_DEF             0
+#endif
+
 #define LV_DISPATCH(f, t, n)            f(t, n)
 #define LV_DISPATCH_COND(f, t, n, m, v) LV_CONCAT3(LV_DISPATCH, m, v)(f, t, n)
 
@@ -41,25 +53,30 @@ extern "C" {
 #define LV_DISPATCH11(f, t, n)          LV_DISPATCH(f, t, n)
 
 #define LV_ITERATE_ROOTS(f)                                                                            \
-    LV_DISPATCH(f, lv_ll_t, _lv_timer_ll) /*Linked list to store the lv_timers*/                       \
+    LV_DISPATCH(f, lv_ilist_t, _lv_timer_ll) /*Linked list of the lv_timers, the last created first*/  \
+    LV_DISPATCH(f, lv_slab_t, _lv_timer_slab) /*The lv_timers are allocated from it*/                  \
+    LV_DISPATCH(f, _lv_timer_heap_t, _lv_timer_heap) /*The scheduled lv_timers*/                       \
     LV_DISPATCH(f, lv_ll_t, _lv_disp_ll)  /*Linked list of display device*/                            \
     LV_DISPATCH(f, lv_ll_t, _lv_indev_ll) /*Linked list of input device*/                              \
     LV_DISPATCH(f, lv_ll_t, _lv_fsdrv_ll)                                                              \
-    LV_DISPATCH(f, lv_ll_t, _lv_anim_ll)                                                               \
+    LV_DISPATCH(f, lv_lru_t *, _lv_fs_block_cache) /*Blocks of files shared by the open files*/        \
+    LV_DISPATCH(f, _lv_anim_table_t, _lv_anim_table)                                                   \
     LV_DISPATCH(f, lv_ll_t, _lv_group_ll)                                                              \
-    LV_DISPATCH(f, lv_ll_t, _lv_img_decoder_ll)                                                        \
+    LV_DISPATCH(f, _lv_img_decoder_list_t, _lv_img_decoder_list)                                       \
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
+    LV_DISPATCH(f, lv_slab_t, _lv_obj_spec_attr_slab)                                                  \
+    LV_DISPATCH_COND(f, _lv_obj_slab_arr_t, _lv_obj_slabs, LV_OBJ_SLAB_DEF, 1)                         \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)                                                 \
-    LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
+    LV_DISPATCH_COND(f, lv_lru_t*, _lv_img_cache_lru, LV_IMG_CACHE_DEF, 1)                             \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
+    LV_DISPATCH(f, lv_mem_buf_arena_t, lv_mem_buf)                                                     \
     LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
     LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
     LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
-    LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
+    LV_DISPATCH(f, lv_lru_t * , _lv_grad_cache_lru)                                                    \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
 #define LV_DEFINE_ROOT(root_type, root_name) root_type root_name;
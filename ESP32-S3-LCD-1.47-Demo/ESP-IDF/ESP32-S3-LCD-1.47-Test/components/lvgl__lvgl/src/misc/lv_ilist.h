@@ -0,0 +1,142 @@
+/**
+ * @file lv_ilist.h
+ * Intrusive doubly linked list. The nodes are embedded into the elements so the list allocates nothing
+ * and the elements can come from any allocator, e.g. from an `lv_slab_t` to keep them together.
+ */
+
+#ifndef LV_ILIST_H
+#define LV_ILIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** A node to embed into the elements of the list*/
+typedef struct _lv_ilist_node_t {
+    struct _lv_ilist_node_t * prev;
+    struct _lv_ilist_node_t * next;
+} lv_ilist_node_t;
+
+/** Description of an intrusive list*/
+typedef struct {
+    lv_ilist_node_t * head;
+    lv_ilist_node_t * tail;
+    uint32_t cnt;
+} lv_ilist_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize an intrusive list
+ * @param list pointer to an `lv_ilist_t` variable
+ */
+static inline void _lv_ilist_init(lv_ilist_t * list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->cnt = 0;
+}
+
+/**
+ * Add a node as the new head of the list
+ * @param list pointer to an intrusive list
+ * @param node pointer to a node which is not in any list
+ */
+static inline void _lv_ilist_ins_head(lv_ilist_t * list, lv_ilist_node_t * node)
+{
+    node->prev = NULL;
+    node->next = list->head;
+    if(list->head) list->head->prev = node;
+    else list->tail = node;
+    list->head = node;
+    list->cnt++;
+}
+
+/**
+ * Add a node as the new tail of the list
+ * @param list pointer to an intrusive list
+ * @param node pointer to a node which is not in any list
+ */
+static inline void _lv_ilist_ins_tail(lv_ilist_t * list, lv_ilist_node_t * node)
+{
+    node->next = NULL;
+    node->prev = list->tail;
+    if(list->tail) list->tail->next = node;
+    else list->head = node;
+    list->tail = node;
+    list->cnt++;
+}
+
+/**
+ * Remove a node from the list. The element is not freed.
+ * @param list pointer to the intrusive list of `node`
+ * @param node pointer to a node in `list`
+ */
+static inline void _lv_ilist_remove(lv_ilist_t * list, lv_ilist_node_t * node)
+{
+    if(node->prev) node->prev->next = node->next;
+    else list->head = node->next;
+    if(node->next) node->next->prev = node->prev;
+    else list->tail = node->prev;
+    node->prev = NULL;
+    node->next = NULL;
+    list->cnt--;
+}
+
+/**
+ * Return the number of nodes in the list
+ * @param list pointer to an intrusive list
+ * @return number of nodes
+ */
+static inline uint32_t _lv_ilist_get_len(const lv_ilist_t * list)
+{
+    return list->cnt;
+}
+
+/**
+ * Check if a list is empty
+ * @param list pointer to an intrusive list
+ * @return true: the list is empty; false: not empty
+ */
+static inline bool _lv_ilist_is_empty(const lv_ilist_t * list)
+{
+    return list->head == NULL;
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+/** Get the element containing `node`. NULL node gives NULL.*/
+#define _LV_ILIST_ENTRY(node, type, member) \
+    ((node) ? (type *)(void *)((uint8_t *)(node) - offsetof(type, member)) : (type *)NULL)
+
+/** Iterate over the nodes from the head. The current node must not be removed.*/
+#define _LV_ILIST_READ(list, n) for(n = (list)->head; n != NULL; n = n->next)
+
+/** Iterate over the nodes from the head. The current node can be removed; `n_next` is used for that.*/
+#define _LV_ILIST_READ_SAFE(list, n, n_next) \
+    for(n = (list)->head; n != NULL && ((n_next = n->next), 1); n = n_next)
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
@@ -17,6 +17,8 @@
 /*********************
  *      DEFINES
  *********************/
+#define HASH_TABLE_MIN_SIZE 8
+#define HASH_TABLE_MAX_INIT_SIZE 1024
 
 /**********************
  *      TYPEDEFS
@@ -28,7 +30,12 @@ struct _lv_lru_item_t {
     size_t value_length;
     size_t key_length;
     uint64_t access_count;
-    struct _lv_lru_item_t * next;
+    struct _lv_lru_item_t * next;   /**< Next item in the hash bucket or in the free items*/
+    lv_ilist_node_t node;           /**< Node in `lru_list` while not pinned, in `removed_list` if removed while pinned*/
+    uint32_t hash;
+    uint16_t pin_cnt;
+    uint8_t removed : 1;            /**< Removed while pinned. It's freed by the last unpin.*/
+    uint8_t value_moved : 1;        /**< The value was passed to a new item with the same key, don't free it*/
 };
 
 /**********************
@@ -45,16 +52,43 @@ static uint32_t lv_lru_hash(lv_lru_t * cache, const void * key, uint32_t key_len
 /** compare a key against an existing item's key */
 static int lv_lru_cmp_keys(lv_lru_item_t * item, const void * key, uint32_t key_length);
 
-/** remove an item and push it to the free items queue */
-static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t * prev, lv_lru_item_t * item, uint32_t hash_index);
+/** find an item and the link pointing to it in its bucket */
+static lv_lru_item_t * lv_lru_find(lv_lru_t * cache, const void * key, size_t key_length, lv_lru_item_t *** link);
+
+/** remove an item from the hash table. Free it or let the last unpin free it. */
+static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t ** link, lv_lru_item_t * item);
+
+/** free the key and value of an item and push it to the free items queue */
+static void lv_lru_free_item(lv_lru_t * cache, lv_lru_item_t * item);
 
 /** pop an existing item off the free queue, or create a new one */
 static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache);
 
+/** mark an item as the most recently used */
+static void lv_lru_touch(lv_lru_t * cache, lv_lru_item_t * item);
+
+/** evict the least recently used items until `required` bytes and maybe a new item fits */
+static bool lv_lru_make_space(lv_lru_t * cache, size_t required, bool new_item);
+
+/** evict the least recently used not pinned item of a cache */
+static bool lv_lru_evict(lv_lru_t * cache);
+
+/** get the cache of a budget having the least recently used not pinned item */
+static lv_lru_t * lv_lru_budget_get_oldest(lv_lru_budget_t * budget);
+
+/** double the hash table if there are more items than buckets */
+static void lv_lru_grow(lv_lru_t * cache);
+
+static lv_lru_res_t lv_lru_set_item(lv_lru_t * cache, const void * key, size_t key_length, void * value,
+                                    size_t value_length, lv_lru_item_t ** pinned);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+/*Common clock of all caches to compare the items of the caches sharing a budget*/
+static uint64_t access_clock;
+
 /**********************
  *      MACROS
  **********************/
@@ -64,7 +98,12 @@ static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache);
 #define test_for_missing_cache()      error_for(!cache, LV_LRU_MISSING_CACHE)
 #define test_for_missing_key()        error_for(!key, LV_LRU_MISSING_KEY)
 #define test_for_missing_value()      error_for(!value || value_length == 0, LV_LRU_MISSING_VALUE)
-#define test_for_value_too_large()    error_for(value_length > cache->total_memory, LV_LRU_VALUE_TOO_LARGE)
+#define test_for_value_too_large()    error_for(value_length > cache->total_memory || \
+                                                (cache->budget && value_length > cache->budget->total_memory), \
+                                                LV_LRU_VALUE_TOO_LARGE)
+
+#define item_of_node(n)               _LV_ILIST_ENTRY(n, lv_lru_item_t, node)
+#define cache_used_memory(cache)      ((cache)->total_memory - (cache)->free_memory)
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -75,27 +114,34 @@ lv_lru_t * lv_lru_create(size_t cache_size, size_t average_length, lv_lru_free_t
 {
     // create the cache
     lv_lru_t * cache = (lv_lru_t *) lv_mem_alloc(sizeof(lv_lru_t));
-    lv_memset_00(cache, sizeof(lv_lru_t));
     if(!cache) {
         LV_LOG_WARN("LRU Cache unable to create cache object");
         return NULL;
     }
-    cache->hash_table_size = cache_size / average_length;
+    lv_memset_00(cache, sizeof(lv_lru_t));
+
+    // start with a power of 2 close to a guestimate of the number of slots required. It grows if needed.
+    size_t slot_cnt = average_length ? cache_size / average_length : 0;
+    cache->hash_table_size = HASH_TABLE_MIN_SIZE;
+    while(cache->hash_table_size < slot_cnt && cache->hash_table_size < HASH_TABLE_MAX_INIT_SIZE) {
+        cache->hash_table_size *= 2;
+    }
     cache->average_item_length = average_length;
     cache->free_memory = cache_size;
     cache->total_memory = cache_size;
     cache->seed = lv_rand(1, UINT32_MAX);
     cache->value_free = value_free ? value_free : lv_mem_free;
     cache->key_free = key_free ? key_free : lv_mem_free;
+    _lv_ilist_init(&cache->lru_list);
+    _lv_ilist_init(&cache->removed_list);
 
-    // size the hash table to a guestimate of the number of slots required (assuming a perfect hash)
     cache->items = (lv_lru_item_t **) lv_mem_alloc(sizeof(lv_lru_item_t *) * cache->hash_table_size);
-    lv_memset_00(cache->items, sizeof(lv_lru_item_t *) * cache->hash_table_size);
     if(!cache->items) {
         LV_LOG_WARN("LRU Cache unable to create cache hash table");
         lv_mem_free(cache);
         return NULL;
     }
+    lv_memset_00(cache->items, sizeof(lv_lru_item_t *) * cache->hash_table_size);
     return cache;
 }
 
@@ -104,6 +150,11 @@ void lv_lru_del(lv_lru_t * cache)
 {
     LV_ASSERT_NULL(cache);
 
+    /*Their holders would unpin them in the deleted cache*/
+    LV_ASSERT_MSG(cache->pinned_cnt == 0, "LRU Cache deleted with pinned items");
+
+    lv_lru_set_budget(cache, NULL);
+
     // free each of the cached items, and the hash table
     lv_lru_item_t * item = NULL, *next = NULL;
     uint32_t i = 0;
@@ -122,6 +173,17 @@ void lv_lru_del(lv_lru_t * cache)
         lv_mem_free(cache->items);
     }
 
+    // the removed items are not in the hash table
+    lv_ilist_node_t * node = cache->removed_list.head;
+    while(node) {
+        lv_ilist_node_t * node_next = node->next;
+        item = item_of_node(node);
+        if(!item->value_moved) cache->value_free(item->value);
+        cache->key_free(item->key);
+        lv_mem_free(item);
+        node = node_next;
+    }
+
     if(cache->free_items) {
         item = cache->free_items;
         while(item) {
@@ -138,54 +200,14 @@ void lv_lru_del(lv_lru_t * cache)
 
 lv_lru_res_t lv_lru_set(lv_lru_t * cache, const void * key, size_t key_length, void * value, size_t value_length)
 {
-    test_for_missing_cache();
-    test_for_missing_key();
-    test_for_missing_value();
-    test_for_value_too_large();
-
-    // see if the key already exists
-    uint32_t hash_index = lv_lru_hash(cache, key, key_length);
-    int required = 0;
-    lv_lru_item_t * item = NULL, *prev = NULL;
-    item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_length)) {
-        prev = item;
-        item = (lv_lru_item_t *) item->next;
-    }
-
-    if(item) {
-        // update the value and value_lengths
-        required = (int)(value_length - item->value_length);
-        cache->value_free(item->value);
-        item->value = value;
-        item->value_length = value_length;
-
-    }
-    else {
-        // insert a new item
-        item = lv_lru_pop_or_create_item(cache);
-        item->value = value;
-        item->key = lv_mem_alloc(key_length);
-        memcpy(item->key, key, key_length);
-        item->value_length = value_length;
-        item->key_length = key_length;
-        required = (int) value_length;
-
-        if(prev)
-            prev->next = item;
-        else
-            cache->items[hash_index] = item;
-    }
-    item->access_count = ++cache->access_count;
+    return lv_lru_set_item(cache, key, key_length, value, value_length, NULL);
+}
 
-    // remove as many items as necessary to free enough space
-    if(required > 0 && (size_t) required > cache->free_memory) {
-        while(cache->free_memory < (size_t) required)
-            lv_lru_remove_lru_item(cache);
-    }
-    cache->free_memory -= required;
-    return LV_LRU_OK;
+lv_lru_res_t lv_lru_set_pinned(lv_lru_t * cache, const void * key, size_t key_length, void * value,
+                               size_t value_length, lv_lru_item_t ** item)
+{
+    LV_ASSERT_NULL(item);
+    return lv_lru_set_item(cache, key, key_length, value, value_length, item);
 }
 
 
@@ -194,19 +216,15 @@ lv_lru_res_t lv_lru_get(lv_lru_t * cache, const void * key, size_t key_size, voi
     test_for_missing_cache();
     test_for_missing_key();
 
-    // loop until we find the item, or hit the end of a chain
-    uint32_t hash_index = lv_lru_hash(cache, key, key_size);
-    lv_lru_item_t * item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_size))
-        item = (lv_lru_item_t *) item->next;
-
+    lv_lru_item_t * item = lv_lru_find(cache, key, key_size, NULL);
     if(item) {
         *value = item->value;
-        item->access_count = ++cache->access_count;
+        cache->hit_cnt++;
+        lv_lru_touch(cache, item);
     }
     else {
         *value = NULL;
+        cache->miss_cnt++;
     }
 
     return LV_LRU_OK;
@@ -217,18 +235,10 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size)
     test_for_missing_cache();
     test_for_missing_key();
 
-    // loop until we find the item, or hit the end of a chain
-    lv_lru_item_t * item = NULL, *prev = NULL;
-    uint32_t hash_index = lv_lru_hash(cache, key, key_size);
-    item = cache->items[hash_index];
-
-    while(item && lv_lru_cmp_keys(item, key, key_size)) {
-        prev = item;
-        item = (lv_lru_item_t *) item->next;
-    }
-
+    lv_lru_item_t ** link;
+    lv_lru_item_t * item = lv_lru_find(cache, key, key_size, &link);
     if(item) {
-        lv_lru_remove_item(cache, prev, item, hash_index);
+        lv_lru_remove_item(cache, link, item);
     }
 
     return LV_LRU_OK;
@@ -236,32 +246,110 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size)
 
 void lv_lru_remove_lru_item(lv_lru_t * cache)
 {
-    lv_lru_item_t * min_item = NULL, *min_prev = NULL;
-    lv_lru_item_t * item = NULL, *prev = NULL;
-    uint32_t i = 0, min_index = -1;
-    uint64_t min_access_count = -1;
+    lv_lru_evict(cache);
+}
 
-    for(; i < cache->hash_table_size; i++) {
-        item = cache->items[i];
-        prev = NULL;
+lv_lru_item_t * lv_lru_pin(lv_lru_t * cache, const void * key, size_t key_size)
+{
+    LV_ASSERT_NULL(cache);
+    if(key == NULL) return NULL;
 
-        while(item) {
-            if(item->access_count < min_access_count || (int64_t) min_access_count == -1) {
-                min_access_count = item->access_count;
-                min_item = item;
-                min_prev = prev;
-                min_index = i;
+    lv_lru_item_t * item = lv_lru_find(cache, key, key_size, NULL);
+    if(item == NULL) {
+        cache->miss_cnt++;
+        return NULL;
+    }
+
+    cache->hit_cnt++;
+    lv_lru_touch(cache, item);
+    if(item->pin_cnt == 0) {
+        _lv_ilist_remove(&cache->lru_list, &item->node);
+        cache->pinned_cnt++;
+    }
+    item->pin_cnt++;
+    return item;
+}
+
+void lv_lru_unpin(lv_lru_t * cache, lv_lru_item_t * item)
+{
+    LV_ASSERT_NULL(cache);
+    LV_ASSERT_NULL(item);
+    LV_ASSERT(item->pin_cnt > 0);
+
+    item->pin_cnt--;
+    if(item->pin_cnt) return;
+
+    cache->pinned_cnt--;
+    if(item->removed) {
+        _lv_ilist_remove(&cache->removed_list, &item->node);
+        lv_lru_free_item(cache, item);
+    }
+    else {
+        _lv_ilist_ins_head(&cache->lru_list, &item->node);
+    }
+}
+
+void * lv_lru_item_get_value(const lv_lru_item_t * item)
+{
+    return item->value;
+}
+
+void lv_lru_remove_all(lv_lru_t * cache, lv_lru_match_t * match_cb, void * user_data)
+{
+    LV_ASSERT_NULL(cache);
+
+    uint32_t i;
+    for(i = 0; i < cache->hash_table_size; i++) {
+        lv_lru_item_t ** link = &cache->items[i];
+        while(*link) {
+            lv_lru_item_t * item = *link;
+            if(match_cb == NULL || match_cb(item->key, item->key_length, item->value, user_data)) {
+                lv_lru_remove_item(cache, link, item);  /*`link` points to the next item now*/
+            }
+            else {
+                link = &item->next;
             }
-            prev = item;
-            item = item->next;
         }
     }
+}
+
+void lv_lru_set_max_item_cnt(lv_lru_t * cache, uint32_t max_cnt)
+{
+    LV_ASSERT_NULL(cache);
 
-    if(min_item) {
-        lv_lru_remove_item(cache, min_prev, min_item, min_index);
+    cache->max_item_cnt = max_cnt;
+    while(max_cnt && cache->item_cnt > max_cnt) {
+        if(!lv_lru_evict(cache)) break;
     }
 }
 
+void lv_lru_budget_init(lv_lru_budget_t * budget, size_t size)
+{
+    lv_memset_00(budget, sizeof(lv_lru_budget_t));
+    budget->total_memory = size;
+    _lv_ilist_init(&budget->caches);
+}
+
+void lv_lru_set_budget(lv_lru_t * cache, lv_lru_budget_t * budget)
+{
+    LV_ASSERT_NULL(cache);
+
+    if(cache->budget) {
+        cache->budget->used_memory -= cache_used_memory(cache);
+        _lv_ilist_remove(&cache->budget->caches, &cache->budget_node);
+        cache->budget = NULL;
+    }
+
+    if(budget == NULL) return;
+
+    cache->budget = budget;
+    _lv_ilist_ins_tail(&budget->caches, &cache->budget_node);
+    budget->used_memory += cache_used_memory(cache);
+
+    /*Make the items fit. The pinned ones might still exceed the budget until they are unpinned.*/
+    lv_lru_make_space(cache, 0, false);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -271,10 +359,11 @@ static uint32_t lv_lru_hash(lv_lru_t * cache, const void * key, uint32_t key_len
     uint32_t m = 0x5bd1e995;
     uint32_t r = 24;
     uint32_t h = cache->seed ^ key_length;
-    char * data = (char *) key;
+    const uint8_t * data = (const uint8_t *) key;
 
     while(key_length >= 4) {
-        uint32_t k = *(uint32_t *) data;
+        uint32_t k;
+        lv_memcpy_small(&k, data, 4);   /*The key might be unaligned*/
         k *= m;
         k ^= k >> r;
         k *= m;
@@ -298,7 +387,7 @@ static uint32_t lv_lru_hash(lv_lru_t * cache, const void * key, uint32_t key_len
     h ^= h >> 13;
     h *= m;
     h ^= h >> 15;
-    return h % cache->hash_table_size;
+    return h;
 }
 
 static int lv_lru_cmp_keys(lv_lru_item_t * item, const void * key, uint32_t key_length)
@@ -311,18 +400,43 @@ static int lv_lru_cmp_keys(lv_lru_item_t * item, const void * key, uint32_t key_
     }
 }
 
-static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t * prev, lv_lru_item_t * item, uint32_t hash_index)
+static lv_lru_item_t * lv_lru_find(lv_lru_t * cache, const void * key, size_t key_length, lv_lru_item_t *** link)
 {
-    if(prev) {
-        prev->next = item->next;
+    uint32_t hash = lv_lru_hash(cache, key, key_length);
+    lv_lru_item_t ** l = &cache->items[hash & (cache->hash_table_size - 1)];
+
+    // loop until we find the item, or hit the end of a chain
+    while(*l && ((*l)->hash != hash || lv_lru_cmp_keys(*l, key, key_length))) {
+        l = &(*l)->next;
     }
-    else {
-        cache->items[hash_index] = (lv_lru_item_t *) item->next;
+
+    if(link) *link = l;
+    return *l;
+}
+
+static void lv_lru_remove_item(lv_lru_t * cache, lv_lru_item_t ** link, lv_lru_item_t * item)
+{
+    *link = item->next;
+    item->next = NULL;
+    cache->item_cnt--;
+
+    if(item->pin_cnt) {
+        /*Still in use, let the last unpin free it*/
+        item->removed = 1;
+        _lv_ilist_ins_head(&cache->removed_list, &item->node);
+        return;
     }
 
+    _lv_ilist_remove(&cache->lru_list, &item->node);
+    lv_lru_free_item(cache, item);
+}
+
+static void lv_lru_free_item(lv_lru_t * cache, lv_lru_item_t * item)
+{
     // free memory and update the free memory counter
     cache->free_memory += item->value_length;
-    cache->value_free(item->value);
+    if(cache->budget) cache->budget->used_memory -= item->value_length;
+    if(!item->value_moved) cache->value_free(item->value);
     cache->key_free(item->key);
 
     // push the item to the free items queue
@@ -338,12 +452,159 @@ static lv_lru_item_t * lv_lru_pop_or_create_item(lv_lru_t * cache)
     if(cache->free_items) {
         item = cache->free_items;
         cache->free_items = item->next;
-        lv_memset_00(item, sizeof(lv_lru_item_t));
     }
     else {
         item = (lv_lru_item_t *) lv_mem_alloc(sizeof(lv_lru_item_t));
-        lv_memset_00(item, sizeof(lv_lru_item_t));
+        if(item == NULL) return NULL;
     }
 
+    lv_memset_00(item, sizeof(lv_lru_item_t));
     return item;
 }
+
+static void lv_lru_touch(lv_lru_t * cache, lv_lru_item_t * item)
+{
+    item->access_count = ++access_clock;
+    cache->access_count = item->access_count;
+
+    if(item->pin_cnt == 0 && cache->lru_list.head != &item->node) {
+        _lv_ilist_remove(&cache->lru_list, &item->node);
+        _lv_ilist_ins_head(&cache->lru_list, &item->node);
+    }
+}
+
+static bool lv_lru_make_space(lv_lru_t * cache, size_t required, bool new_item)
+{
+    while(1) {
+        bool local = cache->free_memory < required ||
+                     (new_item && cache->max_item_cnt && cache->item_cnt >= cache->max_item_cnt);
+        bool global = cache->budget && cache->budget->used_memory + required > cache->budget->total_memory;
+        if(!local && !global) return true;
+
+        /*Free space in this cache, or in the cache of the budget having the oldest item*/
+        lv_lru_t * victim = local ? cache : lv_lru_budget_get_oldest(cache->budget);
+        if(victim == NULL || !lv_lru_evict(victim)) return false;
+    }
+}
+
+static bool lv_lru_evict(lv_lru_t * cache)
+{
+    lv_ilist_node_t * node = cache->lru_list.tail;
+    if(node == NULL) return false;
+
+    lv_lru_item_t * item = item_of_node(node);
+    lv_lru_item_t ** link = &cache->items[item->hash & (cache->hash_table_size - 1)];
+    while(*link != item) link = &(*link)->next;
+
+    lv_lru_remove_item(cache, link, item);
+    cache->evict_cnt++;
+    return true;
+}
+
+static lv_lru_t * lv_lru_budget_get_oldest(lv_lru_budget_t * budget)
+{
+    lv_lru_t * oldest = NULL;
+    uint64_t oldest_access = UINT64_MAX;
+    lv_ilist_node_t * n;
+    _LV_ILIST_READ(&budget->caches, n) {
+        lv_lru_t * cache = _LV_ILIST_ENTRY(n, lv_lru_t, budget_node);
+        lv_ilist_node_t * tail = cache->lru_list.tail;
+        if(tail && item_of_node(tail)->access_count < oldest_access) {
+            oldest_access = item_of_node(tail)->access_count;
+            oldest = cache;
+        }
+    }
+
+    return oldest;
+}
+
+static void lv_lru_grow(lv_lru_t * cache)
+{
+    if(cache->item_cnt <= cache->hash_table_size) return;
+
+    size_t new_size = cache->hash_table_size * 2;
+    lv_lru_item_t ** new_items = lv_mem_alloc(sizeof(lv_lru_item_t *) * new_size);
+    if(new_items == NULL) return;   /*Not a problem, the chains are just longer*/
+    lv_memset_00(new_items, sizeof(lv_lru_item_t *) * new_size);
+
+    uint32_t i;
+    for(i = 0; i < cache->hash_table_size; i++) {
+        lv_lru_item_t * item = cache->items[i];
+        while(item) {
+            lv_lru_item_t * next = item->next;
+            lv_lru_item_t ** bucket = &new_items[item->hash & (new_size - 1)];
+            item->next = *bucket;
+            *bucket = item;
+            item = next;
+        }
+    }
+
+    lv_mem_free(cache->items);
+    cache->items = new_items;
+    cache->hash_table_size = new_size;
+}
+
+static lv_lru_res_t lv_lru_set_item(lv_lru_t * cache, const void * key, size_t key_length, void * value,
+                                    size_t value_length, lv_lru_item_t ** pinned)
+{
+    test_for_missing_cache();
+    test_for_missing_key();
+    test_for_missing_value();
+    test_for_value_too_large();
+
+    // replace the item if the key already exists
+    lv_lru_item_t ** link;
+    lv_lru_item_t * item = lv_lru_find(cache, key, key_length, &link);
+    if(item) {
+        if(item->value == value) {
+            /*The new item takes over the value. A pinned old item still returns it but doesn't free
+             *or account it anymore.*/
+            item->value_moved = 1;
+            cache->free_memory += item->value_length;
+            if(cache->budget) cache->budget->used_memory -= item->value_length;
+            item->value_length = 0;
+        }
+        lv_lru_remove_item(cache, link, item);
+    }
+
+    // remove as many items as necessary to free enough space
+    if(!lv_lru_make_space(cache, value_length, true)) {
+        LV_LOG_WARN("LRU Cache: the pinned items don't let %d bytes to be freed", (int)value_length);
+        return LV_LRU_NO_SPACE;
+    }
+
+    item = lv_lru_pop_or_create_item(cache);
+    if(item == NULL) return LV_LRU_NO_SPACE;
+    item->key = lv_mem_alloc(key_length);
+    if(item->key == NULL) {
+        lv_mem_free(item);
+        return LV_LRU_NO_SPACE;
+    }
+    lv_memcpy(item->key, key, key_length);
+    item->key_length = key_length;
+    item->value = value;
+    item->value_length = value_length;
+    item->hash = lv_lru_hash(cache, key, key_length);
+
+    // insert it to its bucket and to the front of the lru list
+    lv_lru_item_t ** bucket = &cache->items[item->hash & (cache->hash_table_size - 1)];
+    item->next = *bucket;
+    *bucket = item;
+    cache->item_cnt++;
+    cache->free_memory -= value_length;
+    if(cache->budget) cache->budget->used_memory += value_length;
+
+    if(pinned) {
+        item->pin_cnt = 1;
+        cache->pinned_cnt++;
+        *pinned = item;
+    }
+    else {
+        _lv_ilist_ins_head(&cache->lru_list, &item->node);
+    }
+    item->access_count = ++access_clock;
+    cache->access_count = item->access_count;
+
+    lv_lru_grow(cache);
+    return LV_LRU_OK;
+}
@@ -17,9 +17,11 @@ extern "C" {
 #include "../lv_conf_internal.h"
 
 #include "lv_types.h"
+#include "lv_ilist.h"
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 
 /*********************
@@ -36,14 +38,26 @@ typedef enum {
     LV_LRU_MISSING_KEY,
     LV_LRU_MISSING_VALUE,
     LV_LRU_LOCK_ERROR,
-    LV_LRU_VALUE_TOO_LARGE
+    LV_LRU_VALUE_TOO_LARGE,
+    LV_LRU_NO_SPACE             /**< Not enough space can be freed because of the pinned items*/
 } lv_lru_res_t;
 
 typedef void (lv_lru_free_t)(void * v);
+typedef bool (lv_lru_match_t)(const void * key, size_t key_length, void * value, void * user_data);
 typedef struct _lv_lru_item_t lv_lru_item_t;
 
+/**
+ * Memory budget shared by several caches. If it's exceeded the least recently used
+ * not pinned item of all the caches is evicted.
+ */
+typedef struct _lv_lru_budget_t {
+    size_t total_memory;
+    size_t used_memory;
+    lv_ilist_t caches;
+} lv_lru_budget_t;
+
 typedef struct lv_lru_t {
-    lv_lru_item_t ** items;
+    lv_lru_item_t ** items;     /**< The hash table. The size is a power of 2 and it grows with the items*/
     uint64_t access_count;
     size_t free_memory;
     size_t total_memory;
@@ -53,6 +67,16 @@ typedef struct lv_lru_t {
     lv_lru_free_t * value_free;
     lv_lru_free_t * key_free;
     lv_lru_item_t * free_items;
+    lv_ilist_t lru_list;        /**< The not pinned items, the most recently used first*/
+    lv_ilist_t removed_list;    /**< The removed but still pinned items, freed by their last unpin*/
+    uint32_t item_cnt;
+    uint32_t pinned_cnt;        /**< Number of pinned items, including the removed ones*/
+    uint32_t max_item_cnt;      /**< 0: no limit*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    uint32_t evict_cnt;
+    lv_lru_budget_t * budget;
+    lv_ilist_node_t budget_node;
 } lv_lru_t;
 
 
@@ -63,6 +87,10 @@ typedef struct lv_lru_t {
 lv_lru_t * lv_lru_create(size_t cache_size, size_t average_length, lv_lru_free_t * value_free,
                          lv_lru_free_t * key_free);
 
+/**
+ * Delete a cache and free all of its items. No item can be pinned.
+ * @param cache         pointer to a cache
+ */
 void lv_lru_del(lv_lru_t * cache);
 
 lv_lru_res_t lv_lru_set(lv_lru_t * cache, const void * key, size_t key_length, void * value, size_t value_length);
@@ -77,6 +105,74 @@ lv_lru_res_t lv_lru_remove(lv_lru_t * cache, const void * key, size_t key_size);
  * @todo we can optimise this by finding the n lru items, where n = required_space / average_length
  */
 void lv_lru_remove_lru_item(lv_lru_t * cache);
+
+/**
+ * Add or replace an item like `lv_lru_set()` and pin it.
+ * @param cache         pointer to a cache
+ * @param key           pointer to the key
+ * @param key_length    size of the key in bytes
+ * @param value         the value. The cache frees it with `value_free` when the item is evicted.
+ * @param value_length  size of the value in bytes to account it in the budgets
+ * @param item          the pinned item is stored here
+ * @return              LV_LRU_OK or an error. On error the value is not taken by the cache.
+ */
+lv_lru_res_t lv_lru_set_pinned(lv_lru_t * cache, const void * key, size_t key_length, void * value,
+                               size_t value_length, lv_lru_item_t ** item);
+
+/**
+ * Find an item and pin it. A pinned item is not evicted, and if it's removed or replaced
+ * its value is freed only by the last `lv_lru_unpin()`.
+ * @param cache         pointer to a cache
+ * @param key           pointer to the key
+ * @param key_size      size of the key in bytes
+ * @return              the pinned item or NULL if the key is not in the cache
+ */
+lv_lru_item_t * lv_lru_pin(lv_lru_t * cache, const void * key, size_t key_size);
+
+/**
+ * Release a pinned item
+ * @param cache         pointer to the cache of the item
+ * @param item          pointer to a pinned item
+ */
+void lv_lru_unpin(lv_lru_t * cache, lv_lru_item_t * item);
+
+/**
+ * Get the value of an item
+ * @param item          pointer to a pinned item
+ * @return              the value
+ */
+void * lv_lru_item_get_value(const lv_lru_item_t * item);
+
+/**
+ * Remove the items selected by a callback
+ * @param cache         pointer to a cache
+ * @param match_cb      return true to remove the item. NULL to remove all items.
+ * @param user_data     passed to `match_cb`
+ */
+void lv_lru_remove_all(lv_lru_t * cache, lv_lru_match_t * match_cb, void * user_data);
+
+/**
+ * Limit the number of items. The least recently used ones are evicted if there are more.
+ * @param cache         pointer to a cache
+ * @param max_cnt       the maximum number of items or 0 for no limit
+ */
+void lv_lru_set_max_item_cnt(lv_lru_t * cache, uint32_t max_cnt);
+
+/**
+ * Initialize a memory budget to share between caches
+ * @param budget        pointer to an `lv_lru_budget_t` variable
+ * @param size          the budget in bytes
+ */
+void lv_lru_budget_init(lv_lru_budget_t * budget, size_t size);
+
+/**
+ * Make a cache use a shared budget besides its own size. The items already in the cache are
+ * accounted in the budget too and the oldest items are evicted if the budget is exceeded.
+ * @param cache         pointer to a cache
+ * @param budget        pointer to an initialized budget or NULL to leave the current budget
+ */
+void lv_lru_set_budget(lv_lru_t * cache, lv_lru_budget_t * budget);
+
 /**********************
  *      MACROS
  **********************/
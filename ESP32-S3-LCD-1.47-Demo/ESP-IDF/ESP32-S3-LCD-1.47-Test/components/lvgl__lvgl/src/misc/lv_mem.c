@@ -21,6 +21,14 @@
     #include LV_MEM_POOL_INCLUDE
 #endif
 
+#if _LV_MEM_SIMD
+    #if defined(__SSE2__)
+        #include <emmintrin.h>
+    #else
+        #include <arm_neon.h>
+    #endif
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -39,22 +47,125 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#define WORD_SIZE       sizeof(mem_word_t)
+#define WORD_MASK       (WORD_SIZE - 1)
+
+#if _LV_MEM_SIMD
+    #define SIMD_SIZE       16
+    #if defined(__SSE2__)
+        #define SIMD_LOAD(p)        _mm_loadu_si128((const __m128i *)(p))
+        #define SIMD_STORE(p, v)    _mm_storeu_si128((__m128i *)(p), v)
+        #define SIMD_SET(v)         _mm_set1_epi8((char)(v))
+    #else
+        #define SIMD_LOAD(p)        vld1q_u8((const uint8_t *)(p))
+        #define SIMD_STORE(p, v)    vst1q_u8((uint8_t *)(p), v)
+        #define SIMD_SET(v)         vdupq_n_u8(v)
+    #endif
+#endif
+
+/*On Xtensa the memcpy and memset of the C library (in ROM) are written in assembly and shift
+ *misaligned sources into place too. The 128 bit PIE registers of the ESP32-S3 are not saved on
+ *context switches by ESP-IDF 5.1, so they can't be used by the LVGL task and the draw workers.*/
+#if _LV_MEM_SIMD
+    #define MEMCPY_KERNEL   _lv_memcpy_simd
+    #define MEMSET_KERNEL   _lv_memset_simd
+#elif defined(__XTENSA__)
+    #define MEMCPY_KERNEL   memcpy
+    #define MEMSET_KERNEL   memset
+#else
+    #define MEMCPY_KERNEL   _lv_memcpy_word
+    #define MEMSET_KERNEL   _lv_memset_word
+#endif
+
+/*Order the updates of the statistics and of their sequence counter for the readers in other tasks*/
+#if defined(__GNUC__) || defined(__clang__)
+    #define STAT_FENCE_RELEASE()    __atomic_thread_fence(__ATOMIC_RELEASE)
+    #define STAT_FENCE_ACQUIRE()    __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#else
+    #define STAT_FENCE_RELEASE()
+    #define STAT_FENCE_ACQUIRE()
+#endif
+
+/*Give up reading consistent statistics after so many tries*/
+#define STAT_READ_TRY_CNT   16
+
+#define BUF_ALIGN(size)     (((size) + ALIGN_MASK) & ~((uint32_t)ALIGN_MASK))
+#define BUF_CHUNK_HEADER    BUF_ALIGN(sizeof(lv_mem_buf_chunk_t))
+#define BUF_TOP_NONE        UINT32_MAX
+
+/*Written after the temporal buffers to detect overflows*/
+#define BUF_CANARY          0xc3a55a3c
+#if LV_USE_ASSERT_MEM_INTEGRITY
+    #define BUF_CANARY_SIZE     sizeof(uint32_t)
+#else
+    #define BUF_CANARY_SIZE     0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_CUSTOM == 0
+typedef struct {
+    lv_tlsf_t tlsf;
+    const uint8_t * start;
+    const uint8_t * end;
+    lv_mem_stat_t stat;
+    volatile uint32_t stat_seq;     /*Odd while `stat` is being updated*/
+    lv_mem_hint_t hint;
+} mem_pool_t;
+#endif
+
+/*Accessed by the bulk memory kernels with any pointer type*/
+#if defined(__GNUC__)
+    typedef lv_uintptr_t __attribute__((__may_alias__)) mem_word_t;
+#else
+    typedef lv_uintptr_t mem_word_t;
+#endif
+
+#if _LV_MEM_SIMD
+    #if defined(__SSE2__)
+        typedef __m128i simd_t;
+    #else
+        typedef uint8x16_t simd_t;
+    #endif
+#endif
+
+/*Stored right before each temporal buffer*/
+typedef struct {
+    uint32_t prev;          /*Offset of the previous buffer in the chunk*/
+    uint32_t size : 31;
+    uint32_t released : 1;
+} buf_header_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_MEM_CUSTOM == 0
+    static bool pool_init(mem_pool_t * pool, void * mem, size_t size, lv_mem_hint_t hint);
+    static mem_pool_t * pool_find(const void * p);
+    static void * pool_alloc(size_t size, lv_mem_hint_t hint);
+    static void pool_stat_update(mem_pool_t * pool, size_t freed_size, size_t alloc_size);
+    static lv_res_t pool_stat_read(const mem_pool_t * pool, lv_mem_stat_t * stat);
+    static uint32_t size_class(size_t size);
+    static void stat_to_monitor(const lv_mem_stat_t * stat, lv_mem_monitor_t * mon_p);
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+static lv_mem_buf_chunk_t * buf_chunk_next(lv_mem_buf_chunk_t * act, uint32_t need);
+static void buf_pop_released(void);
+static void buf_chunks_free(lv_mem_buf_chunk_t * chunk);
+#if LV_USE_ASSERT_MEM_INTEGRITY
+    static bool buf_is_used(const void * p);
+    static bool buf_canary_ok(const buf_header_t * header);
+    static void buf_check_scope(lv_mem_buf_mark_t mark);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 #if LV_MEM_CUSTOM == 0
-    static lv_tlsf_t tlsf;
+    static mem_pool_t pools[LV_MEM_POOL_MAX_NUM];
+    static uint32_t pool_cnt;
     static uint32_t cur_used;
     static uint32_t max_used;
 #endif
@@ -70,11 +181,10 @@ static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variabl
     #define MEM_TRACE(...)
 #endif
 
-#define COPY32 *d32 = *s32; d32++; s32++;
+#define BUF_HEADER(chunk, ofs) ((buf_header_t *)((uint8_t *)(chunk) + BUF_CHUNK_HEADER + (ofs)))
+
 #define COPY8 *d8 = *s8; d8++; s8++;
-#define SET32(x) *d32 = x; d32++;
 #define SET8(x) *d8 = x; d8++;
-#define REPEAT8(expr) expr expr expr expr expr expr expr expr
 
 /**********************
  *   GLOBAL FUNCTIONS
@@ -89,15 +199,17 @@ void lv_mem_init(void)
 
 #if LV_MEM_ADR == 0
 #ifdef LV_MEM_POOL_ALLOC
-    tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE), LV_MEM_SIZE);
+    void * work_mem = (void *)LV_MEM_POOL_ALLOC(LV_MEM_SIZE);
 #else
     /*Allocate a large array to store the dynamically allocated data*/
     static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT work_mem_int[LV_MEM_SIZE / sizeof(MEM_UNIT)];
-    tlsf = lv_tlsf_create_with_pool((void *)work_mem_int, LV_MEM_SIZE);
+    void * work_mem = work_mem_int;
 #endif
 #else
-    tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
+    void * work_mem = (void *)LV_MEM_ADR;
 #endif
+    pool_init(&pools[0], work_mem, LV_MEM_SIZE, LV_MEM_HINT_DEFAULT);
+    pool_cnt = 1;
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -111,18 +223,80 @@ void lv_mem_init(void)
  */
 void lv_mem_deinit(void)
 {
+    lv_mem_buf_free_all();
+
 #if LV_MEM_CUSTOM == 0
-    lv_tlsf_destroy(tlsf);
+    uint32_t i;
+    for(i = 0; i < pool_cnt; i++) lv_tlsf_destroy(pools[i].tlsf);
+    lv_memset_00(pools, sizeof(pools));
+    pool_cnt = 0;
+    cur_used = 0;
+    max_used = 0;
     lv_mem_init();
 #endif
 }
 
+/**
+ * Add a memory area as a new pool
+ * @param mem pointer to the memory area. Should be aligned to 8 bytes.
+ * @param size size of the memory area in bytes
+ * @param hint the allocations with this hint are served from this pool first
+ * @return ID of the pool or -1 on error
+ */
+int32_t lv_mem_add_pool(void * mem, size_t size, lv_mem_hint_t hint)
+{
+#if LV_MEM_CUSTOM == 0
+    if(pool_cnt >= LV_MEM_POOL_MAX_NUM) {
+        LV_LOG_WARN("no more pools, increase LV_MEM_POOL_MAX_NUM");
+        return -1;
+    }
+
+    if(!pool_init(&pools[pool_cnt], mem, size, hint)) {
+        LV_LOG_WARN("couldn't create a pool of %lu bytes", (unsigned long)size);
+        return -1;
+    }
+
+    pool_cnt++;
+    return pool_cnt - 1;
+#else
+    LV_UNUSED(mem);
+    LV_UNUSED(size);
+    LV_UNUSED(hint);
+    LV_LOG_WARN("not supported with LV_MEM_CUSTOM");
+    return -1;
+#endif
+}
+
+/**
+ * Get the number of memory pools
+ * @return number of the pools including the default one with ID 0
+ */
+uint32_t lv_mem_get_pool_cnt(void)
+{
+#if LV_MEM_CUSTOM == 0
+    return pool_cnt;
+#else
+    return 0;
+#endif
+}
+
 /**
  * Allocate a memory dynamically
  * @param size size of the memory to allocate in bytes
  * @return pointer to the allocated memory
  */
 void * lv_mem_alloc(size_t size)
+{
+    return lv_mem_alloc_hint(size, LV_MEM_HINT_DEFAULT);
+}
+
+/**
+ * Allocate a memory dynamically from the pools added for a use.
+ * @param size size of the memory to allocate in bytes
+ * @param hint what the memory is used for, e.g. `LV_MEM_HINT_LARGE`
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_alloc_hint(size_t size, lv_mem_hint_t hint)
 {
     MEM_TRACE("allocating %lu bytes", (unsigned long)size);
     if(size == 0) {
@@ -131,8 +305,9 @@ void * lv_mem_alloc(size_t size)
     }
 
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    void * alloc = pool_alloc(size, hint);
 #else
+    LV_UNUSED(hint);
     void * alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
 
@@ -153,10 +328,6 @@ void * lv_mem_alloc(size_t size)
 #endif
 
     if(alloc) {
-#if LV_MEM_CUSTOM == 0
-        cur_used += size;
-        max_used = LV_MAX(cur_used, max_used);
-#endif
         MEM_TRACE("allocated at %p", alloc);
     }
     return alloc;
@@ -176,9 +347,9 @@ void lv_mem_free(void * data)
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
 #  endif
-    size_t size = lv_tlsf_free(tlsf, data);
-    if(cur_used > size) cur_used -= size;
-    else cur_used = 0;
+    mem_pool_t * pool = pool_find(data);
+    size_t size = lv_tlsf_free(pool->tlsf, data);
+    pool_stat_update(pool, size, 0);
 #else
     LV_MEM_CUSTOM_FREE(data);
 #endif
@@ -203,7 +374,18 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
 #if LV_MEM_CUSTOM == 0
-    void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
+    mem_pool_t * pool = pool_find(data_p);
+    size_t old_size = lv_tlsf_block_size(data_p);
+    void * new_p = lv_tlsf_realloc(pool->tlsf, data_p, new_size);
+    if(new_p) pool_stat_update(pool, old_size, lv_tlsf_block_size(new_p));
+    /*Move it to an other pool if it doesn't fit into its own*/
+    else if(pool_cnt > 1) {
+        new_p = pool_alloc(new_size, pool->hint);
+        if(new_p) {
+            lv_memcpy(new_p, data_p, LV_MIN(lv_tlsf_block_size(data_p), new_size));
+            lv_mem_free(data_p);
+        }
+    }
 #else
     void * new_p = LV_MEM_CUSTOM_REALLOC(data_p, new_size);
 #endif
@@ -224,14 +406,28 @@ lv_res_t lv_mem_test(void)
     }
 
 #if LV_MEM_CUSTOM == 0
-    if(lv_tlsf_check(tlsf)) {
-        LV_LOG_WARN("failed");
-        return LV_RES_INV;
-    }
+    uint32_t i;
+    for(i = 0; i < pool_cnt; i++) {
+        if(lv_tlsf_check(pools[i].tlsf)) {
+            LV_LOG_WARN("failed");
+            return LV_RES_INV;
+        }
 
-    if(lv_tlsf_check_pool(lv_tlsf_get_pool(tlsf))) {
-        LV_LOG_WARN("pool failed");
-        return LV_RES_INV;
+        if(lv_tlsf_check_pool(lv_tlsf_get_pool(pools[i].tlsf))) {
+            LV_LOG_WARN("pool failed");
+            return LV_RES_INV;
+        }
+
+        /*The statistics updated on the fly should describe the same blocks*/
+        lv_mem_monitor_t mon;
+        lv_memset_00(&mon, sizeof(mon));
+        lv_tlsf_walk_pool(lv_tlsf_get_pool(pools[i].tlsf), lv_mem_walker, &mon);
+        const lv_mem_stat_t * stat = &pools[i].stat;
+        if(mon.used_cnt != stat->used_cnt || mon.free_cnt != stat->free_cnt || mon.free_size != stat->free_size ||
+           mon.free_biggest_size < lv_tlsf_free_biggest_size(pools[i].tlsf)) {
+            LV_LOG_WARN("statistics failed");
+            return LV_RES_INV;
+        }
     }
 #endif
     MEM_TRACE("passed");
@@ -248,23 +444,87 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     /*Init the data*/
     lv_memset(mon_p, 0, sizeof(lv_mem_monitor_t));
 #if LV_MEM_CUSTOM == 0
-    MEM_TRACE("begin");
+    lv_mem_stat_t stat;
+    lv_mem_stat(&stat);
+    stat_to_monitor(&stat, mon_p);
+#endif
+}
 
-    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), lv_mem_walker, mon_p);
+/**
+ * Give information about a memory pool
+ * @param id ID of the pool. 0: the default pool, else returned by `lv_mem_add_pool()`
+ * @param mon_p pointer to a lv_mem_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_pool(uint32_t id, lv_mem_monitor_t * mon_p)
+{
+    lv_memset(mon_p, 0, sizeof(lv_mem_monitor_t));
+#if LV_MEM_CUSTOM == 0
+    lv_mem_stat_t stat;
+    if(id >= pool_cnt) return;
 
-    mon_p->total_size = LV_MEM_SIZE;
-    mon_p->used_pct = 100 - (100U * mon_p->free_size) / mon_p->total_size;
-    if(mon_p->free_size > 0) {
-        mon_p->frag_pct = mon_p->free_biggest_size * 100U / mon_p->free_size;
-        mon_p->frag_pct = 100 - mon_p->frag_pct;
-    }
-    else {
-        mon_p->frag_pct = 0; /*no fragmentation if all the RAM is used*/
+    lv_mem_stat_pool(id, &stat);
+    stat_to_monitor(&stat, mon_p);
+#else
+    LV_UNUSED(id);
+#endif
+}
+
+/**
+ * Get the statistics of the heap summed up for all the pools.
+ * It doesn't lock and can be called from any task, even while LVGL allocates.
+ * @param stat pointer to a `lv_mem_stat_t` variable to store the result
+ * @return LV_RES_OK: the values are consistent;
+ *         LV_RES_INV: a pool was being updated all the time, its values can be out of sync
+ */
+lv_res_t lv_mem_stat(lv_mem_stat_t * stat)
+{
+    lv_memset_00(stat, sizeof(lv_mem_stat_t));
+#if LV_MEM_CUSTOM == 0
+    lv_res_t res = LV_RES_OK;
+    uint32_t i;
+    for(i = 0; i < pool_cnt; i++) {
+        lv_mem_stat_t pool_stat;
+        if(pool_stat_read(&pools[i], &pool_stat) != LV_RES_OK) res = LV_RES_INV;
+
+        stat->total_size += pool_stat.total_size;
+        stat->used_size += pool_stat.used_size;
+        stat->used_cnt += pool_stat.used_cnt;
+        stat->free_size += pool_stat.free_size;
+        stat->free_cnt += pool_stat.free_cnt;
+        stat->free_biggest_size = LV_MAX(stat->free_biggest_size, pool_stat.free_biggest_size);
+        stat->alloc_total += pool_stat.alloc_total;
+        stat->free_total += pool_stat.free_total;
+        uint32_t c;
+        for(c = 0; c < LV_MEM_STAT_CLASS_NUM; c++) stat->size_class_cnt[c] += pool_stat.size_class_cnt[c];
     }
 
-    mon_p->max_used = max_used;
+    stat->max_used = max_used;
+    if(stat->free_size > 0) stat->frag_pct = 100 - stat->free_biggest_size * 100U / stat->free_size;
+    return res;
+#else
+    return LV_RES_INV;
+#endif
+}
+
+/**
+ * Get the statistics of a memory pool. Can be called from any task like `lv_mem_stat()`.
+ * @param id ID of the pool. 0: the default pool, else returned by `lv_mem_add_pool()`
+ * @param stat pointer to a `lv_mem_stat_t` variable to store the result
+ * @return LV_RES_OK: the values are consistent; LV_RES_INV: invalid `id` or the values can be out of sync
+ */
+lv_res_t lv_mem_stat_pool(uint32_t id, lv_mem_stat_t * stat)
+{
+    lv_memset_00(stat, sizeof(lv_mem_stat_t));
+#if LV_MEM_CUSTOM == 0
+    if(id >= pool_cnt) return LV_RES_INV;
 
-    MEM_TRACE("finished");
+    lv_res_t res = pool_stat_read(&pools[id], stat);
+    if(stat->free_size > 0) stat->frag_pct = 100 - stat->free_biggest_size * 100U / stat->free_size;
+    return res;
+#else
+    LV_UNUSED(id);
+    return LV_RES_INV;
 #endif
 }
 
@@ -279,50 +539,28 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
-    /*Try to find a free buffer with suitable size*/
-    int8_t i_guess = -1;
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0 && LV_GC_ROOT(lv_mem_buf[i]).size >= size) {
-            if(LV_GC_ROOT(lv_mem_buf[i]).size == size) {
-                LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-                return LV_GC_ROOT(lv_mem_buf[i]).p;
-            }
-            else if(i_guess < 0) {
-                i_guess = i;
-            }
-            /*If size of `i` is closer to `size` prefer it*/
-            else if(LV_GC_ROOT(lv_mem_buf[i]).size < LV_GC_ROOT(lv_mem_buf[i_guess]).size) {
-                i_guess = i;
-            }
-        }
-    }
-
-    if(i_guess >= 0) {
-        LV_GC_ROOT(lv_mem_buf[i_guess]).used = 1;
-        MEM_TRACE("returning already allocated buffer (buffer id: %d, address: %p)", i_guess,
-                  LV_GC_ROOT(lv_mem_buf[i_guess]).p);
-        return LV_GC_ROOT(lv_mem_buf[i_guess]).p;
+    uint32_t need = sizeof(buf_header_t) + BUF_ALIGN(size + BUF_CANARY_SIZE);
+    LV_GC_ROOT(lv_mem_buf).get_cnt++;
+    lv_mem_buf_chunk_t * chunk = LV_GC_ROOT(lv_mem_buf).act;
+    if(chunk == NULL || chunk->size - chunk->used < need) {
+        chunk = buf_chunk_next(chunk, need);
+        if(chunk == NULL) return NULL;
     }
 
-    /*Reallocate a free buffer*/
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).used == 0) {
-            /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
-            void * buf = lv_mem_realloc(LV_GC_ROOT(lv_mem_buf[i]).p, size);
-            LV_ASSERT_MSG(buf != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
-            if(buf == NULL) return NULL;
+    buf_header_t * header = BUF_HEADER(chunk, chunk->used);
+    header->prev = chunk->top;
+    header->size = size;
+    header->released = 0;
+    chunk->top = chunk->used;
+    chunk->used += need;
 
-            LV_GC_ROOT(lv_mem_buf[i]).used = 1;
-            LV_GC_ROOT(lv_mem_buf[i]).size = size;
-            LV_GC_ROOT(lv_mem_buf[i]).p    = buf;
-            MEM_TRACE("allocated (buffer id: %d, address: %p)", i, LV_GC_ROOT(lv_mem_buf[i]).p);
-            return LV_GC_ROOT(lv_mem_buf[i]).p;
-        }
-    }
+#if LV_USE_ASSERT_MEM_INTEGRITY
+    uint32_t canary = BUF_CANARY;
+    lv_memcpy_small((uint8_t *)(header + 1) + size, &canary, sizeof(canary));
+#endif
 
-    LV_LOG_ERROR("no more buffers. (increase LV_MEM_BUF_MAX_NUM)");
-    LV_ASSERT_MSG(false, "No more buffers. Increase LV_MEM_BUF_MAX_NUM.");
-    return NULL;
+    MEM_TRACE("allocated (address: %p)", (void *)(header + 1));
+    return header + 1;
 }
 
 /**
@@ -333,88 +571,155 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            return;
-        }
+    if(p == NULL) return;
+
+    buf_header_t * header = (buf_header_t *)p - 1;
+#if LV_USE_ASSERT_MEM_INTEGRITY
+    if(!buf_is_used(p)) {
+        LV_LOG_ERROR("p is not a known buffer or it was released already");
+        LV_ASSERT_MSG(false, "Release of an unknown temporal buffer");
+        return;
     }
+    LV_ASSERT_MSG(buf_canary_ok(header), "A temporal buffer was written past its end");
+#endif
+
+    header->released = 1;
+    buf_pop_released();
+}
+
+/**
+ * Save the current state of the buffer arena and start a new scope.
+ * @return the mark to pass to `lv_mem_buf_release_to()`
+ */
+lv_mem_buf_mark_t lv_mem_buf_mark(void)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    lv_mem_buf_mark_t mark;
+    mark.chunk = arena->act;
+    mark.used = arena->act ? arena->act->used : 0;
+    mark.top = arena->act ? arena->act->top : BUF_TOP_NONE;
+    mark.scope_chunk = arena->scope_chunk;
+    mark.scope_used = arena->scope_used;
+
+    arena->scope_chunk = mark.chunk;
+    arena->scope_used = mark.used;
+    arena->scope_depth++;
+    return mark;
+}
+
+/**
+ * Release all the buffers allocated since `mark` was taken at once and close its scope.
+ * @param mark a mark returned by `lv_mem_buf_mark()`
+ */
+void lv_mem_buf_release_to(lv_mem_buf_mark_t mark)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    if(arena->scope_depth > 0) arena->scope_depth--;
 
-    LV_LOG_ERROR("p is not a known buffer");
+    /*Nothing was allocated or the buffers were freed in the meantime*/
+    if(arena->first == NULL) return;
+
+#if LV_USE_ASSERT_MEM_INTEGRITY
+    buf_check_scope(mark);
+#endif
+
+    /*The chunks after the marked one remain as empty spare chunks*/
+    lv_mem_buf_chunk_t * chunk = mark.chunk ? mark.chunk : arena->first;
+    chunk->used = mark.used;
+    chunk->top = mark.top;
+    arena->act = chunk;
+    arena->scope_chunk = mark.scope_chunk;
+    arena->scope_used = mark.scope_used;
+
+    /*Buffers of the outer scope might have been released in the meantime*/
+    buf_pop_released();
 }
 
 /**
- * Free all memory buffers
+ * Free all memory buffers, including the chunk kept for the next buffers
  */
 void lv_mem_buf_free_all(void)
 {
-    for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
-        if(LV_GC_ROOT(lv_mem_buf[i]).p) {
-            lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
-            LV_GC_ROOT(lv_mem_buf[i]).p = NULL;
-            LV_GC_ROOT(lv_mem_buf[i]).used = 0;
-            LV_GC_ROOT(lv_mem_buf[i]).size = 0;
-        }
-    }
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    buf_chunks_free(arena->first);
+
+    /*Keep the statistics*/
+    uint32_t get_cnt = arena->get_cnt;
+    uint32_t chunk_alloc_cnt = arena->chunk_alloc_cnt;
+    lv_memset_00(arena, sizeof(lv_mem_buf_arena_t));
+    arena->get_cnt = get_cnt;
+    arena->chunk_alloc_cnt = chunk_alloc_cnt;
 }
 
-#if LV_MEMCPY_MEMSET_STD == 0
 /**
- * Same as `memcpy` but optimized for 4 byte operation.
+ * Copy with the widest integer type. If the source is misaligned to the destination
+ * aligned source words are read and shifted together. Only the bytes of the source are read.
  * @param dst pointer to the destination buffer
  * @param src pointer to the source buffer
  * @param len number of byte to copy
  */
-void * LV_ATTRIBUTE_FAST_MEM lv_memcpy(void * dst, const void * src, size_t len)
+void * LV_ATTRIBUTE_FAST_MEM _lv_memcpy_word(void * dst, const void * src, size_t len)
 {
     uint8_t * d8 = dst;
     const uint8_t * s8 = src;
 
-    lv_uintptr_t d_align = (lv_uintptr_t)d8 & ALIGN_MASK;
-    lv_uintptr_t s_align = (lv_uintptr_t)s8 & ALIGN_MASK;
-
-    /*Byte copy for unaligned memories*/
-    if(s_align != d_align) {
-        while(len > 32) {
-            REPEAT8(COPY8);
-            REPEAT8(COPY8);
-            REPEAT8(COPY8);
-            REPEAT8(COPY8);
-            len -= 32;
-        }
-        while(len) {
-            COPY8
-            len--;
-        }
-        return dst;
-    }
-
-    /*Make the memories aligned*/
-    if(d_align) {
-        d_align = ALIGN_MASK + 1 - d_align;
-        while(d_align && len) {
+    if(len >= 2 * WORD_SIZE) {
+        /*Make the destination aligned*/
+        while((lv_uintptr_t)d8 & WORD_MASK) {
             COPY8;
-            d_align--;
             len--;
         }
-    }
 
-    uint32_t * d32 = (uint32_t *)d8;
-    const uint32_t * s32 = (uint32_t *)s8;
-    while(len > 32) {
-        REPEAT8(COPY32)
-        len -= 32;
-    }
+        mem_word_t * dw = (mem_word_t *)d8;
+        lv_uintptr_t s_align = (lv_uintptr_t)s8 & WORD_MASK;
+        if(s_align == 0) {
+            const mem_word_t * sw = (const mem_word_t *)s8;
+            while(len >= 4 * WORD_SIZE) {
+                dw[0] = sw[0];
+                dw[1] = sw[1];
+                dw[2] = sw[2];
+                dw[3] = sw[3];
+                dw += 4;
+                sw += 4;
+                len -= 4 * WORD_SIZE;
+            }
 
-    while(len > 4) {
-        COPY32;
-        len -= 4;
+            while(len >= WORD_SIZE) {
+                *dw = *sw;
+                dw++;
+                sw++;
+                len -= WORD_SIZE;
+            }
+            s8 = (const uint8_t *)sw;
+        }
+#if LV_BIG_ENDIAN_SYSTEM == 0
+        else {
+            /*Read the bytes up to the first aligned source word one by one, the aligned word around
+             *them starts before the source. Stop one word earlier to not read after the end of the source.*/
+            const uint32_t shr = s_align * 8;
+            const uint32_t shl = WORD_SIZE * 8 - shr;
+            mem_word_t w0 = 0;
+            lv_uintptr_t i;
+            for(i = s_align; i < WORD_SIZE; i++) {
+                w0 |= (mem_word_t)s8[i - s_align] << (i * 8);
+            }
+            const mem_word_t * sw = (const mem_word_t *)((lv_uintptr_t)s8 & ~(lv_uintptr_t)WORD_MASK);
+            while(len >= 2 * WORD_SIZE) {
+                sw++;
+                mem_word_t w1 = *sw;
+                *dw = (w0 >> shr) | (w1 << shl);
+                dw++;
+                w0 = w1;
+                len -= WORD_SIZE;
+            }
+            s8 = (const uint8_t *)sw + s_align;
+        }
+#endif
+        d8 = (uint8_t *)dw;
     }
 
-    d8 = (uint8_t *)d32;
-    s8 = (const uint8_t *)s32;
     while(len) {
-        COPY8
+        COPY8;
         len--;
     }
 
@@ -422,132 +727,310 @@ void * LV_ATTRIBUTE_FAST_MEM lv_memcpy(void * dst, const void * src, size_t len)
 }
 
 /**
- * Same as `memset` but optimized for 4 byte operation.
+ * Set the memory with the widest integer type
  * @param dst pointer to the destination buffer
  * @param v value to set [0..255]
  * @param len number of byte to set
  */
-void LV_ATTRIBUTE_FAST_MEM lv_memset(void * dst, uint8_t v, size_t len)
+void LV_ATTRIBUTE_FAST_MEM _lv_memset_word(void * dst, uint8_t v, size_t len)
 {
+    uint8_t * d8 = dst;
 
-    uint8_t * d8 = (uint8_t *)dst;
-
-    uintptr_t d_align = (lv_uintptr_t) d8 & ALIGN_MASK;
-
-    /*Make the address aligned*/
-    if(d_align) {
-        d_align = ALIGN_MASK + 1 - d_align;
-        while(d_align && len) {
+    if(len >= 2 * WORD_SIZE) {
+        /*Make the destination aligned*/
+        while((lv_uintptr_t)d8 & WORD_MASK) {
             SET8(v);
             len--;
-            d_align--;
         }
-    }
-
-    uint32_t v32 = (uint32_t)v + ((uint32_t)v << 8) + ((uint32_t)v << 16) + ((uint32_t)v << 24);
 
-    uint32_t * d32 = (uint32_t *)d8;
-
-    while(len > 32) {
-        REPEAT8(SET32(v32));
-        len -= 32;
-    }
+        const mem_word_t vw = ((mem_word_t) -1 / 0xff) * v;
+        mem_word_t * dw = (mem_word_t *)d8;
+        while(len >= 4 * WORD_SIZE) {
+            dw[0] = vw;
+            dw[1] = vw;
+            dw[2] = vw;
+            dw[3] = vw;
+            dw += 4;
+            len -= 4 * WORD_SIZE;
+        }
 
-    while(len > 4) {
-        SET32(v32);
-        len -= 4;
+        while(len >= WORD_SIZE) {
+            *dw = vw;
+            dw++;
+            len -= WORD_SIZE;
+        }
+        d8 = (uint8_t *)dw;
     }
 
-    d8 = (uint8_t *)d32;
     while(len) {
         SET8(v);
         len--;
     }
 }
 
+#if _LV_MEM_SIMD
 /**
- * Same as `memset(dst, 0x00, len)` but optimized for 4 byte operation.
+ * Copy with 16 byte vectors. The first and last vectors are unaligned and overlap the others.
  * @param dst pointer to the destination buffer
- * @param len number of byte to set
+ * @param src pointer to the source buffer
+ * @param len number of byte to copy
  */
-void LV_ATTRIBUTE_FAST_MEM lv_memset_00(void * dst, size_t len)
+void * LV_ATTRIBUTE_FAST_MEM _lv_memcpy_simd(void * dst, const void * src, size_t len)
 {
-    uint8_t * d8 = (uint8_t *)dst;
-    uintptr_t d_align = (lv_uintptr_t) d8 & ALIGN_MASK;
+    if(len < SIMD_SIZE) return _lv_memcpy_word(dst, src, len);
 
-    /*Make the address aligned*/
-    if(d_align) {
-        d_align = ALIGN_MASK + 1 - d_align;
-        while(d_align && len) {
-            SET8(0);
-            len--;
-            d_align--;
-        }
+    uint8_t * d8 = dst;
+    const uint8_t * s8 = src;
+
+    /*Continue from the next aligned destination address*/
+    size_t head = SIMD_SIZE - ((lv_uintptr_t)d8 & (SIMD_SIZE - 1));
+    SIMD_STORE(d8, SIMD_LOAD(s8));
+    d8 += head;
+    s8 += head;
+    len -= head;
+
+    while(len >= 4 * SIMD_SIZE) {
+        simd_t v0 = SIMD_LOAD(s8);
+        simd_t v1 = SIMD_LOAD(s8 + SIMD_SIZE);
+        simd_t v2 = SIMD_LOAD(s8 + 2 * SIMD_SIZE);
+        simd_t v3 = SIMD_LOAD(s8 + 3 * SIMD_SIZE);
+        SIMD_STORE(d8, v0);
+        SIMD_STORE(d8 + SIMD_SIZE, v1);
+        SIMD_STORE(d8 + 2 * SIMD_SIZE, v2);
+        SIMD_STORE(d8 + 3 * SIMD_SIZE, v3);
+        d8 += 4 * SIMD_SIZE;
+        s8 += 4 * SIMD_SIZE;
+        len -= 4 * SIMD_SIZE;
     }
 
-    uint32_t * d32 = (uint32_t *)d8;
-    while(len > 32) {
-        REPEAT8(SET32(0));
-        len -= 32;
+    while(len >= SIMD_SIZE) {
+        SIMD_STORE(d8, SIMD_LOAD(s8));
+        d8 += SIMD_SIZE;
+        s8 += SIMD_SIZE;
+        len -= SIMD_SIZE;
     }
 
-    while(len > 4) {
-        SET32(0);
-        len -= 4;
+    if(len) SIMD_STORE(d8 + len - SIMD_SIZE, SIMD_LOAD(s8 + len - SIMD_SIZE));
+
+    return dst;
+}
+
+/**
+ * Set the memory with 16 byte vectors
+ * @param dst pointer to the destination buffer
+ * @param v value to set [0..255]
+ * @param len number of byte to set
+ */
+void LV_ATTRIBUTE_FAST_MEM _lv_memset_simd(void * dst, uint8_t v, size_t len)
+{
+    if(len < SIMD_SIZE) {
+        _lv_memset_word(dst, v, len);
+        return;
     }
 
-    d8 = (uint8_t *)d32;
-    while(len) {
-        SET8(0);
-        len--;
+    uint8_t * d8 = dst;
+    const simd_t vv = SIMD_SET(v);
+
+    size_t head = SIMD_SIZE - ((lv_uintptr_t)d8 & (SIMD_SIZE - 1));
+    SIMD_STORE(d8, vv);
+    d8 += head;
+    len -= head;
+
+    while(len >= 4 * SIMD_SIZE) {
+        SIMD_STORE(d8, vv);
+        SIMD_STORE(d8 + SIMD_SIZE, vv);
+        SIMD_STORE(d8 + 2 * SIMD_SIZE, vv);
+        SIMD_STORE(d8 + 3 * SIMD_SIZE, vv);
+        d8 += 4 * SIMD_SIZE;
+        len -= 4 * SIMD_SIZE;
     }
+
+    while(len >= SIMD_SIZE) {
+        SIMD_STORE(d8, vv);
+        d8 += SIMD_SIZE;
+        len -= SIMD_SIZE;
+    }
+
+    if(len) SIMD_STORE(d8 + len - SIMD_SIZE, vv);
+}
+#endif /*_LV_MEM_SIMD*/
+
+#if LV_MEMCPY_MEMSET_STD == 0
+/**
+ * Same as `memcpy` but uses the fastest kernel of the target: SIMD on hosts,
+ * the assembly routines of the C library on Xtensa, word copy elsewhere.
+ * @param dst pointer to the destination buffer
+ * @param src pointer to the source buffer
+ * @param len number of byte to copy
+ */
+void * LV_ATTRIBUTE_FAST_MEM lv_memcpy(void * dst, const void * src, size_t len)
+{
+    return MEMCPY_KERNEL(dst, src, len);
+}
+
+/**
+ * Same as `memset` but uses the fastest kernel of the target like `lv_memcpy()`.
+ * @param dst pointer to the destination buffer
+ * @param v value to set [0..255]
+ * @param len number of byte to set
+ */
+void LV_ATTRIBUTE_FAST_MEM lv_memset(void * dst, uint8_t v, size_t len)
+{
+    MEMSET_KERNEL(dst, v, len);
+}
+
+/**
+ * Same as `memset(dst, 0x00, len)` but uses the fastest kernel of the target
+ * @param dst pointer to the destination buffer
+ * @param len number of byte to set
+ */
+void LV_ATTRIBUTE_FAST_MEM lv_memset_00(void * dst, size_t len)
+{
+    MEMSET_KERNEL(dst, 0x00, len);
 }
 
 /**
- * Same as `memset(dst, 0xFF, len)` but optimized for 4 byte operation.
+ * Same as `memset(dst, 0xFF, len)` but uses the fastest kernel of the target
  * @param dst pointer to the destination buffer
  * @param len number of byte to set
  */
 void LV_ATTRIBUTE_FAST_MEM lv_memset_ff(void * dst, size_t len)
 {
-    uint8_t * d8 = (uint8_t *)dst;
-    uintptr_t d_align = (lv_uintptr_t) d8 & ALIGN_MASK;
+    MEMSET_KERNEL(dst, 0xFF, len);
+}
 
-    /*Make the address aligned*/
-    if(d_align) {
-        d_align = ALIGN_MASK + 1 - d_align;
-        while(d_align && len) {
-            SET8(0xFF);
-            len--;
-            d_align--;
+#endif /*LV_MEMCPY_MEMSET_STD*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_MEM_CUSTOM == 0
+static bool pool_init(mem_pool_t * pool, void * mem, size_t size, lv_mem_hint_t hint)
+{
+    lv_tlsf_t tlsf = lv_tlsf_create_with_pool(mem, size);
+    if(tlsf == NULL) return false;
+
+    lv_memset_00(pool, sizeof(mem_pool_t));
+    pool->tlsf = tlsf;
+    pool->start = mem;
+    pool->end = (uint8_t *)mem + size;
+    pool->hint = hint;
+    pool->stat.total_size = size;
+    pool_stat_update(pool, 0, 0);
+    return true;
+}
+
+/*Get the pool of an allocated memory*/
+static mem_pool_t * pool_find(const void * p)
+{
+    uint32_t i;
+    for(i = 1; i < pool_cnt; i++) {
+        if((const uint8_t *)p >= pools[i].start && (const uint8_t *)p < pools[i].end) return &pools[i];
+    }
+
+    return &pools[0];
+}
+
+/*Allocate from the pools of `hint` first and from the others if they are full*/
+static void * pool_alloc(size_t size, lv_mem_hint_t hint)
+{
+    uint32_t pass;
+    for(pass = 0; pass < 2; pass++) {
+        uint32_t i;
+        for(i = 0; i < pool_cnt; i++) {
+            if((pools[i].hint == hint) != (pass == 0)) continue;
+
+            void * p = lv_tlsf_malloc(pools[i].tlsf, size);
+            if(p == NULL) continue;
+
+            pool_stat_update(&pools[i], 0, lv_tlsf_block_size(p));
+            return p;
         }
     }
 
-    uint32_t * d32 = (uint32_t *)d8;
-    while(len > 32) {
-        REPEAT8(SET32(0xFFFFFFFF));
-        len -= 32;
+    return NULL;
+}
+
+/**
+ * Update the statistics of a pool after a block was freed and/or allocated.
+ * A realloc gives both sizes and it's counted neither as an allocation nor as a free.
+ * @param pool          the pool
+ * @param freed_size    size of the freed block or 0
+ * @param alloc_size    size of the allocated block or 0
+ */
+static void pool_stat_update(mem_pool_t * pool, size_t freed_size, size_t alloc_size)
+{
+    lv_mem_stat_t * stat = &pool->stat;
+    pool->stat_seq++;
+    STAT_FENCE_RELEASE();
+
+    if(freed_size) {
+        stat->used_size -= freed_size;
+        stat->used_cnt--;
+        stat->size_class_cnt[size_class(freed_size)]--;
+        if(alloc_size == 0) stat->free_total++;
+        cur_used -= freed_size;
     }
 
-    while(len > 4) {
-        SET32(0xFFFFFFFF);
-        len -= 4;
+    if(alloc_size) {
+        stat->used_size += alloc_size;
+        stat->used_cnt++;
+        stat->size_class_cnt[size_class(alloc_size)]++;
+        if(freed_size == 0) stat->alloc_total++;
+        stat->max_used = LV_MAX(stat->used_size, stat->max_used);
+        cur_used += alloc_size;
+        max_used = LV_MAX(cur_used, max_used);
     }
 
-    d8 = (uint8_t *)d32;
-    while(len) {
-        SET8(0xFF);
-        len--;
+    stat->free_size = lv_tlsf_free_size(pool->tlsf);
+    stat->free_cnt = lv_tlsf_free_cnt(pool->tlsf);
+
+    STAT_FENCE_RELEASE();
+    pool->stat_seq++;
+}
+
+/*Copy the statistics of a pool. Retry if they were updated meanwhile.
+ *The largest free block is looked up only here, not on every allocation.*/
+static lv_res_t pool_stat_read(const mem_pool_t * pool, lv_mem_stat_t * stat)
+{
+    uint32_t i;
+    for(i = 0; i < STAT_READ_TRY_CNT; i++) {
+        uint32_t seq = pool->stat_seq;
+        STAT_FENCE_ACQUIRE();
+        lv_memcpy(stat, &pool->stat, sizeof(lv_mem_stat_t));
+        stat->free_biggest_size = lv_tlsf_free_biggest_size(pool->tlsf);
+        STAT_FENCE_ACQUIRE();
+        if((seq & 1) == 0 && seq == pool->stat_seq) return LV_RES_OK;
     }
+
+    return LV_RES_INV;
 }
 
-#endif /*LV_MEMCPY_MEMSET_STD*/
+static uint32_t size_class(size_t size)
+{
+    uint32_t c = 0;
+    size >>= 4;
+    while(size && c < LV_MEM_STAT_CLASS_NUM - 1) {
+        size >>= 1;
+        c++;
+    }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+    return c;
+}
+
+static void stat_to_monitor(const lv_mem_stat_t * stat, lv_mem_monitor_t * mon_p)
+{
+    mon_p->total_size = stat->total_size;
+    mon_p->free_cnt = stat->free_cnt;
+    mon_p->free_size = stat->free_size;
+    mon_p->free_biggest_size = stat->free_biggest_size;
+    mon_p->used_cnt = stat->used_cnt;
+    mon_p->max_used = stat->max_used;
+    mon_p->used_pct = 100 - (100U * stat->free_size) / stat->total_size;
+    mon_p->frag_pct = stat->frag_pct; /*0 if all the RAM is used*/
+}
 
-#if LV_MEM_CUSTOM == 0
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
@@ -564,3 +1047,135 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+/*Make the chunk after `act` the active one. Allocate a new chunk if there is no spare chunk with `need` bytes.*/
+static lv_mem_buf_chunk_t * buf_chunk_next(lv_mem_buf_chunk_t * act, uint32_t need)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    lv_mem_buf_chunk_t * next = act ? act->next : arena->first;
+    if(next == NULL || next->size < need) {
+        /*Out of the scopes (not while rendering) typically only one or two buffers are used
+         *so only the first chunk, which is kept, is allocated with the default size*/
+        uint32_t size = arena->scope_depth || act == NULL ? LV_MAX(need, LV_MEM_BUF_CHUNK_SIZE) : need;
+        lv_mem_buf_chunk_t * chunk = lv_mem_alloc(BUF_CHUNK_HEADER + size);
+        /*if this fails you probably need to increase your LV_MEM_SIZE/heap size*/
+        LV_ASSERT_MSG(chunk != NULL, "Out of memory, can't allocate a new buffer (increase your LV_MEM_SIZE/heap size)");
+        if(chunk == NULL) return NULL;
+        MEM_TRACE("allocated a chunk of %d bytes (address: %p)", size, (void *)chunk);
+        arena->chunk_alloc_cnt++;
+
+        /*Keep the too small spare chunks after the new one*/
+        chunk->size = size;
+        chunk->prev = act;
+        chunk->next = next;
+        if(next) next->prev = chunk;
+        if(act) act->next = chunk;
+        else arena->first = chunk;
+        next = chunk;
+    }
+
+    next->used = 0;
+    next->top = BUF_TOP_NONE;
+    arena->act = next;
+    return next;
+}
+
+/*Give back the space of the released buffers from the end of the arena*/
+static void buf_pop_released(void)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    lv_mem_buf_chunk_t * chunk = arena->act;
+    if(chunk == NULL) return;
+
+    while(1) {
+        /*The buffers of the outer scopes are given back only when their scope is closed*/
+        bool scope_chunk = chunk == arena->scope_chunk;
+        while(chunk->top != BUF_TOP_NONE && !(scope_chunk && chunk->top < arena->scope_used)) {
+            buf_header_t * header = BUF_HEADER(chunk, chunk->top);
+            if(!header->released) return;
+            chunk->used = chunk->top;
+            chunk->top = header->prev;
+        }
+
+        if(scope_chunk) return;
+        if(chunk->prev == NULL) {
+            /*Out of the scopes keep only the first chunk so that the next buffers don't need the heap.
+             *A larger one was allocated for a large buffer, don't keep that.*/
+            if(arena->scope_depth == 0) {
+                if(chunk->size > LV_MEM_BUF_CHUNK_SIZE) {
+                    lv_mem_buf_free_all();
+                }
+                else {
+                    buf_chunks_free(chunk->next);
+                    chunk->next = NULL;
+                }
+            }
+            return;
+        }
+        chunk = chunk->prev;
+        arena->act = chunk;
+    }
+}
+
+static void buf_chunks_free(lv_mem_buf_chunk_t * chunk)
+{
+    while(chunk) {
+        lv_mem_buf_chunk_t * next = chunk->next;
+        lv_mem_free(chunk);
+        chunk = next;
+    }
+}
+
+#if LV_USE_ASSERT_MEM_INTEGRITY
+static bool buf_is_used(const void * p)
+{
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    lv_mem_buf_chunk_t * chunk;
+    for(chunk = arena->first; chunk; chunk = chunk == arena->act ? NULL : chunk->next) {
+        uint32_t ofs = chunk->top;
+        while(ofs != BUF_TOP_NONE) {
+            buf_header_t * header = BUF_HEADER(chunk, ofs);
+            if(header + 1 == p) return header->released == 0;
+            ofs = header->prev;
+        }
+    }
+
+    return false;
+}
+
+static bool buf_canary_ok(const buf_header_t * header)
+{
+    uint32_t canary;
+    lv_memcpy_small(&canary, (const uint8_t *)(header + 1) + header->size, sizeof(canary));
+    return canary == BUF_CANARY;
+}
+
+/*Report the not released and the overwritten buffers allocated since `mark`*/
+static void buf_check_scope(lv_mem_buf_mark_t mark)
+{
+    bool leak = false;
+    bool overflow = false;
+    lv_mem_buf_chunk_t * chunk = LV_GC_ROOT(lv_mem_buf).act;
+    while(chunk) {
+        uint32_t ofs = chunk->top;
+        while(ofs != BUF_TOP_NONE && (chunk != mark.chunk || ofs >= mark.used)) {
+            buf_header_t * header = BUF_HEADER(chunk, ofs);
+            if(!header->released) {
+                LV_LOG_ERROR("the buffer %p of %d bytes wasn't released", (void *)(header + 1), (int)header->size);
+                leak = true;
+            }
+            if(!buf_canary_ok(header)) {
+                LV_LOG_ERROR("the buffer %p of %d bytes was written past its end", (void *)(header + 1), (int)header->size);
+                overflow = true;
+            }
+            ofs = header->prev;
+        }
+
+        if(chunk == mark.chunk) break;
+        chunk = chunk->prev;
+    }
+
+    LV_ASSERT_MSG(!overflow, "A temporal buffer was written past its end");
+    LV_ASSERT_MSG(!leak, "Temporal buffers weren't released in their scope");
+}
+#endif
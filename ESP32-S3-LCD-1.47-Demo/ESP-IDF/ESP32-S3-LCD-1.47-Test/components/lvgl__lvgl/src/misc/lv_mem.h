@@ -25,10 +25,35 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*Maximum number of memory pools including the default one*/
+#define LV_MEM_POOL_MAX_NUM     4
+
+/*Use 16 byte vector registers for the bulk memory operations on SSE2 and NEON capable hosts*/
+#if (defined(__SSE2__) || defined(__ARM_NEON)) && !defined(__XTENSA__)
+    #define _LV_MEM_SIMD    1
+#else
+    #define _LV_MEM_SIMD    0
+#endif
+
+/*Number of size classes in `lv_mem_stat_t`. Class `i` is for the blocks of 2^(i+3) .. 2^(i+4)-1 bytes,
+ *the first one includes the smaller and the last one the larger blocks too.*/
+#define LV_MEM_STAT_CLASS_NUM   12
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Tells what an allocated memory is used for to choose the pool to allocate it from.
+ */
+enum {
+    LV_MEM_HINT_DEFAULT,    /**< Objects, styles and other frequently used data. Allocated from the default pool.*/
+    LV_MEM_HINT_LARGE,      /**< Large, rarely accessed data, e.g. image and font data, canvas and snapshot buffers*/
+    _LV_MEM_HINT_LAST
+};
+
+typedef uint8_t lv_mem_hint_t;
+
 /**
  * Heap information structure.
  */
@@ -43,13 +68,58 @@ typedef struct {
     uint8_t frag_pct; /**< Amount of fragmentation*/
 } lv_mem_monitor_t;
 
+/**
+ * Heap statistics updated on every allocation. Reading them doesn't walk the heap.
+ */
+typedef struct {
+    uint32_t total_size;        /**< Total heap size*/
+    uint32_t used_size;         /**< Sum of the sizes of the used blocks*/
+    uint32_t used_cnt;          /**< Number of used blocks*/
+    uint32_t free_size;         /**< Sum of the sizes of the free blocks*/
+    uint32_t free_cnt;          /**< Number of free blocks*/
+    uint32_t free_biggest_size; /**< Size of the largest free block, rounded down by less than 1/32*/
+    uint32_t max_used;          /**< Max of `used_size`*/
+    uint32_t alloc_total;       /**< Number of allocations since `lv_init()`*/
+    uint32_t free_total;        /**< Number of frees since `lv_init()`*/
+    uint32_t size_class_cnt[LV_MEM_STAT_CLASS_NUM]; /**< Number of used blocks in each size class*/
+    uint8_t frag_pct;           /**< 0: the free memory is in one block, near 100: it's in many small blocks*/
+} lv_mem_stat_t;
+
+/**
+ * A block of memory from which the temporal buffers are cut one after the other.
+ * The buffers are followed by the next free byte (`used`).
+ */
+typedef struct _lv_mem_buf_chunk_t {
+    struct _lv_mem_buf_chunk_t * prev;
+    struct _lv_mem_buf_chunk_t * next;  /**< The next chunk to use if this is full. Empty if this is the active one*/
+    uint32_t size;                      /**< Size of the data area*/
+    uint32_t used;                      /**< Number of used bytes in the data area*/
+    uint32_t top;                       /**< Offset of the last buffer in the chunk*/
+} lv_mem_buf_chunk_t;
+
+/**
+ * The arena of the temporal buffers
+ */
 typedef struct {
-    void * p;
-    uint16_t size;
-    uint8_t used : 1;
-} lv_mem_buf_t;
+    lv_mem_buf_chunk_t * first;
+    lv_mem_buf_chunk_t * act;           /**< The chunk in which the next buffer is allocated*/
+    lv_mem_buf_chunk_t * scope_chunk;   /**< The buffers below `scope_used` in this chunk belong to the outer scopes*/
+    uint32_t scope_used;
+    uint32_t scope_depth;               /**< Number of open scopes*/
+    uint32_t get_cnt;                   /**< Number of buffers got so far*/
+    uint32_t chunk_alloc_cnt;           /**< Number of chunks allocated from the heap so far*/
+} lv_mem_buf_arena_t;
 
-typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
+/**
+ * A saved state of the arena to return to with `lv_mem_buf_release_to()`
+ */
+typedef struct {
+    lv_mem_buf_chunk_t * chunk;
+    uint32_t used;
+    uint32_t top;
+    lv_mem_buf_chunk_t * scope_chunk;
+    uint32_t scope_used;
+} lv_mem_buf_mark_t;
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -66,6 +136,22 @@ void lv_mem_init(void);
  */
 void lv_mem_deinit(void);
 
+/**
+ * Add a memory area as a new pool
+ * @param mem pointer to the memory area. Should be aligned to 8 bytes.
+ * @param size size of the memory area in bytes
+ * @param hint the allocations with this hint are served from this pool first
+ * @return ID of the pool or -1 on error
+ * @note It works only if `LV_MEM_CUSTOM == 0`. `lv_mem_deinit()` removes the added pools.
+ */
+int32_t lv_mem_add_pool(void * mem, size_t size, lv_mem_hint_t hint);
+
+/**
+ * Get the number of memory pools
+ * @return number of the pools including the default one with ID 0
+ */
+uint32_t lv_mem_get_pool_cnt(void);
+
 /**
  * Allocate a memory dynamically
  * @param size size of the memory to allocate in bytes
@@ -73,6 +159,15 @@ void lv_mem_deinit(void);
  */
 void * lv_mem_alloc(size_t size);
 
+/**
+ * Allocate a memory dynamically from the pools added for a use.
+ * If they are full or there is no such pool the other pools are used.
+ * @param size size of the memory to allocate in bytes
+ * @param hint what the memory is used for, e.g. `LV_MEM_HINT_LARGE`
+ * @return pointer to the allocated memory
+ */
+void * lv_mem_alloc_hint(size_t size, lv_mem_hint_t hint);
+
 /**
  * Free an allocated data
  * @param data pointer to an allocated memory
@@ -98,12 +193,40 @@ lv_res_t lv_mem_test(void);
  * Give information about the work memory of dynamic allocation
  * @param mon_p pointer to a lv_mem_monitor_t variable,
  *              the result of the analysis will be stored here
+ * @note The result is summed up for all the pools
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about a memory pool
+ * @param id ID of the pool. 0: the default pool, else returned by `lv_mem_add_pool()`
+ * @param mon_p pointer to a lv_mem_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_monitor_pool(uint32_t id, lv_mem_monitor_t * mon_p);
+
+/**
+ * Get the statistics of the heap summed up for all the pools.
+ * It doesn't lock and can be called from any task, even while LVGL allocates.
+ * @param stat pointer to a `lv_mem_stat_t` variable to store the result
+ * @return LV_RES_OK: the values are consistent;
+ *         LV_RES_INV: a pool was being updated all the time, its values can be out of sync
+ */
+lv_res_t lv_mem_stat(lv_mem_stat_t * stat);
+
+/**
+ * Get the statistics of a memory pool. Can be called from any task like `lv_mem_stat()`.
+ * @param id ID of the pool. 0: the default pool, else returned by `lv_mem_add_pool()`
+ * @param stat pointer to a `lv_mem_stat_t` variable to store the result
+ * @return LV_RES_OK: the values are consistent; LV_RES_INV: invalid `id` or the values can be out of sync
+ */
+lv_res_t lv_mem_stat_pool(uint32_t id, lv_mem_stat_t * stat);
+
 
 /**
  * Get a temporal buffer with the given size.
+ * The buffers are allocated after each other in an arena so they should be released in reverse order.
+ * A buffer released out of order is reused only when the ones allocated after it are released too.
  * @param size the required size
  */
 void * lv_mem_buf_get(uint32_t size);
@@ -115,12 +238,36 @@ void * lv_mem_buf_get(uint32_t size);
 void lv_mem_buf_release(void * p);
 
 /**
- * Free all memory buffers
+ * Save the current state of the buffer arena and start a new scope.
+ * The buffers allocated before are kept until the scope is closed even if they are released in the meantime.
+ * Out of the scopes only the first chunk (`LV_MEM_BUF_CHUNK_SIZE` bytes) is kept when all the buffers are released.
+ * @return the mark to pass to `lv_mem_buf_release_to()`
+ */
+lv_mem_buf_mark_t lv_mem_buf_mark(void);
+
+/**
+ * Release all the buffers allocated since `mark` was taken at once and close its scope.
+ * The buffers allocated earlier remain valid. Marks need to be released in reverse order.
+ * @param mark a mark returned by `lv_mem_buf_mark()`
+ * @note With `LV_USE_ASSERT_MEM_INTEGRITY` the not released buffers are reported as leaks
+ */
+void lv_mem_buf_release_to(lv_mem_buf_mark_t mark);
+
+/**
+ * Free all memory buffers, including the chunk kept for the next buffers
  */
 void lv_mem_buf_free_all(void);
 
 //! @cond Doxygen_Suppress
 
+/*The bulk memory kernels `lv_memcpy()` and `lv_memset()` can choose from. Exported for testing.*/
+void * _lv_memcpy_word(void * dst, const void * src, size_t len);
+void _lv_memset_word(void * dst, uint8_t v, size_t len);
+#if _LV_MEM_SIMD
+void * _lv_memcpy_simd(void * dst, const void * src, size_t len);
+void _lv_memset_simd(void * dst, uint8_t v, size_t len);
+#endif
+
 #if LV_MEMCPY_MEMSET_STD
 
 /**
@@ -178,7 +325,8 @@ static inline void lv_memset_ff(void * dst, size_t len)
 
 #else
 /**
- * Same as `memcpy` but optimized for 4 byte operation.
+ * Same as `memcpy` but uses the fastest kernel of the target: SIMD on hosts,
+ * the assembly routines of the C library on Xtensa, word copy elsewhere.
  * @param dst pointer to the destination buffer
  * @param src pointer to the source buffer
  * @param len number of byte to copy
@@ -207,7 +355,7 @@ static inline void * LV_ATTRIBUTE_FAST_MEM lv_memcpy_small(void * dst, const voi
 }
 
 /**
- * Same as `memset` but optimized for 4 byte operation.
+ * Same as `memset` but uses the fastest kernel of the target like `lv_memcpy()`.
  * @param dst pointer to the destination buffer
  * @param v value to set [0..255]
  * @param len number of byte to set
@@ -215,14 +363,14 @@ static inline void * LV_ATTRIBUTE_FAST_MEM lv_memcpy_small(void * dst, const voi
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_memset(void * dst, uint8_t v, size_t len);
 
 /**
- * Same as `memset(dst, 0x00, len)` but optimized for 4 byte operation.
+ * Same as `memset(dst, 0x00, len)` but uses the fastest kernel of the target
  * @param dst pointer to the destination buffer
  * @param len number of byte to set
  */
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_memset_00(void * dst, size_t len);
 
 /**
- * Same as `memset(dst, 0xFF, len)` but optimized for 4 byte operation.
+ * Same as `memset(dst, 0xFF, len)` but uses the fastest kernel of the target
  * @param dst pointer to the destination buffer
  * @param len number of byte to set
  */
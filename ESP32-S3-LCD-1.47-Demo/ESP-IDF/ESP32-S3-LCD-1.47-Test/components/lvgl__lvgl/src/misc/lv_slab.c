@@ -0,0 +1,243 @@
+/**
+ * @file lv_slab.c
+ * Slab allocator of fixed size blocks.
+ * The chunks are dynamically allocated by the 'lv_mem' module.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_slab.h"
+#include "lv_mem.h"
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The array of the chunks grows and shrinks in steps of this many elements*/
+#define CHUNKS_STEP    8
+#define CHUNKS_CAP(cnt) (((cnt) + CHUNKS_STEP - 1) / CHUNKS_STEP * CHUNKS_STEP)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct _lv_slab_chunk_t {
+    struct _lv_slab_chunk_t * prev;     /**< Neighbors in the `partial` list*/
+    struct _lv_slab_chunk_t * next;
+    void * free_list;                   /**< Linked list of the free blocks. The first word of a block points to the next*/
+    uint32_t used_cnt;
+} lv_slab_chunk_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab);
+static void chunk_delete(lv_slab_t * slab, uint32_t id);
+static uint32_t chunk_find(lv_slab_t * slab, const void * p);
+static uint8_t * chunk_get_blocks(lv_slab_chunk_t * chunk);
+static void partial_add(lv_slab_t * slab, lv_slab_chunk_t * chunk);
+static void partial_remove(lv_slab_t * slab, lv_slab_chunk_t * chunk);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_slab_init(lv_slab_t * slab, uint32_t block_size, uint16_t chunk_block_cnt)
+{
+    LV_ASSERT(chunk_block_cnt > 0);
+
+    lv_memset_00(slab, sizeof(lv_slab_t));
+    slab->block_size = LV_SLAB_BLOCK_SIZE(block_size);  /*A free block stores the pointer of the next free block*/
+    slab->chunk_block_cnt = chunk_block_cnt;
+}
+
+void lv_slab_deinit(lv_slab_t * slab)
+{
+    uint32_t i;
+    for(i = 0; i < slab->chunk_cnt; i++) {
+        lv_mem_free(slab->chunks[i]);
+    }
+    lv_mem_free(slab->chunks);
+
+    slab->chunks = NULL;
+    slab->chunk_cnt = 0;
+    slab->partial = NULL;
+    slab->spare = NULL;
+}
+
+void * lv_slab_alloc(lv_slab_t * slab)
+{
+    lv_slab_chunk_t * chunk = slab->partial;
+    if(chunk == NULL && slab->spare) {
+        chunk = slab->spare;
+        slab->spare = NULL;
+        partial_add(slab, chunk);
+    }
+    else if(chunk == NULL) {
+        chunk = chunk_create(slab);
+        if(chunk == NULL) return NULL;
+    }
+
+    void * block = chunk->free_list;
+    chunk->free_list = *(void **)block;
+    chunk->used_cnt++;
+    if(chunk->free_list == NULL) partial_remove(slab, chunk);
+
+    return block;
+}
+
+void lv_slab_free(lv_slab_t * slab, void * block)
+{
+    if(block == NULL) return;
+
+    uint32_t id = chunk_find(slab, block);
+    LV_ASSERT_MSG(id < slab->chunk_cnt, "The block is not from this slab");
+    if(id >= slab->chunk_cnt) return;
+
+    lv_slab_chunk_t * chunk = slab->chunks[id];
+    if(chunk->free_list == NULL) partial_add(slab, chunk);
+
+    *(void **)block = chunk->free_list;
+    chunk->free_list = block;
+    chunk->used_cnt--;
+
+    if(chunk->used_cnt == 0) {
+        /*Keep the last chunk to not free and allocate it again and again
+         *when a block is allocated and freed repeatedly in an otherwise empty slab*/
+        partial_remove(slab, chunk);
+        if(slab->chunk_cnt == 1) slab->spare = chunk;
+        else chunk_delete(slab, id);
+    }
+}
+
+void lv_slab_trim(lv_slab_t * slab)
+{
+    if(slab->spare == NULL) return;
+
+    chunk_delete(slab, chunk_find(slab, slab->spare));
+    slab->spare = NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab)
+{
+    if(slab->chunk_cnt == UINT16_MAX) return NULL;
+
+    if(slab->chunk_cnt == CHUNKS_CAP(slab->chunk_cnt)) {
+        void ** chunks = lv_mem_realloc(slab->chunks, CHUNKS_CAP(slab->chunk_cnt + 1) * sizeof(void *));
+        LV_ASSERT_MALLOC(chunks);
+        if(chunks == NULL) return NULL;
+        slab->chunks = chunks;
+    }
+
+    lv_slab_chunk_t * chunk = lv_mem_alloc(sizeof(lv_slab_chunk_t) + slab->block_size * slab->chunk_block_cnt);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    /*Chain the blocks into the free list*/
+    uint8_t * blocks = chunk_get_blocks(chunk);
+    uint32_t i;
+    for(i = 0; i < slab->chunk_block_cnt - 1U; i++) {
+        *(void **)(blocks + i * slab->block_size) = blocks + (i + 1) * slab->block_size;
+    }
+    *(void **)(blocks + i * slab->block_size) = NULL;
+    chunk->free_list = blocks;
+    chunk->used_cnt = 0;
+
+    /*Keep the array sorted by address*/
+    uint32_t min = 0;
+    uint32_t max = slab->chunk_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if((uint8_t *)slab->chunks[mid] < (uint8_t *)chunk) min = mid + 1;
+        else max = mid;
+    }
+
+    for(i = slab->chunk_cnt; i > min; i--) {
+        slab->chunks[i] = slab->chunks[i - 1];
+    }
+    slab->chunks[min] = chunk;
+    slab->chunk_cnt++;
+
+    partial_add(slab, chunk);
+
+    return chunk;
+}
+
+/*Free a chunk which is not in the `partial` list*/
+static void chunk_delete(lv_slab_t * slab, uint32_t id)
+{
+    lv_mem_free(slab->chunks[id]);
+
+    slab->chunk_cnt--;
+    for(; id < slab->chunk_cnt; id++) {
+        slab->chunks[id] = slab->chunks[id + 1];
+    }
+
+    if(slab->chunk_cnt == 0) {
+        lv_mem_free(slab->chunks);
+        slab->chunks = NULL;
+    }
+    else if(slab->chunk_cnt == CHUNKS_CAP(slab->chunk_cnt)) {
+        /*If it can't be shrunk the larger array is still good*/
+        void ** chunks = lv_mem_realloc(slab->chunks, slab->chunk_cnt * sizeof(void *));
+        if(chunks) slab->chunks = chunks;
+    }
+}
+
+/**
+ * Find the chunk containing an address with binary search
+ * @param slab      pointer to a slab
+ * @param p         pointer to a block or a chunk
+ * @return          index of the chunk in `chunks` or `chunk_cnt` if not found
+ */
+static uint32_t chunk_find(lv_slab_t * slab, const void * p)
+{
+    uint32_t chunk_size = sizeof(lv_slab_chunk_t) + slab->block_size * slab->chunk_block_cnt;
+    uint32_t min = 0;
+    uint32_t max = slab->chunk_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        const uint8_t * chunk = slab->chunks[mid];
+        if((const uint8_t *)p < chunk) max = mid;
+        else if((const uint8_t *)p >= chunk + chunk_size) min = mid + 1;
+        else return mid;
+    }
+
+    return slab->chunk_cnt;
+}
+
+static uint8_t * chunk_get_blocks(lv_slab_chunk_t * chunk)
+{
+    /*The size of the header is a multiple of the pointer size so the blocks after it are aligned*/
+    return (uint8_t *)(chunk + 1);
+}
+
+static void partial_add(lv_slab_t * slab, lv_slab_chunk_t * chunk)
+{
+    lv_slab_chunk_t * head = slab->partial;
+    chunk->prev = NULL;
+    chunk->next = head;
+    if(head) head->prev = chunk;
+    slab->partial = chunk;
+}
+
+static void partial_remove(lv_slab_t * slab, lv_slab_chunk_t * chunk)
+{
+    if(chunk->prev) chunk->prev->next = chunk->next;
+    else slab->partial = chunk->next;
+    if(chunk->next) chunk->next->prev = chunk->prev;
+    chunk->prev = NULL;
+    chunk->next = NULL;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file lv_slab.h
+ * Slab allocator of fixed size blocks. The blocks are carved from chunks allocated by the 'lv_mem' module
+ * to save the per allocation overhead of the heap and to keep the small objects together.
+ */
+
+#ifndef LV_SLAB_H
+#define LV_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** The real size of the blocks: at least a pointer and rounded up to pointer size*/
+#define LV_SLAB_BLOCK_SIZE(size) \
+    ((size) < sizeof(void *) ? sizeof(void *) : (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a slab*/
+typedef struct {
+    void ** chunks;             /**< Array of the chunks sorted by address to find the chunk of a block quickly*/
+    void * partial;             /**< Linked list of the chunks having free and used blocks too*/
+    void * spare;               /**< The last chunk of the slab kept when it became empty*/
+    uint32_t block_size;        /**< Size of a block rounded up to pointer size*/
+    uint16_t chunk_cnt;         /**< Number of elements in `chunks`*/
+    uint16_t chunk_block_cnt;   /**< Number of blocks in a chunk*/
+} lv_slab_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a slab. No memory is allocated until the first block is requested.
+ * @param slab              pointer to a slab variable
+ * @param block_size        size of a block in bytes
+ * @param chunk_block_cnt   number of blocks to allocate at once
+ */
+void lv_slab_init(lv_slab_t * slab, uint32_t block_size, uint16_t chunk_block_cnt);
+
+/**
+ * Free all the chunks of a slab. The blocks allocated from the slab become invalid.
+ * @param slab              pointer to a slab
+ */
+void lv_slab_deinit(lv_slab_t * slab);
+
+/**
+ * Get a block from the slab
+ * @param slab              pointer to a slab
+ * @return                  pointer to a `block_size` sized memory or NULL if out of memory
+ */
+void * lv_slab_alloc(lv_slab_t * slab);
+
+/**
+ * Give back a block to the slab. The chunk is given back to the heap when all of its blocks are free,
+ * except the last chunk of the slab which is kept until `lv_slab_trim()`.
+ * @param slab              pointer to a slab
+ * @param block             pointer to a block allocated from `slab`. NULL is ignored.
+ */
+void lv_slab_free(lv_slab_t * slab, void * block);
+
+/**
+ * Give back the kept empty chunk to the heap, if any
+ * @param slab              pointer to a slab
+ */
+void lv_slab_trim(lv_slab_t * slab);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
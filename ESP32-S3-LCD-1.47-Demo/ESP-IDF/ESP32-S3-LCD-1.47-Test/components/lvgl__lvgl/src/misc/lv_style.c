@@ -133,6 +133,10 @@ const uint8_t _lv_style_builtin_prop_flag_lookup_table[_LV_STYLE_NUM_BUILT_IN_PR
 
 uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
+/*Incremented on every change of any style to let the caches of resolved properties know that they are stale.
+ *lv_obj_style.c restores it after changing the local and transition styles, as only their object's values change*/
+uint32_t _lv_style_version = 1;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -160,6 +164,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    _lv_style_version++;
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -176,6 +181,7 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    _lv_style_version++;
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -230,6 +236,8 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
 
     if(style->prop_cnt == 0)  return false;
 
+    _lv_style_version++;
+
     if(style->prop_cnt == 1) {
         if(LV_STYLE_PROP_ID_MASK(style->prop1) == prop) {
             style->prop1 = LV_STYLE_PROP_INV;
@@ -422,6 +430,8 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
         return;
     }
 
+    _lv_style_version++;
+
     lv_style_prop_t prop_id = LV_STYLE_PROP_ID_MASK(prop_and_meta);
 
     if(style->prop_cnt > 1) {
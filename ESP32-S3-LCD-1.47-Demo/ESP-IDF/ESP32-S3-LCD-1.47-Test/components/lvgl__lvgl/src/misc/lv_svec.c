@@ -0,0 +1,136 @@
+/**
+ * @file lv_svec.c
+ * Small vector. The heap buffer is dynamically allocated by the 'lv_mem' module.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_svec.h"
+#include "lv_mem.h"
+#include "lv_assert.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SVEC_MIN_CAP 4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool svec_grow(lv_svec_t * vec);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_svec_init(lv_svec_t * vec, uint32_t elem_size, void * local, uint32_t local_cap)
+{
+    LV_ASSERT(elem_size > 0);
+    LV_ASSERT(local != NULL || local_cap == 0);
+
+    vec->data = local;
+    vec->local = local;
+    vec->elem_size = elem_size;
+    vec->cnt = 0;
+    vec->cap = local_cap;
+    vec->local_cap = local_cap;
+}
+
+void _lv_svec_clear(lv_svec_t * vec)
+{
+    if(vec->data != vec->local) lv_mem_free(vec->data);
+    vec->data = vec->local;
+    vec->cap = vec->local_cap;
+    vec->cnt = 0;
+}
+
+void * _lv_svec_ins(lv_svec_t * vec, uint32_t idx)
+{
+    LV_ASSERT(idx <= vec->cnt);
+
+    if(vec->cnt == vec->cap && !svec_grow(vec)) return NULL;
+
+    uint8_t * p = _lv_svec_get(vec, idx);
+    if(idx < vec->cnt) memmove(p + vec->elem_size, p, (size_t)(vec->cnt - idx) * vec->elem_size);
+    vec->cnt++;
+
+    return p;
+}
+
+void * _lv_svec_push(lv_svec_t * vec)
+{
+    return _lv_svec_ins(vec, vec->cnt);
+}
+
+void _lv_svec_remove(lv_svec_t * vec, uint32_t idx)
+{
+    LV_ASSERT(idx < vec->cnt);
+
+    uint8_t * p = _lv_svec_get(vec, idx);
+    vec->cnt--;
+    if(idx < vec->cnt) memmove(p, p + vec->elem_size, (size_t)(vec->cnt - idx) * vec->elem_size);
+
+    /*Don't keep a heap buffer if the elements fit into the local buffer again. Wait until it's half
+     *empty to not copy and free/allocate on every remove/insert around `local_cap`.*/
+    if(vec->data != vec->local && vec->cnt <= vec->local_cap / 2) {
+        if(vec->cnt) lv_memcpy(vec->local, vec->data, (size_t)vec->cnt * vec->elem_size);
+        lv_mem_free(vec->data);
+        vec->data = vec->local;
+        vec->cap = vec->local_cap;
+    }
+}
+
+int32_t _lv_svec_find(const lv_svec_t * vec, const void * elem)
+{
+    uint32_t i;
+    for(i = 0; i < vec->cnt; i++) {
+        if(memcmp(_lv_svec_get(vec, i), elem, vec->elem_size) == 0) return (int32_t)i;
+    }
+
+    return -1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Double the capacity of a vector. The local buffer is copied to the heap the first time.
+ * @param vec pointer to a small vector
+ * @return true: the capacity was increased; false: out of memory
+ */
+static bool svec_grow(lv_svec_t * vec)
+{
+    uint32_t new_cap = vec->cap * 2;
+    if(new_cap < SVEC_MIN_CAP) new_cap = SVEC_MIN_CAP;
+
+    uint8_t * new_data;
+    if(vec->data == vec->local) {
+        new_data = lv_mem_alloc((size_t)new_cap * vec->elem_size);
+        LV_ASSERT_MALLOC(new_data);
+        if(new_data == NULL) return false;
+        if(vec->cnt) lv_memcpy(new_data, vec->local, (size_t)vec->cnt * vec->elem_size);
+    }
+    else {
+        new_data = lv_mem_realloc(vec->data, (size_t)new_cap * vec->elem_size);
+        LV_ASSERT_MALLOC(new_data);
+        if(new_data == NULL) return false;
+    }
+
+    vec->data = new_data;
+    vec->cap = new_cap;
+    return true;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file lv_svec.h
+ * Small vector: a contiguous array of fixed size elements. The first elements are stored in a buffer
+ * given by the owner (typically next to the vector) and it moves to the 'lv_mem' heap only if they don't fit.
+ */
+
+#ifndef LV_SVEC_H
+#define LV_SVEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a small vector*/
+typedef struct {
+    uint8_t * data;         /**< The elements: `local` or a heap buffer*/
+    uint8_t * local;        /**< The buffer of the owner for `local_cap` elements*/
+    uint32_t elem_size;     /**< Size of an element in bytes*/
+    uint32_t cnt;           /**< Number of elements*/
+    uint32_t cap;           /**< Number of elements `data` can hold*/
+    uint32_t local_cap;     /**< Number of elements `local` can hold*/
+} lv_svec_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a small vector
+ * @param vec           pointer to an `lv_svec_t` variable
+ * @param elem_size     size of an element in bytes
+ * @param local         buffer for the first `local_cap` elements. It must live as long as the vector.
+ * @param local_cap     number of elements `local` can hold. Can be 0 with `local == NULL`.
+ */
+void _lv_svec_init(lv_svec_t * vec, uint32_t elem_size, void * local, uint32_t local_cap);
+
+/**
+ * Remove all the elements and free the heap buffer. The vector remains valid.
+ * @param vec           pointer to a small vector
+ */
+void _lv_svec_clear(lv_svec_t * vec);
+
+/**
+ * Insert a new element. The elements from `idx` are moved by one.
+ * @param vec           pointer to a small vector
+ * @param idx           index of the new element, `0..cnt`
+ * @return              pointer to the uninitialized new element or NULL if out of memory
+ */
+void * _lv_svec_ins(lv_svec_t * vec, uint32_t idx);
+
+/**
+ * Add a new element to the end
+ * @param vec           pointer to a small vector
+ * @return              pointer to the uninitialized new element or NULL if out of memory
+ */
+void * _lv_svec_push(lv_svec_t * vec);
+
+/**
+ * Remove an element. The elements after it are moved by one to keep the order.
+ * The elements move back to `local` when they fill at most half of it.
+ * @param vec           pointer to a small vector
+ * @param idx           index of the element to remove
+ */
+void _lv_svec_remove(lv_svec_t * vec, uint32_t idx);
+
+/**
+ * Get the index of an element by comparing its bytes
+ * @param vec           pointer to a small vector
+ * @param elem          pointer to an `elem_size` sized value
+ * @return              the index of the first match or -1 if not found
+ */
+int32_t _lv_svec_find(const lv_svec_t * vec, const void * elem);
+
+/**
+ * Get an element
+ * @param vec           pointer to a small vector
+ * @param idx           index of the element, `0..cnt-1`
+ * @return              pointer to the element. It's valid until the vector is changed.
+ */
+static inline void * _lv_svec_get(const lv_svec_t * vec, uint32_t idx)
+{
+    return vec->data + (size_t)idx * vec->elem_size;
+}
+
+/**
+ * Get the number of elements
+ * @param vec           pointer to a small vector
+ * @return              number of elements
+ */
+static inline uint32_t _lv_svec_get_cnt(const lv_svec_t * vec)
+{
+    return vec->cnt;
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif
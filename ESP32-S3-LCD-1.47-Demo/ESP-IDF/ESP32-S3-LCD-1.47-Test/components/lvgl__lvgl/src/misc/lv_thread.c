@@ -0,0 +1,193 @@
+/**
+ * @file lv_thread.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_thread.h"
+
+#if LV_THREAD_OS != LV_OS_NONE
+
+#include "lv_log.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_THREAD_OS == LV_OS_PTHREAD
+    static void * thread_entry(void * arg);
+#elif LV_THREAD_OS == LV_OS_FREERTOS
+    static void thread_entry(void * arg);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if LV_THREAD_OS == LV_OS_PTHREAD
+
+lv_res_t lv_thread_init(lv_thread_t * thread, void (*callback)(void *), size_t stack_size, void * user_data)
+{
+    LV_UNUSED(stack_size);
+
+    thread->callback = callback;
+    thread->user_data = user_data;
+    if(pthread_create(&thread->thread, NULL, thread_entry, thread) != 0) {
+        LV_LOG_WARN("pthread_create failed");
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_delete(lv_thread_t * thread)
+{
+    return pthread_join(thread->thread, NULL) == 0 ? LV_RES_OK : LV_RES_INV;
+}
+
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync)
+{
+    if(pthread_mutex_init(&sync->mutex, NULL) != 0) return LV_RES_INV;
+    if(pthread_cond_init(&sync->cond, NULL) != 0) {
+        pthread_mutex_destroy(&sync->mutex);
+        return LV_RES_INV;
+    }
+    sync->v = false;
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_sync_wait(lv_thread_sync_t * sync)
+{
+    pthread_mutex_lock(&sync->mutex);
+    while(!sync->v) {
+        pthread_cond_wait(&sync->cond, &sync->mutex);
+    }
+    sync->v = false;
+    pthread_mutex_unlock(&sync->mutex);
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_sync_signal(lv_thread_sync_t * sync)
+{
+    pthread_mutex_lock(&sync->mutex);
+    sync->v = true;
+    pthread_cond_signal(&sync->cond);
+    pthread_mutex_unlock(&sync->mutex);
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_sync_delete(lv_thread_sync_t * sync)
+{
+    pthread_cond_destroy(&sync->cond);
+    pthread_mutex_destroy(&sync->mutex);
+
+    return LV_RES_OK;
+}
+
+#elif LV_THREAD_OS == LV_OS_FREERTOS
+
+lv_res_t lv_thread_init(lv_thread_t * thread, void (*callback)(void *), size_t stack_size, void * user_data)
+{
+    thread->callback = callback;
+    thread->user_data = user_data;
+    thread->exited = xSemaphoreCreateBinary();
+    if(thread->exited == NULL) return LV_RES_INV;
+
+#ifdef ESP_PLATFORM
+    /*ESP-IDF expects the stack depth in bytes*/
+    uint32_t stack_depth = stack_size;
+#else
+    uint32_t stack_depth = stack_size / sizeof(StackType_t);
+#endif
+
+    if(xTaskCreate(thread_entry, "lv_thread", stack_depth, thread, uxTaskPriorityGet(NULL),
+                   &thread->task) != pdPASS) {
+        LV_LOG_WARN("xTaskCreate failed");
+        vSemaphoreDelete(thread->exited);
+        return LV_RES_INV;
+    }
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_delete(lv_thread_t * thread)
+{
+    /*The task deletes itself after signaling*/
+    xSemaphoreTake(thread->exited, portMAX_DELAY);
+    vSemaphoreDelete(thread->exited);
+
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync)
+{
+    sync->sem = xSemaphoreCreateBinary();
+    return sync->sem ? LV_RES_OK : LV_RES_INV;
+}
+
+lv_res_t lv_thread_sync_wait(lv_thread_sync_t * sync)
+{
+    return xSemaphoreTake(sync->sem, portMAX_DELAY) == pdTRUE ? LV_RES_OK : LV_RES_INV;
+}
+
+lv_res_t lv_thread_sync_signal(lv_thread_sync_t * sync)
+{
+    xSemaphoreGive(sync->sem);
+    return LV_RES_OK;
+}
+
+lv_res_t lv_thread_sync_delete(lv_thread_sync_t * sync)
+{
+    vSemaphoreDelete(sync->sem);
+    return LV_RES_OK;
+}
+
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_THREAD_OS == LV_OS_PTHREAD
+
+static void * thread_entry(void * arg)
+{
+    lv_thread_t * thread = arg;
+    thread->callback(thread->user_data);
+    return NULL;
+}
+
+#elif LV_THREAD_OS == LV_OS_FREERTOS
+
+static void thread_entry(void * arg)
+{
+    lv_thread_t * thread = arg;
+    thread->callback(thread->user_data);
+
+    xSemaphoreGive(thread->exited);
+    vTaskDelete(NULL);
+}
+
+#endif
+
+#endif /*LV_THREAD_OS != LV_OS_NONE*/
@@ -0,0 +1,143 @@
+/**
+ * @file lv_thread.h
+ * Minimal thread and synchronization abstraction for the OSes LVGL can use
+ */
+
+#ifndef LV_THREAD_H
+#define LV_THREAD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_types.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_OS_NONE      0
+#define LV_OS_PTHREAD   1
+#define LV_OS_FREERTOS  2
+
+#if LV_USE_DRAW_SW_PARALLEL
+    #define LV_THREAD_OS LV_DRAW_SW_PARALLEL_OS
+#else
+    #define LV_THREAD_OS LV_OS_NONE
+#endif
+
+#if LV_THREAD_OS == LV_OS_PTHREAD
+    #include <pthread.h>
+#elif LV_THREAD_OS == LV_OS_FREERTOS
+    #ifdef ESP_PLATFORM
+        #include "freertos/FreeRTOS.h"
+        #include "freertos/task.h"
+        #include "freertos/semphr.h"
+    #else
+        #include "FreeRTOS.h"
+        #include "task.h"
+        #include "semphr.h"
+    #endif
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_THREAD_OS == LV_OS_PTHREAD
+
+typedef struct {
+    pthread_t thread;
+    void (*callback)(void *);
+    void * user_data;
+} lv_thread_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool v;
+} lv_thread_sync_t;
+
+#elif LV_THREAD_OS == LV_OS_FREERTOS
+
+typedef struct {
+    TaskHandle_t task;
+    SemaphoreHandle_t exited;
+    void (*callback)(void *);
+    void * user_data;
+} lv_thread_t;
+
+typedef struct {
+    SemaphoreHandle_t sem;
+} lv_thread_sync_t;
+
+#endif
+
+#if LV_THREAD_OS != LV_OS_NONE
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a new thread with the priority of the calling thread
+ * @param thread        pointer to a thread descriptor to initialize
+ * @param callback      the function to run on the thread. The thread exits when it returns.
+ * @param stack_size    stack size in bytes (ignored with pthreads)
+ * @param user_data     parameter of `callback`
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_init(lv_thread_t * thread, void (*callback)(void *), size_t stack_size, void * user_data);
+
+/**
+ * Wait until a thread's callback returns and free its resources
+ * @param thread        pointer to a thread descriptor
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_delete(lv_thread_t * thread);
+
+/**
+ * Create a synchronization object which can be waited for and signaled, like a binary semaphore
+ * @param sync          pointer to a sync descriptor to initialize
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_sync_init(lv_thread_sync_t * sync);
+
+/**
+ * Block until the sync object is signaled, then clear it
+ * @param sync          pointer to a sync descriptor
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_sync_wait(lv_thread_sync_t * sync);
+
+/**
+ * Signal a sync object and wake up the thread waiting for it
+ * @param sync          pointer to a sync descriptor
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_sync_signal(lv_thread_sync_t * sync);
+
+/**
+ * Free the resources of a sync object
+ * @param sync          pointer to a sync descriptor
+ * @return              LV_RES_OK: success; LV_RES_INV: error
+ */
+lv_res_t lv_thread_sync_delete(lv_thread_sync_t * sync);
+
+#endif /*LV_THREAD_OS != LV_OS_NONE*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_THREAD_H*/
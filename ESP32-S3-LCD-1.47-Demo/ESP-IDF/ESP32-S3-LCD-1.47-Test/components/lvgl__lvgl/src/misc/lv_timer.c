@@ -9,7 +9,7 @@
 #include "../hal/lv_hal_tick.h"
 #include "lv_assert.h"
 #include "lv_mem.h"
-#include "lv_ll.h"
+#include "lv_slab.h"
 #include "lv_gc.h"
 
 /*********************
@@ -17,6 +17,8 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_MIN_SIZE 8
+#define TIMER_SLAB_CHUNK_CNT 16  /*Number of timers allocated at once*/
 
 /**********************
  *      TYPEDEFS
@@ -25,16 +27,23 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static void lv_timer_exec(lv_timer_t * timer, uint32_t handler_start);
+static void timer_sched(lv_timer_t * timer, uint32_t due);
+static void timer_unsched(lv_timer_t * timer);
+static bool heap_reserve(void);
+static void heap_release(void);
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b);
+static void heap_set(uint32_t i, lv_timer_t * timer);
+static void heap_up(uint32_t i);
+static void heap_down(uint32_t i);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
-static bool timer_deleted;
-static bool timer_created;
+static bool timer_act_deleted;
+static uint32_t timer_seq;
 
 /**********************
  *      MACROS
@@ -54,7 +63,9 @@ static bool timer_created;
  */
 void _lv_timer_core_init(void)
 {
-    _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+    _lv_ilist_init(&LV_GC_ROOT(_lv_timer_ll));
+    lv_slab_init(&LV_GC_ROOT(_lv_timer_slab), sizeof(lv_timer_t), TIMER_SLAB_CHUNK_CNT);
+    lv_memset_00(&LV_GC_ROOT(_lv_timer_heap), sizeof(_lv_timer_heap_t));
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,39 +106,19 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
-        }
-    } while(LV_GC_ROOT(_lv_timer_act));
+    /*Run the due timers in the order of their deadline. The timers scheduled meanwhile run
+     *in this call too if they are due already, but a timer runs at most once per call.*/
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    while(heap->cnt > 0) {
+        lv_timer_t * timer = heap->timers[0];
+        if((int32_t)(timer->due - handler_start) > 0) break;
+        lv_timer_exec(timer, handler_start);
+    }
 
     uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
-
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+    if(heap->cnt > 0) {
+        int32_t remaining = (int32_t)(heap->timers[0]->due - lv_tick_get());
+        time_till_next = remaining > 0 ? (uint32_t)remaining : 0;
     }
 
     busy_time += lv_tick_elaps(handler_start);
@@ -168,18 +159,27 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
-    new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
+    new_timer = lv_slab_alloc(&LV_GC_ROOT(_lv_timer_slab));
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+    if(!heap_reserve()) {
+        lv_slab_free(&LV_GC_ROOT(_lv_timer_slab), new_timer);
+        return NULL;
+    }
+
+    _lv_ilist_ins_head(&LV_GC_ROOT(_lv_timer_ll), &new_timer->node);
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
     new_timer->paused = 0;
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
+    new_timer->seq = timer_seq++;
+    new_timer->heap_idx = LV_TIMER_HEAP_NONE;
 
-    timer_created = true;
+    timer_sched(new_timer, new_timer->last_run + period);
 
     return new_timer;
 }
@@ -200,10 +200,12 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
-    _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
-    timer_deleted = true;
+    timer_unsched(timer);
+    heap_release();
+    _lv_ilist_remove(&LV_GC_ROOT(_lv_timer_ll), &timer->node);
+    if(timer == LV_GC_ROOT(_lv_timer_act)) timer_act_deleted = true;
 
-    lv_mem_free(timer);
+    lv_slab_free(&LV_GC_ROOT(_lv_timer_slab), timer);
 }
 
 /**
@@ -213,11 +215,13 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+    timer_unsched(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+    timer_sched(timer, timer->last_run + timer->period);
 }
 
 /**
@@ -228,6 +232,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    timer_sched(timer, timer->last_run + period);
 }
 
 /**
@@ -237,6 +242,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_sched(timer, timer->last_run + timer->period);
 }
 
 /**
@@ -257,6 +263,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    timer_sched(timer, timer->last_run + timer->period);
 }
 
 /**
@@ -284,8 +291,8 @@ uint8_t lv_timer_get_idle(void)
  */
 lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
 {
-    if(timer == NULL) return _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    else return _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), timer);
+    lv_ilist_node_t * node = timer ? timer->node.next : LV_GC_ROOT(_lv_timer_ll).head;
+    return _LV_ILIST_ENTRY(node, lv_timer_t, node);
 }
 
 /**********************
@@ -293,49 +300,167 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
+ * Execute a due timer and schedule it again
  * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
+ * @param handler_start the tick when `lv_timer_handler` was called
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(lv_timer_t * timer, uint32_t handler_start)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-        TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted in the callback `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+
+    LV_GC_ROOT(_lv_timer_act) = timer;
+    timer_act_deleted = false;
+    TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+    TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
+    LV_ASSERT_MEM_INTEGRITY();
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    if(timer_act_deleted) return;   /*The timer was deleted by itself*/
+
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+        lv_timer_del(timer);
+        return;
     }
 
-    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-            lv_timer_del(timer);
-        }
+    /*Don't run it again in this `lv_timer_handler()` call even if its period is 0 or it was made ready*/
+    if(timer->heap_idx != LV_TIMER_HEAP_NONE) {
+        uint32_t due = timer->last_run + timer->period;
+        if((int32_t)(due - handler_start) <= 0) due = handler_start + 1;
+        timer_sched(timer, due);
     }
+}
 
-    return exec;
+/**
+ * Put a timer into the heap or move it to its new place in the heap. Paused timers are not scheduled.
+ * @param timer pointer to lv_timer
+ * @param due the tick when the timer should run
+ */
+static void timer_sched(lv_timer_t * timer, uint32_t due)
+{
+    if(timer->paused) return;
+
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    timer->due = due;
+
+    if(timer->heap_idx == LV_TIMER_HEAP_NONE) {
+        LV_ASSERT(heap->cnt < heap->size);  /*The slot was reserved in `lv_timer_create`*/
+        heap_set(heap->cnt, timer);
+        heap->cnt++;
+        heap_up(timer->heap_idx);
+    }
+    else {
+        heap_up(timer->heap_idx);
+        heap_down(timer->heap_idx);
+    }
 }
 
 /**
- * Find out how much time remains before a timer must be run.
+ * Remove a timer from the heap
  * @param timer pointer to lv_timer
- * @return the time remaining, or 0 if it needs to be run again
  */
-static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
+static void timer_unsched(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_idx;
+    if(i == LV_TIMER_HEAP_NONE) return;
+
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    timer->heap_idx = LV_TIMER_HEAP_NONE;
+    heap->cnt--;
+
+    /*Move the last timer to the freed place*/
+    if(i < heap->cnt) {
+        heap_set(i, heap->timers[heap->cnt]);
+        heap_up(i);
+        heap_down(heap->timers[i]->heap_idx);
+    }
+}
+
+/**
+ * Reserve a slot in the heap for a new timer
+ * @return true: reserved; false: out of memory
+ */
+static bool heap_reserve(void)
+{
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    if(heap->reserved == heap->size) {
+        uint32_t new_size = heap->size ? heap->size * 2 : HEAP_MIN_SIZE;
+        lv_timer_t ** timers = lv_mem_realloc(heap->timers, new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(timers);
+        if(timers == NULL) return false;
+        heap->timers = timers;
+        heap->size = new_size;
+    }
+
+    heap->reserved++;
+    return true;
+}
+
+/**
+ * Release the slot of a deleted timer. The array is halved only if it's mostly unused,
+ * so creating and deleting a few timers doesn't reallocate it each time.
+ */
+static void heap_release(void)
+{
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    heap->reserved--;
+
+    if(heap->size > HEAP_MIN_SIZE && heap->reserved <= heap->size / 4) {
+        lv_timer_t ** timers = lv_mem_realloc(heap->timers, heap->size / 2 * sizeof(lv_timer_t *));
+        if(timers) {
+            heap->timers = timers;
+            heap->size /= 2;
+        }
+    }
+}
+
+/**
+ * Compare the deadline of two timers considering the overflow of the tick
+ * @return true: `a` should run before `b`
+ */
+static bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
 {
-    /*Check if at least 'period' time elapsed*/
-    uint32_t elp = lv_tick_elaps(timer->last_run);
-    if(elp >= timer->period)
-        return 0;
-    return timer->period - elp;
+    int32_t diff = (int32_t)(a->due - b->due);
+    if(diff != 0) return diff < 0;
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static void heap_set(uint32_t i, lv_timer_t * timer)
+{
+    LV_GC_ROOT(_lv_timer_heap).timers[i] = timer;
+    timer->heap_idx = i;
+}
+
+static void heap_up(uint32_t i)
+{
+    lv_timer_t ** timers = LV_GC_ROOT(_lv_timer_heap).timers;
+    lv_timer_t * timer = timers[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!heap_less(timer, timers[parent])) break;
+        heap_set(i, timers[parent]);
+        i = parent;
+    }
+    heap_set(i, timer);
+}
+
+static void heap_down(uint32_t i)
+{
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap->timers[i];
+    while(1) {
+        uint32_t child = i * 2 + 1;
+        if(child >= heap->cnt) break;
+        if(child + 1 < heap->cnt && heap_less(heap->timers[child + 1], heap->timers[child])) child++;
+        if(!heap_less(heap->timers[child], timer)) break;
+        heap_set(i, heap->timers[child]);
+        i = child;
+    }
+    heap_set(i, timer);
 }
@@ -14,6 +14,7 @@ extern "C" {
  *********************/
 #include "../lv_conf_internal.h"
 #include "../hal/lv_hal_tick.h"
+#include "lv_ilist.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -26,6 +27,7 @@ extern "C" {
 #endif
 
 #define LV_NO_TIMER_READY 0xFFFFFFFF
+#define LV_TIMER_HEAP_NONE 0xFFFFFFFF
 
 /**********************
  *      TYPEDEFS
@@ -48,8 +50,25 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+
+    /*Used by the scheduler. Change the timer only with the `lv_timer_...()` functions to keep them valid.*/
+    uint32_t due;      /**< Tick when the timer should run next*/
+    uint32_t seq;      /**< Creation order to run the timers with the same `due` in this order*/
+    uint32_t heap_idx; /**< Index in the heap of the scheduled timers or `LV_TIMER_HEAP_NONE` if paused*/
+    lv_ilist_node_t node; /**< Node in the list of all timers*/
 } lv_timer_t;
 
+/**
+ * The not paused timers in a binary min-heap ordered by `due` and `seq`.
+ * Internally used by the library, you should not need to touch it.
+ */
+typedef struct {
+    lv_timer_t ** timers;
+    uint32_t cnt;
+    uint32_t size;
+    uint32_t reserved;  /**< A slot is reserved for each timer, paused or not, so scheduling can't fail*/
+} _lv_timer_heap_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -63,6 +82,8 @@ void _lv_timer_core_init(void);
 
 /**
  * Call it periodically to handle lv_timers.
+ * The due timers run in the order of their deadline. A timer runs at most once in a tick,
+ * so a timer with 0 period runs in every millisecond.
  * @return time till it needs to be run next (in ms)
  */
 uint32_t /* LV_ATTRIBUTE_TIMER_HANDLER */ lv_timer_handler(void);
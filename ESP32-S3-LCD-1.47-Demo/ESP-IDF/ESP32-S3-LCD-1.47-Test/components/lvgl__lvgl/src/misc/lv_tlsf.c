@@ -370,6 +370,10 @@ typedef struct control_t {
 
     /* Head of free lists. */
     block_header_t * blocks[FL_INDEX_COUNT][SL_INDEX_COUNT];
+
+    /* Sum of the sizes and number of the blocks in the free lists. */
+    size_t free_size;
+    size_t free_cnt;
 } control_t;
 
 /* A type used for casting when doing pointer arithmetic. */
@@ -592,6 +596,9 @@ static void remove_free_block(control_t * control, block_header_t * block, int f
     next->prev_free = prev;
     prev->next_free = next;
 
+    control->free_size -= block_size(block);
+    control->free_cnt--;
+
     /* If this block is the head of the free list, set new head. */
     if(control->blocks[fl][sl] == block) {
         control->blocks[fl][sl] = next;
@@ -627,6 +634,9 @@ static void insert_free_block(control_t * control, block_header_t * block, int f
     control->blocks[fl][sl] = block;
     control->fl_bitmap |= (1U << fl);
     control->sl_bitmap[fl] |= (1U << sl);
+
+    control->free_size += block_size(block);
+    control->free_cnt++;
 }
 
 /* Remove a given block from the free list. */
@@ -800,6 +810,8 @@ static void control_constructor(control_t * control)
     control->block_null.prev_free = &control->block_null;
 
     control->fl_bitmap = 0;
+    control->free_size = 0;
+    control->free_cnt = 0;
     for(i = 0; i < FL_INDEX_COUNT; ++i) {
         control->sl_bitmap[i] = 0;
         for(j = 0; j < SL_INDEX_COUNT; ++j) {
@@ -917,6 +929,36 @@ size_t lv_tlsf_block_size(void * ptr)
     return size;
 }
 
+size_t lv_tlsf_free_size(lv_tlsf_t tlsf)
+{
+    return tlsf_cast(control_t *, tlsf)->free_size;
+}
+
+size_t lv_tlsf_free_cnt(lv_tlsf_t tlsf)
+{
+    return tlsf_cast(control_t *, tlsf)->free_cnt;
+}
+
+size_t lv_tlsf_free_biggest_size(lv_tlsf_t tlsf)
+{
+    control_t * control = tlsf_cast(control_t *, tlsf);
+
+    /*
+    ** The biggest block is in the highest non-empty list. Return the
+    ** lower bound of that list instead of walking it, so only the
+    ** bitmaps are read.
+    */
+    const int fl = tlsf_fls(control->fl_bitmap);
+    if(fl < 0) return 0;
+    const int sl = tlsf_fls(control->sl_bitmap[fl]);
+    if(sl < 0) return 0;
+
+    if(fl == 0) return tlsf_cast(size_t, sl) * (SMALL_BLOCK_SIZE / SL_INDEX_COUNT);
+
+    const int fl_bit = fl + FL_INDEX_SHIFT - 1;
+    return (tlsf_cast(size_t, 1) << fl_bit) + (tlsf_cast(size_t, sl) << (fl_bit - SL_INDEX_COUNT_LOG2));
+}
+
 int lv_tlsf_check_pool(lv_pool_t pool)
 {
     /* Check that the blocks are physically correct. */
@@ -1165,7 +1207,7 @@ size_t lv_tlsf_free(lv_tlsf_t tlsf, const void * ptr)
         control_t * control = tlsf_cast(control_t *, tlsf);
         block_header_t * block = block_from_ptr(ptr);
         tlsf_assert(!block_is_free(block) && "block already marked as free");
-        size = block->size;
+        size = block_size(block);
         block_mark_as_free(block);
         block = block_merge_prev(control, block);
         block = block_merge_next(control, block);
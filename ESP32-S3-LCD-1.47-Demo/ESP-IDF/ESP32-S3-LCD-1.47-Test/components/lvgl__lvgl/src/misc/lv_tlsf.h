@@ -71,6 +71,12 @@ size_t lv_tlsf_free(lv_tlsf_t tlsf, const void * ptr);
 /* Returns internal block size, not original request size */
 size_t lv_tlsf_block_size(void * ptr);
 
+/* Free memory statistics, maintained on every operation. */
+size_t lv_tlsf_free_size(lv_tlsf_t tlsf);
+size_t lv_tlsf_free_cnt(lv_tlsf_t tlsf);
+/* Size of the largest free block rounded down to its size class (less than 1/32 off), computed from the bitmaps. */
+size_t lv_tlsf_free_biggest_size(lv_tlsf_t tlsf);
+
 /* Overheads/limits of internal structures. */
 size_t lv_tlsf_size(void);
 size_t lv_tlsf_align_size(void);
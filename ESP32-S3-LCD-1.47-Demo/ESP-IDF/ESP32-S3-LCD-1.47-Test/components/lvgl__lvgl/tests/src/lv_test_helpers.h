@@ -11,6 +11,10 @@
 
 static inline uint32_t lv_test_get_free_mem(void)
 {
+    /*Don't count the empty chunks the slabs and the temporal buffers keep for later*/
+    lv_obj_class_trim_slabs();
+    lv_mem_buf_free_all();
+
     lv_mem_monitor_t m1;
     lv_mem_monitor(&m1);
     return m1.free_size;
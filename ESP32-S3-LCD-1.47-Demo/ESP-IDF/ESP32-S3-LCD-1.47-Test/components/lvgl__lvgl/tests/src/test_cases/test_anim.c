@@ -0,0 +1,216 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_indev.h"
+#include <time.h>
+
+#define ANIM_CNT    1000
+#define TICK_CNT    100
+
+static int32_t values[ANIM_CNT];
+static uint32_t ready_cnt;
+static uint32_t deleted_cnt;
+
+static void exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+static void deleted_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    deleted_cnt++;
+}
+
+/*Delete the next animation and start a new one instead of it*/
+static void ready_replace_cb(lv_anim_t * a)
+{
+    ready_cnt++;
+    int32_t * var = a->var;
+    if(var + 1 >= &values[ANIM_CNT]) return;
+
+    lv_anim_del(var + 1, NULL);
+    lv_anim_t a2;
+    lv_anim_init(&a2);
+    lv_anim_set_var(&a2, var + 1);
+    lv_anim_set_exec_cb(&a2, exec_cb);
+    lv_anim_set_values(&a2, 0, 1000);
+    lv_anim_set_time(&a2, 10);
+    lv_anim_start(&a2);
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t mem_used_cnt(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.used_cnt;
+}
+#endif
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void anims_start(uint32_t time, lv_anim_path_cb_t path_cb)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_time(&a, time);
+    lv_anim_set_path_cb(&a, path_cb);
+    lv_anim_set_deleted_cb(&a, deleted_cb);
+
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_start(&a);
+    }
+}
+
+void setUp(void)
+{
+    lv_memset_00(values, sizeof(values));
+    ready_cnt = 0;
+    deleted_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_del(NULL, NULL);
+}
+
+void test_anim_start_del(void)
+{
+    anims_start(100, lv_anim_path_linear);
+    TEST_ASSERT_EQUAL_UINT16(ANIM_CNT, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_PTR(&values[10], lv_anim_get(&values[10], exec_cb)->var);
+
+    /*Starting it again replaces it*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &values[10]);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 20, 30);
+    lv_anim_start(&a);
+    TEST_ASSERT_EQUAL_UINT16(ANIM_CNT, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(1, deleted_cnt);
+    TEST_ASSERT_EQUAL_INT32(20, values[10]);
+
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i += 2) lv_anim_del(&values[i], exec_cb);
+    TEST_ASSERT_EQUAL_UINT16(ANIM_CNT / 2, lv_anim_count_running());
+    TEST_ASSERT_NULL(lv_anim_get(&values[0], NULL));
+    TEST_ASSERT_NOT_NULL(lv_anim_get(&values[1], NULL));
+
+    /*The rest runs to the end*/
+    lv_test_indev_wait(600);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    for(i = 1; i < ANIM_CNT; i += 2) TEST_ASSERT_EQUAL_INT32(1000, values[i]);
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT, deleted_cnt);
+}
+
+void test_anim_del_in_ready_cb(void)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, 0, 1000);
+    lv_anim_set_ready_cb(&a, ready_replace_cb);
+
+    /*Every 10th animation replaces the next one which is also running*/
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_time(&a, i % 10 == 0 ? 10 : 100);
+        lv_anim_set_ready_cb(&a, i % 10 == 0 ? ready_replace_cb : NULL);
+        lv_anim_start(&a);
+    }
+
+    lv_test_indev_wait(300);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_UINT32(ANIM_CNT / 10, ready_cnt);
+    for(i = 0; i < ANIM_CNT; i++) TEST_ASSERT_EQUAL_INT32(1000, values[i]);
+}
+
+void test_anim_shared_path_step(void)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out,
+        lv_anim_path_overshoot, lv_anim_path_bounce, lv_anim_path_step
+    };
+
+    /*Groups of animations with the same path and time but different values, as if they were started together*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    uint32_t i;
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_set_var(&a, &values[i]);
+        lv_anim_set_values(&a, -(int32_t)i, (int32_t)(i * 7));
+        lv_anim_set_path_cb(&a, paths[(i / 10) % (sizeof(paths) / sizeof(paths[0]))]);
+        lv_anim_set_time(&a, 100 + (i / 70) * 20);
+        lv_anim_start(&a);
+    }
+
+    /*The values have to be the same as if the path was evaluated for each animation*/
+    uint32_t t;
+    for(t = 0; t < 10; t++) {
+        lv_test_indev_wait(13);
+        for(i = 0; i < ANIM_CNT; i++) {
+            lv_anim_t * act = lv_anim_get(&values[i], exec_cb);
+            if(act == NULL) continue;
+            TEST_ASSERT_EQUAL_INT32(act->path_cb(act), act->current_value);
+        }
+    }
+}
+
+void test_anim_bench(void)
+{
+    static const struct {
+        const char * name;
+        lv_anim_path_cb_t path_cb;
+    } paths[] = {
+        {"linear", lv_anim_path_linear},
+        {"ease_in_out", lv_anim_path_ease_in_out},
+        {"overshoot", lv_anim_path_overshoot},
+        {"bounce", lv_anim_path_bounce},
+    };
+
+    uint32_t p;
+    for(p = 0; p < sizeof(paths) / sizeof(paths[0]); p++) {
+#if LV_MEM_CUSTOM == 0
+        uint32_t blocks_start = mem_used_cnt();
+#endif
+        uint32_t t = time_us();
+        anims_start(100000, paths[p].path_cb);
+        uint32_t t_start = time_us() - t;
+#if LV_MEM_CUSTOM == 0
+        uint32_t blocks = mem_used_cnt() - blocks_start;
+#else
+        uint32_t blocks = 0;
+#endif
+
+        t = time_us();
+        uint32_t i;
+        for(i = 0; i < TICK_CNT; i++) lv_anim_refr_now();
+        uint32_t t_tick = (time_us() - t) / TICK_CNT;
+
+        t = time_us();
+        lv_anim_del(NULL, NULL);
+        uint32_t t_del = time_us() - t;
+
+        TEST_PRINTF("%s: %u anims, start: %u us, tick: %u us, delete: %u us, heap blocks: %u",
+                    paths[p].name, (unsigned)ANIM_CNT, (unsigned)t_start, (unsigned)t_tick,
+                    (unsigned)t_del, (unsigned)blocks);
+        TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+    }
+}
+
+#endif
@@ -0,0 +1,405 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/misc/lv_ilist.h"
+#include "../src/misc/lv_svec.h"
+#include "../src/misc/lv_slab.h"
+#include "../src/misc/lv_ll.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define ELEM_CNT    1000
+#define ROUND_CNT   100
+#define NOISE_SIZE  48
+
+typedef struct {
+    uint32_t value;
+    uint8_t payload[28];
+    lv_ilist_node_t node;
+} elem_t;
+
+static void * noise[ELEM_CNT];
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Allocate something between the list nodes to scatter them like in a real heap*/
+static void noise_alloc(uint32_t i)
+{
+    noise[i] = lv_mem_alloc(NOISE_SIZE + (i % 4) * 16);
+}
+
+static void noise_free(void)
+{
+    uint32_t i;
+    for(i = 0; i < ELEM_CNT; i++) {
+        lv_mem_free(noise[i]);
+        noise[i] = NULL;
+    }
+}
+
+static uint32_t ilist_values(lv_ilist_t * list, uint32_t * values)
+{
+    lv_ilist_node_t * n;
+    uint32_t cnt = 0;
+    _LV_ILIST_READ(list, n) {
+        values[cnt++] = _LV_ILIST_ENTRY(n, elem_t, node)->value;
+    }
+    return cnt;
+}
+
+static void dummy_timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+}
+
+/*The dummy decoders. `user_data` might be disabled, so they are found by their index.*/
+static lv_img_decoder_t * dummy_decoders[12];
+
+static lv_res_t dummy_info_cb(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(src);
+    /*Tell which decoder was used in the width*/
+    lv_coord_t id = 0;
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        if(dummy_decoders[i] == decoder) id = i + 1;
+    }
+    header->w = id;
+    header->h = 1;
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    return LV_RES_OK;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_containers_ilist(void)
+{
+    lv_ilist_t list;
+    _lv_ilist_init(&list);
+    TEST_ASSERT_TRUE(_lv_ilist_is_empty(&list));
+
+    elem_t e[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) e[i].value = i;
+
+    _lv_ilist_ins_head(&list, &e[1].node);
+    _lv_ilist_ins_head(&list, &e[0].node);
+    _lv_ilist_ins_tail(&list, &e[2].node);
+    _lv_ilist_ins_tail(&list, &e[3].node);
+    TEST_ASSERT_EQUAL_UINT32(4, _lv_ilist_get_len(&list));
+
+    uint32_t values[4];
+    uint32_t expected1[] = {0, 1, 2, 3};
+    TEST_ASSERT_EQUAL_UINT32(4, ilist_values(&list, values));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected1, values, 4);
+
+    /*Remove from the middle, the head and the tail*/
+    _lv_ilist_remove(&list, &e[2].node);
+    _lv_ilist_remove(&list, &e[0].node);
+    _lv_ilist_remove(&list, &e[3].node);
+    uint32_t expected2[] = {1};
+    TEST_ASSERT_EQUAL_UINT32(1, ilist_values(&list, values));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected2, values, 1);
+    TEST_ASSERT_EQUAL_PTR(&e[1].node, list.head);
+    TEST_ASSERT_EQUAL_PTR(&e[1].node, list.tail);
+
+    /*Removing while iterating*/
+    _lv_ilist_ins_tail(&list, &e[2].node);
+    _lv_ilist_ins_tail(&list, &e[3].node);
+    lv_ilist_node_t * n;
+    lv_ilist_node_t * n_next;
+    _LV_ILIST_READ_SAFE(&list, n, n_next) {
+        _lv_ilist_remove(&list, n);
+    }
+    TEST_ASSERT_TRUE(_lv_ilist_is_empty(&list));
+    TEST_ASSERT_EQUAL_UINT32(0, _lv_ilist_get_len(&list));
+    TEST_ASSERT_NULL(list.tail);
+    TEST_ASSERT_NULL(_LV_ILIST_ENTRY(list.head, elem_t, node));
+}
+
+void test_containers_svec(void)
+{
+    uint32_t local[4];
+    lv_svec_t vec;
+    _lv_svec_init(&vec, sizeof(uint32_t), local, 4);
+
+    /*The first elements go to the local buffer*/
+    uint32_t i;
+    for(i = 0; i < 4; i++) *(uint32_t *)_lv_svec_push(&vec) = i;
+    TEST_ASSERT_EQUAL_PTR(local, vec.data);
+
+    /*Then to the heap*/
+    *(uint32_t *)_lv_svec_ins(&vec, 0) = 100;
+    *(uint32_t *)_lv_svec_ins(&vec, 3) = 101;
+    TEST_ASSERT_TRUE(vec.data != (uint8_t *)local);
+    uint32_t expected1[] = {100, 0, 1, 101, 2, 3};
+    TEST_ASSERT_EQUAL_UINT32(6, _lv_svec_get_cnt(&vec));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected1, vec.data, 6);
+
+    uint32_t v = 101;
+    TEST_ASSERT_EQUAL_INT32(3, _lv_svec_find(&vec, &v));
+    v = 5;
+    TEST_ASSERT_EQUAL_INT32(-1, _lv_svec_find(&vec, &v));
+
+    /*Stay on the heap while the local buffer would be full*/
+    _lv_svec_remove(&vec, 3);
+    _lv_svec_remove(&vec, 0);
+    TEST_ASSERT_TRUE(vec.data != (uint8_t *)local);
+    uint32_t expected2[] = {0, 1, 2, 3};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected2, vec.data, 4);
+    *(uint32_t *)_lv_svec_push(&vec) = 4;
+    _lv_svec_remove(&vec, 4);
+    TEST_ASSERT_TRUE(vec.data != (uint8_t *)local);
+
+    /*And back when it's half empty*/
+    _lv_svec_remove(&vec, 0);
+    TEST_ASSERT_TRUE(vec.data != (uint8_t *)local);
+    _lv_svec_remove(&vec, 0);
+    TEST_ASSERT_EQUAL_PTR(local, vec.data);
+    uint32_t expected3[] = {2, 3};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expected3, local, 2);
+
+    for(i = 0; i < 100; i++) *(uint32_t *)_lv_svec_push(&vec) = i;
+    TEST_ASSERT_EQUAL_UINT32(102, _lv_svec_get_cnt(&vec));
+    _lv_svec_clear(&vec);
+    TEST_ASSERT_EQUAL_UINT32(0, _lv_svec_get_cnt(&vec));
+    TEST_ASSERT_EQUAL_PTR(local, vec.data);
+
+    /*Without local buffer*/
+    _lv_svec_init(&vec, sizeof(uint32_t), NULL, 0);
+    *(uint32_t *)_lv_svec_push(&vec) = 7;
+    TEST_ASSERT_EQUAL_UINT32(7, *(uint32_t *)_lv_svec_get(&vec, 0));
+    _lv_svec_remove(&vec, 0);
+    TEST_ASSERT_NULL(vec.data);
+}
+
+void test_containers_slab(void)
+{
+    lv_slab_t slab;
+    lv_slab_init(&slab, sizeof(elem_t), 4);
+
+    /*The last empty chunk is kept so allocating and freeing one block doesn't reach the heap*/
+    void * a = lv_slab_alloc(&slab);
+    lv_slab_free(&slab, a);
+    TEST_ASSERT_EQUAL_UINT16(1, slab.chunk_cnt);
+    TEST_ASSERT_EQUAL_PTR(a, lv_slab_alloc(&slab));
+    lv_slab_free(&slab, a);
+
+    /*Only one empty chunk is kept*/
+    void * blocks[8];
+    uint32_t i;
+    for(i = 0; i < 8; i++) blocks[i] = lv_slab_alloc(&slab);
+    TEST_ASSERT_EQUAL_UINT16(2, slab.chunk_cnt);
+    for(i = 0; i < 8; i++) lv_slab_free(&slab, blocks[i]);
+    TEST_ASSERT_EQUAL_UINT16(1, slab.chunk_cnt);
+
+    lv_slab_trim(&slab);
+    TEST_ASSERT_EQUAL_UINT16(0, slab.chunk_cnt);
+    TEST_ASSERT_NULL(slab.chunks);
+
+    lv_slab_deinit(&slab);
+}
+
+void test_containers_timer_list(void)
+{
+    lv_timer_t * first = lv_timer_get_next(NULL);
+
+    /*The timers are listed from the last created*/
+    lv_timer_t * timers[40];
+    uint32_t i;
+    for(i = 0; i < 40; i++) timers[i] = lv_timer_create(dummy_timer_cb, 1000, NULL);
+
+    lv_timer_del(timers[20]);
+    lv_timer_del(timers[39]);
+
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    int32_t expected = 38;
+    while(t != first) {
+        if(expected == 20) expected--;
+        TEST_ASSERT_EQUAL_PTR(timers[expected], t);
+        expected--;
+        t = lv_timer_get_next(t);
+    }
+    TEST_ASSERT_EQUAL_INT32(-1, expected);
+
+    for(i = 0; i < 40; i++) {
+        if(i != 20 && i != 39) lv_timer_del(timers[i]);
+    }
+    TEST_ASSERT_EQUAL_PTR(first, lv_timer_get_next(NULL));
+}
+
+void test_containers_img_decoder_list(void)
+{
+    /*More decoders than the local buffer of the list. The last created is tried first.*/
+    lv_img_decoder_t ** decoders = dummy_decoders;
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        decoders[i] = lv_img_decoder_create();
+        lv_img_decoder_set_info_cb(decoders[i], dummy_info_cb);
+    }
+
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info("A:dummy.bin", &header));
+    TEST_ASSERT_EQUAL_INT32(12, header.w);
+
+    lv_img_decoder_delete(decoders[11]);
+    lv_img_decoder_delete(decoders[3]);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info("A:dummy.bin", &header));
+    TEST_ASSERT_EQUAL_INT32(11, header.w);
+
+    for(i = 0; i < 12; i++) {
+        if(i != 11 && i != 3) lv_img_decoder_delete(decoders[i]);
+    }
+
+    /*Only the built-in decoder remains and it doesn't know this file*/
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info("A:dummy.bin", &header));
+}
+
+void test_containers_bench(void)
+{
+    static elem_t * elems[ELEM_CNT];
+    uint32_t i, r;
+    volatile uint32_t sum = 0;
+
+    /*lv_ll: a node is allocated for each element*/
+    lv_ll_t ll;
+    _lv_ll_init(&ll, sizeof(elem_t));
+    for(i = 0; i < ELEM_CNT; i++) {
+        elem_t * e = _lv_ll_ins_head(&ll);
+        e->value = i;
+        noise_alloc(i);
+    }
+    elem_t * e;
+    uint32_t t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        _LV_LL_READ(&ll, e) sum += e->value;
+    }
+    uint32_t t_ll_iter = time_us() - t;
+    _lv_ll_clear(&ll);
+    noise_free();
+
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        for(i = 0; i < ELEM_CNT; i++) elems[i] = _lv_ll_ins_head(&ll);
+        for(i = 0; i < ELEM_CNT; i++) {
+            _lv_ll_remove(&ll, elems[i]);
+            lv_mem_free(elems[i]);
+        }
+    }
+    uint32_t t_ll_ins = time_us() - t;
+
+    /*lv_ilist with the elements from a slab*/
+    lv_slab_t slab;
+    lv_slab_init(&slab, sizeof(elem_t), 16);
+    lv_ilist_t list;
+    _lv_ilist_init(&list);
+    for(i = 0; i < ELEM_CNT; i++) {
+        elems[i] = lv_slab_alloc(&slab);
+        elems[i]->value = i;
+        _lv_ilist_ins_head(&list, &elems[i]->node);
+        noise_alloc(i);
+    }
+    lv_ilist_node_t * n;
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        _LV_ILIST_READ(&list, n) sum += _LV_ILIST_ENTRY(n, elem_t, node)->value;
+    }
+    uint32_t t_ilist_iter = time_us() - t;
+    for(i = 0; i < ELEM_CNT; i++) {
+        _lv_ilist_remove(&list, &elems[i]->node);
+        lv_slab_free(&slab, elems[i]);
+    }
+    noise_free();
+
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        for(i = 0; i < ELEM_CNT; i++) {
+            elems[i] = lv_slab_alloc(&slab);
+            _lv_ilist_ins_head(&list, &elems[i]->node);
+        }
+        for(i = 0; i < ELEM_CNT; i++) {
+            _lv_ilist_remove(&list, &elems[i]->node);
+            lv_slab_free(&slab, elems[i]);
+        }
+    }
+    uint32_t t_ilist_ins = time_us() - t;
+    lv_slab_deinit(&slab);
+
+    /*lv_svec with the elements stored in the vector*/
+    elem_t local[8];
+    lv_svec_t vec;
+    _lv_svec_init(&vec, sizeof(elem_t), local, 8);
+    for(i = 0; i < ELEM_CNT; i++) {
+        ((elem_t *)_lv_svec_push(&vec))->value = i;
+        noise_alloc(i);
+    }
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        elem_t * arr = _lv_svec_get(&vec, 0);
+        uint32_t cnt = _lv_svec_get_cnt(&vec);
+        for(i = 0; i < cnt; i++) sum += arr[i].value;
+    }
+    uint32_t t_svec_iter = time_us() - t;
+    _lv_svec_clear(&vec);
+    noise_free();
+
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        for(i = 0; i < ELEM_CNT; i++) _lv_svec_push(&vec);
+        while(_lv_svec_get_cnt(&vec)) _lv_svec_remove(&vec, _lv_svec_get_cnt(&vec) - 1);
+    }
+    uint32_t t_svec_ins = time_us() - t;
+    _lv_svec_clear(&vec);
+
+    TEST_PRINTF("%u elements, iteration: ll %u ns, ilist %u ns, svec %u ns", ELEM_CNT,
+                (unsigned)(t_ll_iter * 1000 / ROUND_CNT), (unsigned)(t_ilist_iter * 1000 / ROUND_CNT),
+                (unsigned)(t_svec_iter * 1000 / ROUND_CNT));
+    TEST_PRINTF("%u elements, insert and remove: ll %u us, ilist+slab %u us, svec %u us", ELEM_CNT,
+                (unsigned)(t_ll_ins / ROUND_CNT), (unsigned)(t_ilist_ins / ROUND_CNT),
+                (unsigned)(t_svec_ins / ROUND_CNT));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_containers_bench_timer(void)
+{
+    static lv_timer_t * timers[ELEM_CNT];
+    uint32_t i, r;
+
+    uint32_t t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        for(i = 0; i < ELEM_CNT; i++) timers[i] = lv_timer_create(dummy_timer_cb, 1000 + i, NULL);
+        for(i = 0; i < ELEM_CNT; i++) lv_timer_del(timers[i]);
+    }
+    uint32_t t_create = time_us() - t;
+
+    for(i = 0; i < ELEM_CNT; i++) {
+        timers[i] = lv_timer_create(dummy_timer_cb, 1000 + i, NULL);
+        noise_alloc(i);
+    }
+    volatile uint32_t cnt = 0;
+    t = time_us();
+    for(r = 0; r < ROUND_CNT; r++) {
+        lv_timer_t * timer = NULL;
+        while((timer = lv_timer_get_next(timer)) != NULL) cnt++;
+    }
+    uint32_t t_iter = time_us() - t;
+    for(i = 0; i < ELEM_CNT; i++) lv_timer_del(timers[i]);
+    noise_free();
+
+    TEST_PRINTF("%u timers: create and delete %u us, lv_timer_get_next() over all %u ns", ELEM_CNT,
+                (unsigned)(t_create / ROUND_CNT), (unsigned)(t_iter * 1000 / ROUND_CNT));
+}
+
+#endif
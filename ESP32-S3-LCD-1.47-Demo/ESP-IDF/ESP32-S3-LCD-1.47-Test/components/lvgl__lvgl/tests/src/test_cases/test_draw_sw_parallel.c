@@ -0,0 +1,91 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define SCENE_CNT   48
+
+#if LV_USE_DRAW_SW_PARALLEL && LV_USE_DEMO_BENCHMARK
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Render the whole screen with the given blend function and return the elapsed time in us*/
+static uint32_t render(void (*blend)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *))
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    ((lv_draw_sw_ctx_t *)disp->driver->draw_ctx)->blend = blend;
+
+    lv_obj_invalidate(lv_scr_act());
+    uint32_t t = time_us();
+    lv_refr_now(disp);
+    return time_us() - t;
+}
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+#if LV_USE_DRAW_SW_PARALLEL
+    ((lv_draw_sw_ctx_t *)disp->driver->draw_ctx)->blend = lv_draw_sw_blend_parallel;
+#endif
+    disp->driver->monitor_cb = NULL;
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_draw_sw_parallel_is_default(void)
+{
+#if LV_USE_DRAW_SW_PARALLEL
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL_PTR(lv_draw_sw_blend_parallel, ((lv_draw_sw_ctx_t *)disp->driver->draw_ctx)->blend);
+#endif
+}
+
+void test_draw_sw_parallel_benchmark_scenes(void)
+{
+#if LV_USE_DRAW_SW_PARALLEL && LV_USE_DEMO_BENCHMARK
+    uint32_t serial_sum = 0;
+    uint32_t parallel_sum = 0;
+    int_fast16_t scene;
+    for(scene = 0; scene < SCENE_CNT * 2; scene++) {
+        lv_demo_benchmark_run_scene(scene);
+
+        uint32_t serial = render(lv_draw_sw_blend_basic);
+        lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+
+        uint32_t parallel = render(lv_draw_sw_blend_parallel);
+
+        /*The bands have to be blended exactly as on a single thread*/
+        TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+
+        TEST_PRINTF("scene %d: %u us serial, %u us with %d workers (%u%%)",
+                    (int)scene, (unsigned)serial, (unsigned)parallel, LV_DRAW_SW_PARALLEL_WORKER_CNT,
+                    (unsigned)(serial * 100 / LV_MAX(parallel, 1)));
+        serial_sum += serial;
+        parallel_sum += parallel;
+
+        lv_demo_benchmark_close();
+    }
+
+    TEST_PRINTF("all scenes: %u us serial, %u us parallel (%u%%)",
+                (unsigned)serial_sum, (unsigned)parallel_sum,
+                (unsigned)(serial_sum * 100 / LV_MAX(parallel_sum, 1)));
+#endif
+}
+
+#endif
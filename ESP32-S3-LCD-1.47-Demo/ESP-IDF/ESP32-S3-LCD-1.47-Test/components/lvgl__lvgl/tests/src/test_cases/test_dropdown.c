@@ -108,6 +108,8 @@ void test_dropdown_set_options(void)
 
     lv_obj_del(dd1);
 
+    /*Don't count the chunk kept for the next temporal buffers*/
+    lv_mem_buf_free_all();
     lv_mem_monitor_t m2;
     lv_mem_monitor(&m2);
     TEST_ASSERT_UINT32_WITHIN(48, m1.free_size, m2.free_size);
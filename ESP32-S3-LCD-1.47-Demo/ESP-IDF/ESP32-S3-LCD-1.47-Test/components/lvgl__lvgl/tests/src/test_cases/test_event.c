@@ -3,6 +3,23 @@
 
 #include "unity/unity.h"
 
+#include <time.h>
+
+static uint32_t event_cnt;
+
+static void event_count_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    event_cnt++;
+}
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
 static void event_object_deletion_cb(const lv_obj_class_t * cls, lv_event_t * e)
 {
     LV_UNUSED(cls);
@@ -24,4 +41,90 @@ void test_event_object_deletion(void)
     lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+void test_event_filter(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    event_cnt = 0;
+
+    lv_obj_add_event_cb(obj, event_count_cb, LV_EVENT_CLICKED, NULL);
+    lv_event_send(obj, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, event_cnt);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, event_cnt);
+
+    lv_obj_add_event_cb(obj, event_count_cb, LV_EVENT_READY | LV_EVENT_PREPROCESS, NULL);
+    lv_event_send(obj, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+
+    lv_obj_remove_event_cb(obj, event_count_cb);
+    lv_obj_remove_event_cb(obj, event_count_cb);
+    lv_event_send(obj, LV_EVENT_READY, NULL);
+    lv_event_send(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, event_cnt);
+
+    lv_obj_add_event_cb(obj, event_count_cb, LV_EVENT_ALL, NULL);
+    lv_event_send(obj, LV_EVENT_CANCEL, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, event_cnt);
+
+    /*The built-in codes above 31 have their own bit too*/
+    lv_obj_remove_event_cb(obj, event_count_cb);
+    lv_obj_add_event_cb(obj, event_count_cb, LV_EVENT_LAYOUT_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)1 << LV_EVENT_LAYOUT_CHANGED, obj->spec_attr->event_mask);
+    lv_event_send(obj, (lv_event_code_t)(LV_EVENT_LAYOUT_CHANGED - 32), NULL);
+    lv_event_send(obj, LV_EVENT_LAYOUT_CHANGED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, event_cnt);
+
+    /*Custom codes from 63 share the last bit but they are still filtered*/
+    lv_event_code_t custom_code = (lv_event_code_t)lv_event_register_id();
+    while(custom_code < 64) custom_code = (lv_event_code_t)lv_event_register_id();
+    lv_obj_remove_event_cb(obj, event_count_cb);
+    lv_obj_add_event_cb(obj, event_count_cb, custom_code, NULL);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)1 << 63, obj->spec_attr->event_mask);
+    lv_event_send(obj, (lv_event_code_t)(custom_code - 1), NULL);
+    lv_event_send(obj, custom_code, NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, event_cnt);
+
+    lv_obj_del(obj);
+}
+
+void test_event_dispatch_benchmark(void)
+{
+    const uint32_t send_cnt = 100000;
+
+    /*An object with callbacks for other events and a plain object*/
+    lv_obj_t * obj_cb = lv_obj_create(lv_scr_act());
+    lv_obj_add_event_cb(obj_cb, event_count_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(obj_cb, event_count_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(obj_cb, event_count_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj_cb, event_count_cb, LV_EVENT_FOCUSED, NULL);
+    lv_obj_t * obj_plain = lv_obj_create(lv_scr_act());
+
+    lv_cover_check_info_t info;
+    lv_area_t area = {0, 0, 10, 10};
+    info.area = &area;
+    event_cnt = 0;
+
+    uint32_t i;
+    uint32_t t = time_us();
+    for(i = 0; i < send_cnt; i++) {
+        info.res = LV_COVER_RES_COVER;
+        lv_event_send(obj_cb, LV_EVENT_COVER_CHECK, &info);
+    }
+    uint32_t t_cb = time_us() - t;
+
+    t = time_us();
+    for(i = 0; i < send_cnt; i++) {
+        info.res = LV_COVER_RES_COVER;
+        lv_event_send(obj_plain, LV_EVENT_COVER_CHECK, &info);
+    }
+    uint32_t t_plain = time_us() - t;
+
+    TEST_ASSERT_EQUAL_UINT32(0, event_cnt);
+    TEST_PRINTF("LV_EVENT_COVER_CHECK: %u ns with 4 unrelated callbacks, %u ns without callbacks",
+                (unsigned)((uint64_t)t_cb * 1000 / send_cnt), (unsigned)((uint64_t)t_plain * 1000 / send_cnt));
+
+    lv_obj_del(obj_cb);
+    lv_obj_del(obj_plain);
+}
+
 #endif
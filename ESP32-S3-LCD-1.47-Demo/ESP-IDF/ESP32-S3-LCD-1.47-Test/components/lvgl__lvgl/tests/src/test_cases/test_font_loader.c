@@ -25,7 +25,11 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+#if LV_MEM_CUSTOM == 0
+static uint32_t get_mem_used(void);
+#endif
 void test_font_loader(void);
+void test_font_loader_mmap(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -72,6 +76,53 @@ void test_font_loader(void)
     lv_font_free(font_3_bin);
 }
 
+void test_font_loader_mmap(void)
+{
+    /*The glyph headers of this font are byte aligned so the bitmaps can be used in place from the mapped file*/
+#if LV_MEM_CUSTOM == 0
+    uint32_t used_start = get_mem_used();
+#endif
+    lv_font_t * font_mapped = lv_font_load("B:src/test_fonts/font_3_aligned.fnt");
+#if LV_MEM_CUSTOM == 0
+    uint32_t used_mapped = get_mem_used() - used_start;
+#endif
+
+    /*Without mapping the bitmaps are copied*/
+    lv_fs_drv_t * drv = lv_fs_get_drv('B');
+    const void * (*mmap_cb)(lv_fs_drv_t *, void *, uint32_t *) = drv->mmap_cb;
+    drv->mmap_cb = NULL;
+#if LV_MEM_CUSTOM == 0
+    used_start = get_mem_used();
+#endif
+    lv_font_t * font_copied = lv_font_load("B:src/test_fonts/font_3_aligned.fnt");
+#if LV_MEM_CUSTOM == 0
+    uint32_t used_copied = get_mem_used() - used_start;
+#endif
+    drv->mmap_cb = mmap_cb;
+
+    TEST_ASSERT_NOT_NULL(font_mapped);
+    TEST_ASSERT_NOT_NULL(font_copied);
+    compare_fonts(&font_3, font_mapped);
+    compare_fonts(&font_3, font_copied);
+
+    lv_font_free(font_mapped);
+    lv_font_free(font_copied);
+
+    /*The system heap can't be monitored*/
+#if LV_MEM_CUSTOM == 0
+    TEST_ASSERT_LESS_THAN(used_copied, used_mapped);
+#endif
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t get_mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+#endif
+
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
 {
     TEST_ASSERT_NOT_NULL_MESSAGE(f1, "font not null");
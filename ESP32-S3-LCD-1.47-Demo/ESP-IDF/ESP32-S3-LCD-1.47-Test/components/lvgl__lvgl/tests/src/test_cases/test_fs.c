@@ -3,10 +3,80 @@
 
 #include "unity/unity.h"
 
+#include <time.h>
+
+#define BENCH_FILE          "/tmp/lv_test_fs_bench.bin"
+#define BENCH_FILE_SIZE     (64 * 1024)
+#define BENCH_CALL_US       50      /*Latency of a read of the throttled storage*/
+#define BENCH_BYTE_NS       10      /*About 100 MB/s*/
+
 
 const char * read_exp =
     "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Etiam sed maximus orci. Morbi massa nisi, varius eu convallis ac, venenatis at metus. In in nibh id urna pretium feugiat vitae eu libero. Ut eget fringilla eros. Nunc ullamcorper lectus mauris, vel rhoncus velit volutpat et. Phasellus sed molestie massa. Maecenas quis dui sollicitudin, vulputate nunc ut, dictum quam. Nam a congue lorem. Nulla non facilisis sapien. Ut luctus nulla nibh, sed finibus urna porta non. Duis aliquet augue id urna euismod auctor. Integer pellentesque vulputate enim non mattis. Donec finibus mattis dolor, et feugiat nisi pharetra porta. Mauris ullamcorper cursus magna. Orci varius natoque penatibus et magnis dis parturient montes, nascetur ridiculus mus.";
 
+static lv_fs_res_t (*orig_read_cb)(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_drv_t * hooked_drv;
+static uint16_t orig_cache_size;
+static uint32_t read_cnt;
+static bool throttle;
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Count the reads of the driver and make them as slow as an SD card or an SPI flash if `throttle` is set*/
+static lv_fs_res_t counting_read_cb(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    read_cnt++;
+    if(throttle) {
+        uint32_t t = time_us();
+        uint32_t wait = BENCH_CALL_US + btr * BENCH_BYTE_NS / 1000;
+        while(time_us() - t < wait);
+    }
+    return orig_read_cb(drv, file_p, buf, btr, br);
+}
+
+static lv_fs_drv_t * hook_drv(char letter, uint16_t cache_size, uint8_t block_cnt)
+{
+    lv_fs_drv_t * drv = lv_fs_get_drv(letter);
+    hooked_drv = drv;
+    orig_read_cb = drv->read_cb;
+    orig_cache_size = drv->cache_size;
+    drv->read_cb = counting_read_cb;
+    drv->cache_size = cache_size;
+    drv->cache_block_cnt = block_cnt;
+    read_cnt = 0;
+    return drv;
+}
+
+static void unhook_drv(void)
+{
+    if(hooked_drv == NULL) return;
+    hooked_drv->read_cb = orig_read_cb;
+    hooked_drv->cache_size = orig_cache_size;
+    hooked_drv->cache_block_cnt = 0;
+    hooked_drv = NULL;
+}
+
+static uint32_t read_all(const char * path, uint32_t chunk)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_RD));
+    uint8_t buf[256];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, chunk, &br));
+        TEST_ASSERT_TRUE(memcmp(buf, read_exp + cnt, br) == 0);
+        cnt += br;
+    }
+    lv_fs_close(&f);
+    return cnt;
+}
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -15,6 +85,9 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    unhook_drv();
+    throttle = false;
+    lv_fs_set_block_cache_size(0);
 }
 #include <stdio.h>
 void test_read(void)
@@ -50,4 +123,249 @@ void test_read(void)
     lv_fs_close(&fb);
 }
 
+void test_read_random(void)
+{
+    hook_drv('A', 100, 4);
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:src/test_files/readtest.txt", LV_FS_MODE_RD));
+
+    /*The file ends with a '\0'*/
+    uint32_t len = strlen(read_exp) + 1;
+    uint32_t size;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, 0, LV_FS_SEEK_END));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_tell(&f, &size));
+    TEST_ASSERT_EQUAL(len, size);
+
+    /*Seeks and reads of any size, also larger than the blocks and over the end*/
+    uint8_t buf[512];
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        uint32_t pos = lv_rand(0, len);
+        uint32_t btr = lv_rand(1, sizeof(buf));
+        if(i % 3) {
+            TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, pos, LV_FS_SEEK_SET));
+        }
+        else {
+            uint32_t cur;
+            lv_fs_tell(&f, &cur);
+            if(cur > len) cur = len;
+            TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_seek(&f, pos - cur, LV_FS_SEEK_CUR));
+        }
+
+        uint32_t br;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, btr, &br));
+        TEST_ASSERT_EQUAL(LV_MIN(btr, len - pos), br);
+        TEST_ASSERT_TRUE(memcmp(buf, read_exp + pos, br) == 0);
+
+        uint32_t cur;
+        lv_fs_tell(&f, &cur);
+        TEST_ASSERT_EQUAL(pos + br, cur);
+    }
+
+    lv_fs_close(&f);
+}
+
+void test_read_ahead(void)
+{
+    /*Small sequential reads: one read per block...*/
+    lv_fs_drv_t * drv = hook_drv('A', 50, 1);
+    TEST_ASSERT_EQUAL(strlen(read_exp) + 1, read_all("A:src/test_files/readtest.txt", 10));
+    uint32_t read_cnt_1 = read_cnt;
+
+    /*...or more and more blocks at once*/
+    drv->cache_block_cnt = 8;
+    read_cnt = 0;
+    TEST_ASSERT_EQUAL(strlen(read_exp) + 1, read_all("A:src/test_files/readtest.txt", 10));
+    TEST_ASSERT_LESS_THAN(read_cnt_1 / 2, read_cnt);
+
+    /*Whole blocks are read directly*/
+    read_cnt = 0;
+    TEST_ASSERT_EQUAL(strlen(read_exp) + 1, read_all("A:src/test_files/readtest.txt", 200));
+    TEST_ASSERT_LESS_OR_EQUAL(6, read_cnt);
+}
+
+void test_shared_block_cache(void)
+{
+    lv_fs_set_block_cache_size(4096);
+    hook_drv('A', 64, 2);
+    read_all("A:src/test_files/readtest.txt", 33);
+    TEST_ASSERT_NOT_EQUAL(0, read_cnt);
+
+    /*Opened again: everything is in the cache*/
+    read_cnt = 0;
+    read_all("A:src/test_files/readtest.txt", 17);
+    TEST_ASSERT_EQUAL(0, read_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, lv_fs_get_block_cache()->hit_cnt);
+
+    lv_fs_set_block_cache_size(0);
+    TEST_ASSERT_NULL(lv_fs_get_block_cache());
+}
+
+void test_write_invalidates_cache(void)
+{
+    lv_fs_set_block_cache_size(4096);
+    hook_drv('B', 16, 4);
+
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_WR | LV_FS_MODE_RD));
+    uint32_t bw;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, read_exp, 100, &bw));
+    TEST_ASSERT_EQUAL(100, bw);
+
+    /*Read it back then overwrite the middle while it's cached*/
+    uint8_t buf[100];
+    uint32_t br;
+    lv_fs_seek(&f, 0, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, 40, &br));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, "0123456789", 10, &bw));
+    lv_fs_close(&f);
+
+    /*The other handle doesn't see the old blocks either*/
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, 100, &br));
+    TEST_ASSERT_EQUAL(100, br);
+    TEST_ASSERT_TRUE(memcmp(buf, read_exp, 40) == 0);
+    TEST_ASSERT_TRUE(memcmp(buf + 40, "0123456789", 10) == 0);
+    TEST_ASSERT_TRUE(memcmp(buf + 50, read_exp + 50, 50) == 0);
+    lv_fs_close(&f);
+
+    lv_fs_set_block_cache_size(0);
+    remove(BENCH_FILE);
+}
+
+void test_mmap(void)
+{
+    /*Both drivers can map the files*/
+    const char * paths[] = {"A:src/test_files/readtest.txt", "B:src/test_files/readtest.txt"};
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_fs_file_t f;
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, paths[i], LV_FS_MODE_RD));
+        uint32_t size;
+        const char * map = lv_fs_mmap(&f, &size);
+        TEST_ASSERT_NOT_NULL(map);
+        TEST_ASSERT_EQUAL(strlen(read_exp) + 1, size);
+        TEST_ASSERT_EQUAL_STRING(read_exp, map);
+        TEST_ASSERT_EQUAL_PTR(map, lv_fs_mmap(&f, NULL));
+
+        /*Reading still works*/
+        char buf[16];
+        uint32_t br;
+        lv_fs_seek(&f, 100, LV_FS_SEEK_SET);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+        TEST_ASSERT_EQUAL_MEMORY(map + 100, buf, sizeof(buf));
+        lv_fs_close(&f);
+    }
+}
+
+void test_mmap_img(void)
+{
+    lv_img_header_t header;
+    lv_memset_00(&header, sizeof(header));
+    header.cf = LV_IMG_CF_TRUE_COLOR;
+    header.w = 20;
+    header.h = 10;
+    lv_color_t px[20 * 10];
+    for(uint32_t i = 0; i < 20 * 10; i++) px[i] = lv_color_hex(i * 0x010203);
+
+    FILE * fp = fopen("/tmp/lv_test_fs_mmap.bin", "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    fwrite(&header, sizeof(header), 1, fp);
+    fwrite(px, sizeof(px), 1, fp);
+    fclose(fp);
+
+    /*The pixels are used in place from the mapped file...*/
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "B:/tmp/lv_test_fs_mmap.bin", lv_color_black(), 0));
+    TEST_ASSERT_NOT_NULL(dsc.img_data);
+    TEST_ASSERT_EQUAL_MEMORY(px, dsc.img_data, sizeof(px));
+    TEST_ASSERT_TRUE(_lv_img_decoder_built_in_is_mapped(&dsc));
+    lv_img_decoder_close(&dsc);
+
+    /*...or read line by line if the driver can't map*/
+    lv_fs_drv_t * drv = lv_fs_get_drv('B');
+    const void * (*mmap_cb)(lv_fs_drv_t *, void *, uint32_t *) = drv->mmap_cb;
+    drv->mmap_cb = NULL;
+    lv_res_t res = lv_img_decoder_open(&dsc, "B:/tmp/lv_test_fs_mmap.bin", lv_color_black(), 0);
+    drv->mmap_cb = mmap_cb;
+    TEST_ASSERT_EQUAL(LV_RES_OK, res);
+    TEST_ASSERT_NULL(dsc.img_data);
+    lv_color_t line[20];
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 3, 20, (uint8_t *)line));
+    TEST_ASSERT_EQUAL_MEMORY(&px[3 * 20], line, sizeof(line));
+    lv_img_decoder_close(&dsc);
+
+    remove("/tmp/lv_test_fs_mmap.bin");
+}
+
+/*Read like the decoders: a header, then small pieces sequentially or rows from the bottom*/
+static void bench_pattern(uint32_t * seq_us, uint32_t * rows_us, uint32_t * reopen_us)
+{
+    uint8_t buf[512];
+    uint32_t br, i;
+    lv_fs_file_t f;
+
+    uint32_t t = time_us();
+    lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_RD);
+    for(i = 0; i < BENCH_FILE_SIZE / 16; i++) lv_fs_read(&f, buf, 16, &br);
+    lv_fs_close(&f);
+    *seq_us = time_us() - t;
+
+    t = time_us();
+    lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_RD);
+    lv_fs_read(&f, buf, 54, &br);
+    for(i = 0; i < BENCH_FILE_SIZE / 480 - 1; i++) {
+        lv_fs_seek(&f, 54 + (BENCH_FILE_SIZE / 480 - 2 - i) * 480, LV_FS_SEEK_SET);
+        lv_fs_read(&f, buf, 480, &br);
+    }
+    lv_fs_close(&f);
+    *rows_us = time_us() - t;
+
+    /*Get the info of the image in one open, then decode it in another*/
+    t = time_us();
+    lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_RD);
+    lv_fs_read(&f, buf, 54, &br);
+    lv_fs_close(&f);
+    lv_fs_open(&f, "B:" BENCH_FILE, LV_FS_MODE_RD);
+    for(i = 0; i < BENCH_FILE_SIZE / 64; i++) lv_fs_read(&f, buf, 64, &br);
+    lv_fs_close(&f);
+    *reopen_us = time_us() - t;
+}
+
+void test_bench_throttled(void)
+{
+    FILE * fp = fopen(BENCH_FILE, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    uint32_t i;
+    for(i = 0; i < BENCH_FILE_SIZE; i++) fputc(i & 0xff, fp);
+    fclose(fp);
+
+    static const struct {
+        const char * name;
+        uint16_t cache_size;
+        uint8_t block_cnt;
+        uint32_t shared_size;
+    } cfg[] = {
+        {"no cache", 0, 0, 0},
+        {"512 B x 1", 512, 1, 0},
+        {"512 B x 8", 512, 8, 0},
+        {"512 B x 8, 32 kB shared", 512, 8, 32 * 1024},
+    };
+
+    throttle = true;
+    for(i = 0; i < sizeof(cfg) / sizeof(cfg[0]); i++) {
+        lv_fs_set_block_cache_size(cfg[i].shared_size);
+        hook_drv('B', cfg[i].cache_size, cfg[i].block_cnt);
+        uint32_t seq_us, rows_us, reopen_us;
+        bench_pattern(&seq_us, &rows_us, &reopen_us);
+        TEST_PRINTF("%s: sequential 16 B %u us, rows from the bottom %u us, reopen %u us (%u reads)", cfg[i].name,
+                    (unsigned)seq_us, (unsigned)rows_us, (unsigned)reopen_us, (unsigned)read_cnt);
+        unhook_drv();
+    }
+    throttle = false;
+
+    lv_fs_set_block_cache_size(0);
+    remove(BENCH_FILE);
+}
+
 #endif
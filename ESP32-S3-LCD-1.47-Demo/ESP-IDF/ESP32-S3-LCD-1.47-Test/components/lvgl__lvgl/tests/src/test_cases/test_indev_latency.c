@@ -0,0 +1,185 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_indev.h"
+
+#define CLICK_CNT   10
+
+static uint32_t refr_cnt;
+static uint32_t latency_cnt;
+static uint32_t latency_sum;
+static uint32_t latency_last;
+
+/*Keys to return in one read with `continue_reading`*/
+static const uint32_t key_queue[] = {LV_KEY_RIGHT, LV_KEY_RIGHT, LV_KEY_RIGHT};
+static uint32_t key_queue_p;
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+    LV_UNUSED(px);
+    refr_cnt++;
+}
+
+static void latency_cb(lv_indev_drv_t * indev_drv, uint32_t latency)
+{
+    LV_UNUSED(indev_drv);
+    latency_cnt++;
+    latency_sum += latency;
+    latency_last = latency;
+}
+
+/*Press and release every key of the queue*/
+static void queue_read_cb(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    LV_UNUSED(drv);
+    uint32_t i = key_queue_p / 2;
+    if(i >= sizeof(key_queue) / sizeof(key_queue[0])) {
+        data->key = key_queue[0];
+        data->state = LV_INDEV_STATE_RELEASED;
+        return;
+    }
+
+    data->key = key_queue[i];
+    data->state = key_queue_p % 2 ? LV_INDEV_STATE_RELEASED : LV_INDEV_STATE_PRESSED;
+    key_queue_p++;
+    data->continue_reading = true;
+}
+
+/*Read the mouse once and run the timers once. The refresh timer is not due by itself.*/
+static void read_mouse_once(void)
+{
+    lv_timer_reset(lv_disp_get_default()->refr_timer);
+    lv_timer_ready(lv_test_mouse_indev->driver->read_timer);
+    refr_cnt = 0;
+    latency_cnt = 0;
+    lv_timer_handler();
+}
+
+void setUp(void)
+{
+    lv_disp_get_default()->driver->monitor_cb = monitor_cb;
+    lv_test_mouse_indev->driver->latency_cb = latency_cb;
+    lv_test_mouse_release();
+    lv_test_indev_wait(50);
+    refr_cnt = 0;
+    latency_cnt = 0;
+    latency_sum = 0;
+}
+
+void tearDown(void)
+{
+    lv_disp_get_default()->driver->monitor_cb = NULL;
+    lv_test_mouse_indev->driver->latency_cb = NULL;
+    lv_test_mouse_indev->driver->refr_on_input = 0;
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_indev_latency_refr_on_input(void)
+{
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_size(btn, 200, 100);
+    lv_obj_center(btn);
+    lv_test_mouse_move_to(400, 240);
+    lv_test_indev_wait(50);
+
+    /*The press is shown only by the periodic refresh*/
+    lv_test_mouse_indev->driver->refr_on_input = 0;
+    lv_test_mouse_press();
+    read_mouse_once();
+    TEST_ASSERT_TRUE(lv_obj_has_state(btn, LV_STATE_PRESSED));
+    TEST_ASSERT_EQUAL_UINT32(0, refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, latency_cnt);
+    lv_test_indev_wait(LV_DISP_DEF_REFR_PERIOD * 2);
+    TEST_ASSERT_EQUAL_UINT32(1, latency_cnt);
+
+    /*The release is shown right after reading it*/
+    lv_test_mouse_indev->driver->refr_on_input = 1;
+    lv_test_mouse_release();
+    read_mouse_once();
+    TEST_ASSERT_FALSE(lv_obj_has_state(btn, LV_STATE_PRESSED));
+    TEST_ASSERT_EQUAL_UINT32(1, refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, latency_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(LV_DISP_DEF_REFR_PERIOD, latency_last);
+
+    /*Moving over the screen doesn't change anything to show once the transitions are ready*/
+    lv_test_indev_wait(500);
+    lv_test_mouse_move_to(20, 20);
+    read_mouse_once();
+    TEST_ASSERT_EQUAL_UINT32(0, refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, latency_cnt);
+}
+
+void test_indev_latency_coalesce(void)
+{
+    lv_obj_t * slider = lv_slider_create(lv_scr_act());
+    lv_obj_center(slider);
+    lv_group_t * g = lv_group_create();
+    lv_group_add_obj(g, slider);
+
+    static lv_indev_drv_t drv;
+    lv_indev_drv_init(&drv);
+    drv.type = LV_INDEV_TYPE_KEYPAD;
+    drv.read_cb = queue_read_cb;
+    drv.latency_cb = latency_cb;
+    drv.refr_on_input = 1;
+    lv_indev_t * indev = lv_indev_drv_register(&drv);
+    lv_indev_set_group(indev, g);
+    lv_refr_now(NULL);
+
+    /*All the buffered key presses are drawn in one refresh*/
+    key_queue_p = 0;
+    lv_timer_reset(lv_disp_get_default()->refr_timer);
+    lv_timer_ready(drv.read_timer);
+    refr_cnt = 0;
+    latency_cnt = 0;
+    lv_timer_handler();
+
+    TEST_ASSERT_EQUAL_INT32(3, lv_slider_get_value(slider));
+    TEST_ASSERT_EQUAL_UINT32(1, refr_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, latency_cnt);
+
+    lv_indev_delete(indev);
+    lv_group_del(g);
+}
+
+/*Click a button while an animation keeps the display refreshing and return the average latency*/
+static uint32_t click_latency(bool refr_on_input)
+{
+    lv_test_mouse_indev->driver->refr_on_input = refr_on_input;
+    latency_cnt = 0;
+    latency_sum = 0;
+
+    uint32_t i;
+    for(i = 0; i < CLICK_CNT; i++) {
+        lv_test_mouse_click_at(400, 240);
+        /*Change the phase between reading the mouse and refreshing*/
+        lv_test_indev_wait(7);
+    }
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(CLICK_CNT, latency_cnt);
+    return latency_sum / latency_cnt;
+}
+
+void test_indev_latency_simulated_clicks(void)
+{
+    lv_obj_t * btn = lv_btn_create(lv_scr_act());
+    lv_obj_set_size(btn, 200, 100);
+    lv_obj_center(btn);
+
+    lv_obj_t * spinner = lv_spinner_create(lv_scr_act(), 1000, 60);
+    lv_obj_set_size(spinner, 60, 60);
+    lv_obj_set_pos(spinner, 20, 20);
+
+    uint32_t latency_off = click_latency(false);
+    uint32_t latency_on = click_latency(true);
+
+    TEST_PRINTF("average input to flush latency: %u ms without and %u ms with refr_on_input",
+                (unsigned)latency_off, (unsigned)latency_on);
+    TEST_ASSERT_LESS_THAN_UINT32(LV_DISP_DEF_REFR_PERIOD / 2, latency_on);
+}
+
+#endif
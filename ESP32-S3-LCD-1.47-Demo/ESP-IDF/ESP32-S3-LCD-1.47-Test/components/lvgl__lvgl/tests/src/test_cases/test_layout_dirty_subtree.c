@@ -0,0 +1,139 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define ROW_CNT     500
+#define ITER_CNT    50
+
+static lv_obj_t * list;
+static lv_obj_t * labels[ROW_CNT];
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Make the next layout update walk the whole tree as if nothing was known about the clean subtrees*/
+static void mark_all_children_dirty(lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+    if(child_cnt) obj->child_layout_inv = 1;
+    for(i = 0; i < child_cnt; i++) {
+        mark_all_children_dirty(lv_obj_get_child(obj, i));
+    }
+}
+
+static bool has_dirty_child(lv_obj_t * obj)
+{
+    if(obj->child_layout_inv || obj->layout_inv) return true;
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        if(has_dirty_child(lv_obj_get_child(obj, i))) return true;
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    list = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(list, 300, 400);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(list);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        labels[i] = lv_label_create(row);
+        lv_label_set_text_fmt(labels[i], "Row %d", (int)i);
+    }
+
+    lv_obj_update_layout(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_layout_dirty_subtree_leaves_clean_tree(void)
+{
+    TEST_ASSERT_FALSE(has_dirty_child(lv_scr_act()));
+
+    lv_label_set_text(labels[ROW_CNT / 2], "A\nlonger\nrow");
+    TEST_ASSERT_TRUE(lv_scr_act()->child_layout_inv);
+    TEST_ASSERT_TRUE(list->child_layout_inv);
+    TEST_ASSERT_FALSE(lv_obj_get_parent(labels[0])->child_layout_inv);
+
+    lv_obj_update_layout(lv_scr_act());
+    TEST_ASSERT_FALSE(has_dirty_child(lv_scr_act()));
+}
+
+void test_layout_dirty_subtree_same_as_full(void)
+{
+    lv_obj_t * row_changed = lv_obj_get_parent(labels[ROW_CNT / 2]);
+    lv_obj_t * row_next = lv_obj_get_parent(labels[ROW_CNT / 2 + 1]);
+    lv_coord_t h_ori = lv_obj_get_height(row_changed);
+
+    lv_label_set_text(labels[ROW_CNT / 2], "A\nlonger\nrow");
+    lv_obj_update_layout(lv_scr_act());
+    TEST_ASSERT_GREATER_THAN(h_ori, lv_obj_get_height(row_changed));
+    TEST_ASSERT_EQUAL(row_changed->coords.y2 + 1 + lv_obj_get_style_pad_row(list, LV_PART_MAIN), row_next->coords.y1);
+
+    /*Relayout everything: nothing should move*/
+    static lv_area_t coords[ROW_CNT];
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) coords[i] = labels[i]->coords;
+
+    for(i = 0; i < ROW_CNT; i++) lv_obj_mark_layout_as_dirty(lv_obj_get_parent(labels[i]));
+    lv_obj_mark_layout_as_dirty(list);
+    lv_obj_update_layout(lv_scr_act());
+
+    for(i = 0; i < ROW_CNT; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(&coords[i], &labels[i]->coords, sizeof(lv_area_t));
+    }
+}
+
+/*Toggle the text of a label and return the average layout update time in us.
+ *Only the walk differs: the updated flex container places all of its rows in both cases.*/
+static uint32_t measure(lv_obj_t * label, bool full_walk)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < ITER_CNT; i++) {
+        lv_label_set_text(label, i % 2 ? "Short" : "A\nlonger\nrow");
+        if(full_walk) mark_all_children_dirty(lv_scr_act());
+
+        uint32_t t = time_us();
+        lv_obj_update_layout(lv_scr_act());
+        sum += time_us() - t;
+    }
+
+    return sum / ITER_CNT;
+}
+
+void test_layout_dirty_subtree_benchmark(void)
+{
+    /*The row grows with the label so the list has to be updated too*/
+    lv_obj_t * label = labels[ROW_CNT / 2];
+    uint32_t full = measure(label, true);
+    uint32_t dirty = measure(label, false);
+    TEST_PRINTF("resizing a row of %d: %u us walking the whole tree, %u us walking the dirty subtrees",
+                ROW_CNT, (unsigned)full, (unsigned)dirty);
+
+    /*The row has fixed size so only the label changes*/
+    label = labels[ROW_CNT / 4];
+    lv_obj_set_height(lv_obj_get_parent(label), 80);
+    full = measure(label, true);
+    dirty = measure(label, false);
+    TEST_PRINTF("changing a label in a fixed size row of %d: %u us walking the whole tree, %u us walking the dirty subtrees",
+                ROW_CNT, (unsigned)full, (unsigned)dirty);
+}
+
+#endif
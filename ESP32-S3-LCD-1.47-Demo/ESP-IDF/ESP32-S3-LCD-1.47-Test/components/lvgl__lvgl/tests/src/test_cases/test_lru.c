@@ -0,0 +1,366 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/misc/lv_lru.h"
+#include "../src/draw/sw/lv_draw_sw_gradient.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define BENCH_ITEM_CNT  1000
+#define BENCH_ROUND_CNT 10
+
+static uint32_t free_cnt;
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void counting_free(void * v)
+{
+    free_cnt++;
+    lv_mem_free(v);
+}
+
+static void * new_value(uint32_t size)
+{
+    void * v = lv_mem_alloc(size);
+    lv_memset_00(v, size);
+    return v;
+}
+
+static lv_lru_res_t set_key(lv_lru_t * cache, uint32_t key, uint32_t size)
+{
+    void * v = new_value(size);
+    lv_lru_res_t res = lv_lru_set(cache, &key, sizeof(key), v, size);
+    if(res != LV_LRU_OK) lv_mem_free(v);
+    return res;
+}
+
+static bool has_key(lv_lru_t * cache, uint32_t key)
+{
+    void * v;
+    lv_lru_get(cache, &key, sizeof(key), &v);
+    return v != NULL;
+}
+
+static bool match_even(const void * key, size_t key_length, void * value, void * user_data)
+{
+    LV_UNUSED(key_length);
+    LV_UNUSED(value);
+    LV_UNUSED(user_data);
+    uint32_t k;
+    lv_memcpy(&k, key, sizeof(k));
+    return (k & 1) == 0;
+}
+
+void setUp(void)
+{
+    free_cnt = 0;
+}
+
+void test_lru_evict_least_recently_used(void)
+{
+    lv_lru_t * cache = lv_lru_create(100, 10, counting_free, NULL);
+    uint32_t i;
+    for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, i, 10));
+
+    /*Use 0 so 1 is the oldest*/
+    TEST_ASSERT_TRUE(has_key(cache, 0));
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 10, 10));
+    TEST_ASSERT_TRUE(has_key(cache, 0));
+    TEST_ASSERT_FALSE(has_key(cache, 1));
+    TEST_ASSERT_TRUE(has_key(cache, 2));
+    TEST_ASSERT_EQUAL(1, free_cnt);
+
+    /*A larger item evicts several*/
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 11, 30));
+    TEST_ASSERT_FALSE(has_key(cache, 3));
+    TEST_ASSERT_FALSE(has_key(cache, 4));
+    TEST_ASSERT_FALSE(has_key(cache, 5));
+    TEST_ASSERT_TRUE(has_key(cache, 6));
+    TEST_ASSERT_EQUAL(0, cache->free_memory);
+    TEST_ASSERT_EQUAL(8, cache->item_cnt);
+    TEST_ASSERT_EQUAL(4, cache->evict_cnt);
+
+    /*Replacing a key frees the old value*/
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 11, 10));
+    TEST_ASSERT_EQUAL(20, cache->free_memory);
+    TEST_ASSERT_EQUAL(LV_LRU_VALUE_TOO_LARGE, set_key(cache, 12, 101));
+
+    TEST_ASSERT_EQUAL(4, cache->hit_cnt);
+    TEST_ASSERT_EQUAL(4, cache->miss_cnt);
+
+    lv_lru_del(cache);
+    TEST_ASSERT_EQUAL(13, free_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_pin(void)
+{
+    lv_lru_t * cache = lv_lru_create(30, 10, counting_free, NULL);
+    uint32_t key = 0;
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 0, 10));
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 1, 10));
+    lv_lru_item_t * item = lv_lru_pin(cache, &key, sizeof(key));
+    TEST_ASSERT_NOT_NULL(item);
+    void * value = lv_lru_item_get_value(item);
+
+    /*The pinned item is not evicted although it's the oldest*/
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 2, 10));
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 3, 10));
+    TEST_ASSERT_TRUE(has_key(cache, 0));
+    TEST_ASSERT_FALSE(has_key(cache, 1));
+
+    /*Removed while pinned: freed only by the unpin*/
+    lv_lru_remove(cache, &key, sizeof(key));
+    TEST_ASSERT_FALSE(has_key(cache, 0));
+    TEST_ASSERT_EQUAL(1, free_cnt);
+    TEST_ASSERT_EQUAL_PTR(value, lv_lru_item_get_value(item));
+    lv_lru_unpin(cache, item);
+    TEST_ASSERT_EQUAL(2, free_cnt);
+    TEST_ASSERT_EQUAL(10, cache->free_memory);
+
+    /*No space if everything is pinned. The value is not taken then.*/
+    lv_lru_item_t * pinned[3];
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        uint32_t k = 10 + i;
+        TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set_pinned(cache, &k, sizeof(k), new_value(10), 10, &pinned[i]));
+    }
+    TEST_ASSERT_EQUAL(LV_LRU_NO_SPACE, set_key(cache, 20, 10));
+    TEST_ASSERT_EQUAL(4, free_cnt);
+
+    /*Pinned twice, released twice*/
+    key = 10;
+    TEST_ASSERT_EQUAL_PTR(pinned[0], lv_lru_pin(cache, &key, sizeof(key)));
+    lv_lru_unpin(cache, pinned[0]);
+    TEST_ASSERT_EQUAL(LV_LRU_NO_SPACE, set_key(cache, 20, 10));
+    lv_lru_unpin(cache, pinned[0]);
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 20, 10));
+    TEST_ASSERT_FALSE(has_key(cache, 10));
+
+    lv_lru_unpin(cache, pinned[1]);
+    lv_lru_unpin(cache, pinned[2]);
+    TEST_ASSERT_EQUAL(0, cache->pinned_cnt);
+    lv_lru_del(cache);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_pin_replace(void)
+{
+    lv_lru_t * cache = lv_lru_create(30, 10, counting_free, NULL);
+    uint32_t key = 0;
+    void * value = new_value(10);
+    lv_lru_item_t * item;
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set_pinned(cache, &key, sizeof(key), value, 10, &item));
+
+    /*Replaced with the same value: the pinned item keeps it, the new item owns it*/
+    TEST_ASSERT_EQUAL(LV_LRU_OK, lv_lru_set(cache, &key, sizeof(key), value, 10));
+    TEST_ASSERT_EQUAL_PTR(value, lv_lru_item_get_value(item));
+    TEST_ASSERT_EQUAL(20, cache->free_memory);
+    TEST_ASSERT_EQUAL(1, cache->removed_list.cnt);
+    lv_lru_unpin(cache, item);
+    TEST_ASSERT_EQUAL(0, free_cnt);
+    TEST_ASSERT_EQUAL(0, cache->removed_list.cnt);
+    TEST_ASSERT_TRUE(has_key(cache, 0));
+
+    /*Replaced with another value: the old one is freed by the unpin*/
+    item = lv_lru_pin(cache, &key, sizeof(key));
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 0, 10));
+    TEST_ASSERT_EQUAL_PTR(value, lv_lru_item_get_value(item));
+    TEST_ASSERT_EQUAL(10, cache->free_memory);
+    lv_lru_unpin(cache, item);
+    TEST_ASSERT_EQUAL(1, free_cnt);
+    TEST_ASSERT_EQUAL(20, cache->free_memory);
+
+    lv_lru_del(cache);
+    TEST_ASSERT_EQUAL(2, free_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_budget(void)
+{
+    lv_lru_budget_t budget;
+    lv_lru_budget_init(&budget, 100);
+    lv_lru_t * a = lv_lru_create(1000, 10, counting_free, NULL);
+    lv_lru_t * b = lv_lru_create(1000, 10, counting_free, NULL);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(a, i, 10));
+    lv_lru_set_budget(a, &budget);
+    TEST_ASSERT_EQUAL(50, budget.used_memory);
+    lv_lru_set_budget(b, &budget);
+
+    /*The globally oldest items go: the first ones of `a`*/
+    for(i = 0; i < 6; i++) TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(b, i, 10));
+    TEST_ASSERT_EQUAL(100, budget.used_memory);
+    TEST_ASSERT_FALSE(has_key(a, 0));
+    TEST_ASSERT_TRUE(has_key(a, 1));
+    TEST_ASSERT_EQUAL(1, a->evict_cnt);
+
+    /*`a` used 1 recently so 2 is the oldest now*/
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(b, 6, 10));
+    TEST_ASSERT_FALSE(has_key(a, 2));
+    TEST_ASSERT_TRUE(has_key(a, 1));
+    TEST_ASSERT_EQUAL(LV_LRU_VALUE_TOO_LARGE, set_key(b, 7, 101));
+
+    /*A smaller budget evicts immediately*/
+    lv_lru_budget_t small;
+    lv_lru_budget_init(&small, 20);
+    lv_lru_set_budget(a, &small);
+    TEST_ASSERT_EQUAL(70, budget.used_memory);
+    TEST_ASSERT_EQUAL(20, small.used_memory);
+    TEST_ASSERT_EQUAL(2, a->item_cnt);
+
+    lv_lru_del(a);
+    TEST_ASSERT_EQUAL(0, small.used_memory);
+    lv_lru_del(b);
+    TEST_ASSERT_EQUAL(0, budget.used_memory);
+    TEST_ASSERT_EQUAL(12, free_cnt);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_grow_and_remove_all(void)
+{
+    /*The guess is 8 slots but it grows with the items*/
+    lv_lru_t * cache = lv_lru_create(100000, 20000, counting_free, NULL);
+    TEST_ASSERT_EQUAL(8, cache->hash_table_size);
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, i, 4));
+    TEST_ASSERT_EQUAL(1024, cache->hash_table_size);
+    for(i = 0; i < 1000; i++) TEST_ASSERT_TRUE(has_key(cache, i));
+
+    lv_lru_remove_all(cache, match_even, NULL);
+    TEST_ASSERT_EQUAL(500, cache->item_cnt);
+    TEST_ASSERT_FALSE(has_key(cache, 10));
+    TEST_ASSERT_TRUE(has_key(cache, 11));
+
+    lv_lru_set_max_item_cnt(cache, 10);
+    TEST_ASSERT_EQUAL(10, cache->item_cnt);
+    TEST_ASSERT_TRUE(has_key(cache, 999));
+    TEST_ASSERT_EQUAL(LV_LRU_OK, set_key(cache, 2000, 4));
+    TEST_ASSERT_EQUAL(10, cache->item_cnt);
+
+    lv_lru_remove_all(cache, NULL, NULL);
+    TEST_ASSERT_EQUAL(0, cache->item_cnt);
+    TEST_ASSERT_EQUAL(100000, cache->free_memory);
+    TEST_ASSERT_EQUAL(1001, free_cnt);
+
+    lv_lru_del(cache);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_img_cache(void)
+{
+    static const lv_color_t px[4];
+    lv_img_dsc_t img;
+    lv_memset_00(&img, sizeof(img));
+    img.header.always_zero = 0;
+    img.header.w = 2;
+    img.header.h = 2;
+    img.header.cf = LV_IMG_CF_TRUE_COLOR;
+    img.data = (const uint8_t *)px;
+    img.data_size = sizeof(px);
+
+    lv_lru_t * lru = lv_img_cache_get_lru();
+    TEST_ASSERT_NOT_NULL(lru);
+    lv_img_cache_invalidate_src(NULL);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(&img, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_NOT_NULL(entry->lru_item);
+    TEST_ASSERT_EQUAL_PTR(entry, _lv_img_cache_open(&img, lv_color_black(), 0));
+    _lv_img_cache_entry_t * frame1 = _lv_img_cache_open(&img, lv_color_black(), 1);
+    TEST_ASSERT_TRUE(entry != frame1);
+    _lv_img_cache_close(frame1);
+    _lv_img_cache_close(entry);
+    _lv_img_cache_close(entry);
+    TEST_ASSERT_EQUAL(2, lru->item_cnt);
+
+    /*Invalidated while in use: closed when released*/
+    entry = _lv_img_cache_open(&img, lv_color_black(), 0);
+    lv_img_cache_invalidate_src(&img);
+    TEST_ASSERT_EQUAL(0, lru->item_cnt);
+    TEST_ASSERT_EQUAL_PTR(&img, entry->dec_dsc.src);
+    _lv_img_cache_close(entry);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_grad_cache(void)
+{
+    lv_grad_dsc_t g1;
+    lv_memset_00(&g1, sizeof(g1));
+    g1.dir = LV_GRAD_DIR_VER;
+    g1.stops_count = 2;
+    g1.stops[0].color = lv_color_black();
+    g1.stops[1].color = lv_color_white();
+    g1.stops[1].frac = 255;
+    lv_grad_dsc_t g2 = g1;
+
+    /*The same gradient at an other address is found in the cache*/
+    lv_grad_t * grad1 = lv_gradient_get(&g1, 10, 100);
+    TEST_ASSERT_NOT_NULL(grad1);
+    TEST_ASSERT_FALSE(grad1->not_cached);
+    lv_grad_t * grad2 = lv_gradient_get(&g2, 10, 100);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+    lv_gradient_cleanup(grad2);
+
+    /*An other gradient at the same address is not*/
+    g2.stops[1].color = lv_palette_main(LV_PALETTE_RED);
+    grad2 = lv_gradient_get(&g2, 10, 100);
+    TEST_ASSERT_TRUE(grad1 != grad2);
+    lv_gradient_cleanup(grad2);
+    lv_gradient_cleanup(grad1);
+
+    /*Larger than the cache: allocated for the draw only*/
+    grad1 = lv_gradient_get(&g1, 10, LV_GRAD_CACHE_DEF_SIZE);
+    TEST_ASSERT_TRUE(grad1->not_cached);
+    lv_gradient_cleanup(grad1);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+void test_lru_bench(void)
+{
+    static uint32_t keys[BENCH_ITEM_CNT * 2];
+    uint32_t i, r;
+    for(i = 0; i < BENCH_ITEM_CNT * 2; i++) keys[i] = i * 2654435761u;   /*Distinct but scattered*/
+
+    /*Full cache: every set evicts the least recently used item*/
+    lv_lru_t * cache = lv_lru_create(BENCH_ITEM_CNT * 16, 16, NULL, NULL);
+    for(i = 0; i < BENCH_ITEM_CNT; i++) lv_lru_set(cache, &keys[i], sizeof(uint32_t), new_value(16), 16);
+
+    uint32_t base = 0;
+    uint32_t t = time_us();
+    for(r = 0; r < BENCH_ROUND_CNT; r++) {
+        base = (r & 1) ? 0 : BENCH_ITEM_CNT;
+        for(i = 0; i < BENCH_ITEM_CNT; i++) {
+            lv_lru_set(cache, &keys[base + i], sizeof(uint32_t), new_value(16), 16);
+        }
+    }
+    uint32_t t_evict = time_us() - t;
+
+    volatile uint32_t hit = 0;
+    t = time_us();
+    for(r = 0; r < BENCH_ROUND_CNT; r++) {
+        for(i = 0; i < BENCH_ITEM_CNT; i++) {
+            void * v;
+            lv_lru_get(cache, &keys[base + i], sizeof(uint32_t), &v);
+            if(v) hit++;
+        }
+    }
+    uint32_t t_get = time_us() - t;
+    lv_lru_del(cache);
+
+    TEST_PRINTF("%u items: set with eviction %u ns, get %u ns", BENCH_ITEM_CNT,
+                (unsigned)((uint64_t)t_evict * 1000 / (BENCH_ROUND_CNT * BENCH_ITEM_CNT)),
+                (unsigned)((uint64_t)t_get * 1000 / (BENCH_ROUND_CNT * BENCH_ITEM_CNT)));
+    TEST_ASSERT_EQUAL(BENCH_ROUND_CNT * BENCH_ITEM_CNT, hit);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+}
+
+#endif
@@ -0,0 +1,247 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "../../demos/lv_demos.h"
+#include "../../src/misc/lv_gc.h"
+
+#include <time.h>
+
+#define PATTERN_CNT     100000
+#define FRAME_CNT       3
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_mem_buf_free_all();
+}
+
+void test_mem_buf_out_of_scope(void)
+{
+#if LV_MEM_CUSTOM == 0
+    lv_mem_buf_free_all();
+
+    /*The first chunk is kept when no buffers are used so the next buffers don't need the heap*/
+    uint32_t used = mem_used();
+    void * a = lv_mem_buf_get(100);
+    void * b = lv_mem_buf_get(100);
+    uint32_t used_chunk = mem_used();
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(used + LV_MEM_BUF_CHUNK_SIZE, used_chunk);
+    lv_mem_buf_release(a);
+    lv_mem_buf_release(b);
+    TEST_ASSERT_EQUAL_UINT32(used_chunk, mem_used());
+
+    uint32_t chunk_alloc_cnt = LV_GC_ROOT(lv_mem_buf).chunk_alloc_cnt;
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_PTR(a, lv_mem_buf_get(100 + i));
+        lv_mem_buf_release(a);
+    }
+    TEST_ASSERT_EQUAL_UINT32(chunk_alloc_cnt, LV_GC_ROOT(lv_mem_buf).chunk_alloc_cnt);
+
+    /*Out of the scopes the other chunks are freed when they aren't used*/
+    a = lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE / 2);
+    b = lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE);
+    lv_mem_buf_release(b);
+    lv_mem_buf_release(a);
+    TEST_ASSERT_EQUAL_UINT32(used_chunk, mem_used());
+
+    /*In a scope the other chunks are kept for reuse until the scope is closed*/
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    a = lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE / 2);
+    b = lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE);
+    lv_mem_buf_release(b);
+    lv_mem_buf_release(a);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(used_chunk + LV_MEM_BUF_CHUNK_SIZE, mem_used());
+    lv_mem_buf_release_to(mark);
+    TEST_ASSERT_EQUAL_UINT32(used_chunk, mem_used());
+
+    lv_mem_buf_free_all();
+    TEST_ASSERT_EQUAL_UINT32(used, mem_used());
+#endif
+}
+
+void test_mem_buf_release_order(void)
+{
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    uint8_t * a = lv_mem_buf_get(100);
+    uint8_t * b = lv_mem_buf_get(200);
+    uint8_t * c = lv_mem_buf_get(50);
+    TEST_ASSERT_TRUE(a + 100 <= b && b + 200 <= c);
+
+    /*The space of `a` can be reused only when the buffers after it are released too*/
+    lv_mem_buf_release(a);
+    lv_mem_buf_release(c);
+    TEST_ASSERT_EQUAL_PTR(c, lv_mem_buf_get(70));
+    lv_mem_buf_release(c);
+    lv_mem_buf_release(b);
+    TEST_ASSERT_EQUAL_PTR(a, lv_mem_buf_get(400));
+    lv_mem_buf_release(a);
+    lv_mem_buf_release_to(mark);
+}
+
+void test_mem_buf_large(void)
+{
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    uint8_t * a = lv_mem_buf_get(100);
+    uint8_t * large = lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE * 3);
+    lv_memset(large, 0x55, LV_MEM_BUF_CHUNK_SIZE * 3);
+    uint8_t * b = lv_mem_buf_get(100);
+    TEST_ASSERT_EQUAL_UINT8(0x55, large[LV_MEM_BUF_CHUNK_SIZE * 3 - 1]);
+
+    /*The chunk of the large buffer is kept for reuse until the end of the frame*/
+    lv_mem_buf_release(b);
+    lv_mem_buf_release(large);
+    TEST_ASSERT_EQUAL_PTR(large, lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE * 2));
+    lv_mem_buf_release(large);
+    lv_mem_buf_release(a);
+    TEST_ASSERT_EQUAL_PTR(a, lv_mem_buf_get(10));
+    lv_mem_buf_release(a);
+    lv_mem_buf_release_to(mark);
+}
+
+void test_mem_buf_scope(void)
+{
+    /*Out of the scopes the chunks would be freed, so the reuse depended on the heap*/
+    lv_mem_buf_mark_t frame = lv_mem_buf_mark();
+    uint8_t * outer = lv_mem_buf_get(100);
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    uint8_t * inner = lv_mem_buf_get(100);
+
+    /*A buffer of the outer scope released in the scope is reused only after the scope*/
+    lv_mem_buf_release(outer);
+    lv_mem_buf_release(inner);
+    uint8_t * p = lv_mem_buf_get(10);
+    TEST_ASSERT_TRUE(p > outer);
+    lv_mem_buf_release(p);
+
+    lv_mem_buf_release_to(mark);
+    TEST_ASSERT_EQUAL_PTR(outer, lv_mem_buf_get(10));
+    lv_mem_buf_release(outer);
+    lv_mem_buf_release_to(frame);
+}
+
+void test_mem_buf_release_to(void)
+{
+    /*In the debug mode the buffers not released in their scope are reported as leaks*/
+#if LV_USE_ASSERT_MEM_INTEGRITY == 0
+    uint8_t * outer = lv_mem_buf_get(100);
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    uint8_t * inner = lv_mem_buf_get(100);
+    uint32_t i;
+    for(i = 0; i < 100; i++) lv_mem_buf_get(LV_MEM_BUF_CHUNK_SIZE / 4);
+
+    lv_mem_buf_release_to(mark);
+    TEST_ASSERT_EQUAL_PTR(inner, lv_mem_buf_get(10));
+    lv_mem_buf_release(inner);
+    lv_mem_buf_release(outer);
+#endif
+}
+
+/*Cost of a `lv_mem_buf_get()` + `lv_mem_buf_release()` pair in ns*/
+static uint32_t bench_pattern(void)
+{
+    /*What drawing a masked rectangle does: line buffers, mask parameters and a short lived buffer*/
+    lv_mem_buf_mark_t mark = lv_mem_buf_mark();
+    uint32_t t = time_us();
+    uint32_t i;
+    for(i = 0; i < PATTERN_CNT; i++) {
+        uint32_t w = 100 + (i & 0xff);
+        uint8_t * mask_buf = lv_mem_buf_get(w);
+        lv_color_t * line_buf = lv_mem_buf_get(w * sizeof(lv_color_t));
+        void * param = lv_mem_buf_get(48);
+        mask_buf[0] = 1;
+        line_buf[0] = lv_color_black();
+        lv_mem_buf_release(param);
+        void * tmp = lv_mem_buf_get(32 + (i & 0x7));
+        lv_mem_buf_release(mask_buf);
+        lv_mem_buf_release(tmp);
+        lv_mem_buf_release(line_buf);
+    }
+    uint32_t t_pattern = (time_us() - t) * 1000 / (PATTERN_CNT * 4);
+    lv_mem_buf_release_to(mark);
+    return t_pattern;
+}
+
+void test_mem_buf_bench_pattern(void)
+{
+    TEST_PRINTF("lv_mem_buf_get() + lv_mem_buf_release(): %u ns", (unsigned)bench_pattern());
+}
+
+void test_mem_buf_bench_scenes(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    /*The count of the buffers and the heap allocations of the arena are measured in the scenes.
+     *The cost of a buffer is taken from the pattern as timing each call would cost more than the call.*/
+    uint32_t t_buf = bench_pattern();
+    lv_mem_buf_arena_t * arena = &LV_GC_ROOT(lv_mem_buf);
+    uint32_t t_sum = 0;
+    uint32_t get_sum = 0;
+    uint32_t chunk_alloc_sum = 0;
+    int_fast16_t scene_no;
+    for(scene_no = 0; ; scene_no++) {
+        lv_timer_t * timer_last = lv_timer_get_next(NULL);
+        lv_demo_benchmark_run_scene(scene_no);
+        /*The title, the subtitle and an empty scene background if there are no more scenes*/
+        lv_obj_t * scene_bg = lv_obj_get_child(lv_scr_act(), 2);
+        if(scene_bg == NULL || lv_obj_get_child_cnt(scene_bg) == 0) {
+            lv_demo_benchmark_close();
+            break;
+        }
+
+        uint32_t get_cnt = arena->get_cnt;
+        uint32_t chunk_alloc_cnt = arena->chunk_alloc_cnt;
+        uint32_t t = time_us();
+        uint32_t i;
+        for(i = 0; i < FRAME_CNT; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        t = time_us() - t;
+        get_cnt = arena->get_cnt - get_cnt;
+        chunk_alloc_cnt = arena->chunk_alloc_cnt - chunk_alloc_cnt;
+        t_sum += t;
+        get_sum += get_cnt;
+        chunk_alloc_sum += chunk_alloc_cnt;
+
+        /*ns / (us * 1000) in 0.1%*/
+        uint32_t buf_permille = (uint32_t)((uint64_t)get_cnt * t_buf / (t + 1));
+        TEST_PRINTF("scene %u: %u buffers, %u chunk allocations, %u us per frame, buffers: %u.%u percent",
+                    (unsigned)scene_no, (unsigned)(get_cnt / FRAME_CNT), (unsigned)chunk_alloc_cnt,
+                    (unsigned)(t / FRAME_CNT), (unsigned)(buf_permille / 10), (unsigned)(buf_permille % 10));
+
+        /*Delete the timer which would report the result of the scene*/
+        lv_timer_t * timer;
+        while((timer = lv_timer_get_next(NULL)) != timer_last) lv_timer_del(timer);
+        lv_demo_benchmark_close();
+    }
+    lv_disp_get_default()->driver->monitor_cb = NULL;
+
+    TEST_PRINTF("%u scenes, %u frames each: %u buffers and %u us per frame, %u chunk allocations, %u ns per buffer",
+                (unsigned)scene_no, (unsigned)FRAME_CNT, (unsigned)(get_sum / (scene_no * FRAME_CNT)),
+                (unsigned)(t_sum / (scene_no * FRAME_CNT)), (unsigned)chunk_alloc_sum,
+                (unsigned)t_buf);
+#endif
+}
+
+#endif
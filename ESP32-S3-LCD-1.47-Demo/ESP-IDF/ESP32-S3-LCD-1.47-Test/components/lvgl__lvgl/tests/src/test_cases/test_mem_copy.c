@@ -0,0 +1,244 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define ALIGN_CNT       16
+#define GUARD           32
+#define BUF_SIZE        (5000 + ALIGN_CNT + 2 * GUARD)
+#define GUARD_VALUE     0xa5
+#define BENCH_SIZE_MAX  (64 * 1024)
+#define BENCH_BYTES     (16 * 1024 * 1024)
+
+typedef void * (*copy_cb_t)(void * dst, const void * src, size_t len);
+typedef void (*set_cb_t)(void * dst, uint8_t v, size_t len);
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dst_buf[BUF_SIZE];
+static uint8_t ref_buf[BUF_SIZE];
+static uint8_t bench_src[BENCH_SIZE_MAX + ALIGN_CNT];
+static uint8_t bench_dst[BENCH_SIZE_MAX + ALIGN_CNT];
+
+static const size_t sizes[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65,
+                               100, 127, 128, 129, 255, 256, 257, 640, 1000, 4099, 5000
+                              };
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*The 32 bit loops used before, byte by byte if the source and destination are misaligned to each other*/
+static void * memcpy_loop32(void * dst, const void * src, size_t len)
+{
+    uint8_t * d8 = dst;
+    const uint8_t * s8 = src;
+    if(((lv_uintptr_t)d8 & 0x3) == ((lv_uintptr_t)s8 & 0x3)) {
+        while(((lv_uintptr_t)d8 & 0x3) && len) {
+            *d8++ = *s8++;
+            len--;
+        }
+        uint32_t * d32 = (uint32_t *)d8;
+        const uint32_t * s32 = (const uint32_t *)s8;
+        while(len > 4) {
+            *d32++ = *s32++;
+            len -= 4;
+        }
+        d8 = (uint8_t *)d32;
+        s8 = (const uint8_t *)s32;
+    }
+    while(len) {
+        *d8++ = *s8++;
+        len--;
+    }
+    return dst;
+}
+
+static void memset_loop32(void * dst, uint8_t v, size_t len)
+{
+    uint8_t * d8 = dst;
+    while(((lv_uintptr_t)d8 & 0x3) && len) {
+        *d8++ = v;
+        len--;
+    }
+    uint32_t v32 = v * 0x01010101U;
+    uint32_t * d32 = (uint32_t *)d8;
+    while(len > 4) {
+        *d32++ = v32;
+        len -= 4;
+    }
+    d8 = (uint8_t *)d32;
+    while(len) {
+        *d8++ = v;
+        len--;
+    }
+}
+
+static void * memcpy_lv(void * dst, const void * src, size_t len)
+{
+    return lv_memcpy(dst, src, len);
+}
+
+static void memset_lv(void * dst, uint8_t v, size_t len)
+{
+    lv_memset(dst, v, len);
+}
+
+static void memset_libc(void * dst, uint8_t v, size_t len)
+{
+    memset(dst, v, len);
+}
+
+static void memset_00_lv(void * dst, uint8_t v, size_t len)
+{
+    LV_UNUSED(v);
+    lv_memset_00(dst, len);
+}
+
+static void memset_ff_lv(void * dst, uint8_t v, size_t len)
+{
+    LV_UNUSED(v);
+    lv_memset_ff(dst, len);
+}
+
+static void fill_random(uint8_t * buf, size_t len, uint32_t seed)
+{
+    size_t i;
+    for(i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+/*Copy with all the alignments and sizes and check that nothing else is written*/
+static void check_copy(copy_cb_t cb)
+{
+    fill_random(src_buf, sizeof(src_buf), 1);
+    uint32_t s_ofs, d_ofs, i;
+    for(s_ofs = 0; s_ofs < ALIGN_CNT; s_ofs++) {
+        for(d_ofs = 0; d_ofs < ALIGN_CNT; d_ofs++) {
+            for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+                size_t len = sizes[i];
+                memset(dst_buf, GUARD_VALUE, sizeof(dst_buf));
+                memset(ref_buf, GUARD_VALUE, sizeof(ref_buf));
+                memcpy(ref_buf + GUARD + d_ofs, src_buf + GUARD + s_ofs, len);
+
+                void * res = cb(dst_buf + GUARD + d_ofs, src_buf + GUARD + s_ofs, len);
+                TEST_ASSERT_EQUAL_PTR(dst_buf + GUARD + d_ofs, res);
+                if(memcmp(ref_buf, dst_buf, sizeof(dst_buf))) {
+                    TEST_PRINTF("src offset: %u, dst offset: %u, size: %u", (unsigned)s_ofs, (unsigned)d_ofs,
+                                (unsigned)len);
+                    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, sizeof(dst_buf));
+                }
+            }
+        }
+    }
+}
+
+static void check_set(set_cb_t cb, int32_t fixed_v)
+{
+    uint32_t d_ofs, i;
+    for(d_ofs = 0; d_ofs < ALIGN_CNT; d_ofs++) {
+        for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+            size_t len = sizes[i];
+            uint8_t v = fixed_v >= 0 ? (uint8_t)fixed_v : (uint8_t)(len + d_ofs);
+            memset(dst_buf, GUARD_VALUE, sizeof(dst_buf));
+            memset(ref_buf, GUARD_VALUE, sizeof(ref_buf));
+            memset(ref_buf + GUARD + d_ofs, v, len);
+
+            cb(dst_buf + GUARD + d_ofs, v, len);
+            if(memcmp(ref_buf, dst_buf, sizeof(dst_buf))) {
+                TEST_PRINTF("dst offset: %u, size: %u", (unsigned)d_ofs, (unsigned)len);
+                TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, sizeof(dst_buf));
+            }
+        }
+    }
+}
+
+/*Return the speed in MB/s*/
+static uint32_t bench_copy(copy_cb_t cb, size_t len, uint32_t s_ofs)
+{
+    uint32_t cnt = BENCH_BYTES / len;
+    uint32_t t = time_us();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) cb(bench_dst, bench_src + s_ofs, len);
+    t = time_us() - t;
+    return (uint32_t)((uint64_t)cnt * len / LV_MAX(t, 1));
+}
+
+static uint32_t bench_set(set_cb_t cb, size_t len)
+{
+    uint32_t cnt = BENCH_BYTES / len;
+    uint32_t t = time_us();
+    uint32_t i;
+    for(i = 0; i < cnt; i++) cb(bench_dst + 1, (uint8_t)i, len);
+    t = time_us() - t;
+    return (uint32_t)((uint64_t)cnt * len / LV_MAX(t, 1));
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_mem_copy_memcpy(void)
+{
+    check_copy(memcpy_lv);
+    check_copy(_lv_memcpy_word);
+#if _LV_MEM_SIMD
+    check_copy(_lv_memcpy_simd);
+#endif
+}
+
+void test_mem_copy_memset(void)
+{
+    check_set(memset_lv, -1);
+    check_set(_lv_memset_word, -1);
+#if _LV_MEM_SIMD
+    check_set(_lv_memset_simd, -1);
+#endif
+    check_set(memset_00_lv, 0x00);
+    check_set(memset_ff_lv, 0xff);
+}
+
+void test_mem_copy_bench(void)
+{
+    static const struct {
+        const char * name;
+        copy_cb_t copy_cb;
+        set_cb_t set_cb;
+    } kernels[] = {
+        {"libc", memcpy, memset_libc},
+        {"32 bit loops", memcpy_loop32, memset_loop32},
+        {"word", _lv_memcpy_word, _lv_memset_word},
+#if _LV_MEM_SIMD
+        {"simd", _lv_memcpy_simd, _lv_memset_simd},
+#endif
+        {"lv_memcpy/set", memcpy_lv, memset_lv},
+    };
+
+    /*A few pixels, a line of the display and a layer*/
+    static const size_t bench_sizes[] = {24, 640, BENCH_SIZE_MAX};
+
+    fill_random(bench_src, sizeof(bench_src), 2);
+    uint32_t k, s;
+    for(s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); s++) {
+        for(k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+            size_t len = bench_sizes[s];
+            TEST_PRINTF("%u bytes, %s: memcpy aligned %u MB/s, misaligned %u MB/s, memset %u MB/s",
+                        (unsigned)len, kernels[k].name,
+                        (unsigned)bench_copy(kernels[k].copy_cb, len, 0),
+                        (unsigned)bench_copy(kernels[k].copy_cb, len, 2),
+                        (unsigned)bench_set(kernels[k].set_cb, len));
+        }
+    }
+}
+
+#endif
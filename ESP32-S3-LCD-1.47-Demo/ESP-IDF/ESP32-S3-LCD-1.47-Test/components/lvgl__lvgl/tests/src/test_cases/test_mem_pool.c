@@ -0,0 +1,147 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define ARENA_SIZE      (8 * 1024)
+
+#if LV_MEM_CUSTOM == 0
+/*Simulate two regions of an external RAM*/
+static uint64_t arena1[ARENA_SIZE / sizeof(uint64_t)];
+static uint64_t arena2[ARENA_SIZE / sizeof(uint64_t)];
+static int32_t pool1 = -1;
+static int32_t pool2 = -1;
+
+static bool in_arena(const void * p, const uint64_t * arena)
+{
+    return (const uint8_t *)p >= (const uint8_t *)arena && (const uint8_t *)p < (const uint8_t *)arena + ARENA_SIZE;
+}
+
+static uint32_t pool_used(int32_t id)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_pool(id, &mon);
+    return mon.total_size - mon.free_size;
+}
+#endif
+
+void setUp(void)
+{
+#if LV_MEM_CUSTOM == 0
+    if(pool1 < 0) {
+        pool1 = lv_mem_add_pool(arena1, sizeof(arena1), LV_MEM_HINT_LARGE);
+        pool2 = lv_mem_add_pool(arena2, sizeof(arena2), LV_MEM_HINT_LARGE);
+    }
+#endif
+}
+
+void tearDown(void)
+{
+}
+
+void test_mem_pool_add(void)
+{
+#if LV_MEM_CUSTOM == 0
+    TEST_ASSERT_EQUAL_INT32(1, pool1);
+    TEST_ASSERT_EQUAL_INT32(2, pool2);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_mem_get_pool_cnt());
+
+    /*There is space only for LV_MEM_POOL_MAX_NUM pools*/
+    static uint64_t arena3[4096 / sizeof(uint64_t)];
+    static uint64_t arena4[4096 / sizeof(uint64_t)];
+    TEST_ASSERT_EQUAL_INT32(3, lv_mem_add_pool(arena3, sizeof(arena3), LV_MEM_HINT_DEFAULT));
+    TEST_ASSERT_EQUAL_INT32(-1, lv_mem_add_pool(arena4, sizeof(arena4), LV_MEM_HINT_DEFAULT));
+#endif
+}
+
+void test_mem_pool_hint(void)
+{
+#if LV_MEM_CUSTOM == 0
+    uint32_t used1 = pool_used(pool1);
+    uint8_t * large = lv_mem_alloc_hint(1000, LV_MEM_HINT_LARGE);
+    uint8_t * small = lv_mem_alloc(1000);
+    TEST_ASSERT_TRUE(in_arena(large, arena1));
+    TEST_ASSERT_FALSE(in_arena(small, arena1) || in_arena(small, arena2));
+
+    lv_mem_free(large);
+    lv_mem_free(small);
+    TEST_ASSERT_EQUAL_UINT32(used1, pool_used(pool1));
+#endif
+}
+
+void test_mem_pool_fallback(void)
+{
+#if LV_MEM_CUSTOM == 0
+    /*If a pool is full the next one with the same hint is used and then the others*/
+    void * a = lv_mem_alloc_hint(ARENA_SIZE / 2, LV_MEM_HINT_LARGE);
+    void * b = lv_mem_alloc_hint(ARENA_SIZE / 2, LV_MEM_HINT_LARGE);
+    void * c = lv_mem_alloc_hint(ARENA_SIZE / 2, LV_MEM_HINT_LARGE);
+    TEST_ASSERT_TRUE(in_arena(a, arena1));
+    TEST_ASSERT_TRUE(in_arena(b, arena2));
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_FALSE(in_arena(c, arena1) || in_arena(c, arena2));
+
+    lv_mem_free(a);
+    lv_mem_free(b);
+    lv_mem_free(c);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_pool_realloc(void)
+{
+#if LV_MEM_CUSTOM == 0
+    uint8_t * a = lv_mem_alloc_hint(ARENA_SIZE / 4, LV_MEM_HINT_LARGE);
+    lv_memset(a, 0x55, ARENA_SIZE / 4);
+
+    /*Fill the rest of the first pool*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_pool(pool1, &mon);
+    void * b = lv_mem_alloc_hint(mon.free_biggest_size - 64, LV_MEM_HINT_LARGE);
+    TEST_ASSERT_TRUE(in_arena(a, arena1) && in_arena(b, arena1));
+
+    /*Doesn't fit into its pool anymore, so it's moved to the other one with the same hint*/
+    a = lv_mem_realloc(a, ARENA_SIZE / 2);
+    TEST_ASSERT_TRUE(in_arena(a, arena2));
+    TEST_ASSERT_EQUAL_UINT8(0x55, a[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x55, a[ARENA_SIZE / 4 - 1]);
+
+    lv_mem_free(a);
+    lv_mem_free(b);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_pool_monitor(void)
+{
+#if LV_MEM_CUSTOM == 0
+    uint32_t used1 = pool_used(pool1);
+    void * p = lv_mem_alloc_hint(2000, LV_MEM_HINT_LARGE);
+    TEST_ASSERT_UINT32_WITHIN(16, used1 + 2000, pool_used(pool1));
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor_pool(pool1, &mon);
+    TEST_ASSERT_EQUAL_UINT32(ARENA_SIZE, mon.total_size);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2000, mon.max_used);
+
+    /*The sum of the pools is reported for the whole heap*/
+    lv_mem_monitor_t sum;
+    lv_memset_00(&sum, sizeof(sum));
+    uint32_t i;
+    for(i = 0; i < lv_mem_get_pool_cnt(); i++) {
+        lv_mem_monitor_pool(i, &mon);
+        sum.total_size += mon.total_size;
+        sum.free_size += mon.free_size;
+        sum.used_cnt += mon.used_cnt;
+    }
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(sum.total_size, mon.total_size);
+    TEST_ASSERT_EQUAL_UINT32(sum.free_size, mon.free_size);
+    TEST_ASSERT_EQUAL_UINT32(sum.used_cnt, mon.used_cnt);
+
+    lv_mem_free(p);
+#endif
+}
+
+#endif
@@ -0,0 +1,200 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../src/misc/lv_thread.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define BUF_CNT     256
+#define STEP_CNT    20000
+#define OBJ_CNT     1000
+#define MON_CNT     1000
+
+static void * bufs[BUF_CNT];
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t rnd_seed = 1;
+
+static uint32_t rnd(void)
+{
+    rnd_seed = rnd_seed * 1103515245 + 12345;
+    return rnd_seed >> 8;
+}
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Allocate, free and reallocate random buffers*/
+static void random_step(void)
+{
+    uint32_t i = rnd() % BUF_CNT;
+    size_t size = 1 + rnd() % (rnd() % 8 == 0 ? 2000 : 100);
+    switch(rnd() % 3) {
+        case 0:
+            lv_mem_free(bufs[i]);
+            bufs[i] = lv_mem_alloc(size);
+            break;
+        case 1:
+            lv_mem_free(bufs[i]);
+            bufs[i] = NULL;
+            break;
+        default: {
+                void * p = lv_mem_realloc(bufs[i], size);
+                if(p) bufs[i] = p;
+            }
+            break;
+    }
+}
+
+static uint32_t class_sum(const lv_mem_stat_t * stat)
+{
+    uint32_t sum = 0;
+    uint32_t c;
+    for(c = 0; c < LV_MEM_STAT_CLASS_NUM; c++) sum += stat->size_class_cnt[c];
+    return sum;
+}
+#endif
+
+#if LV_MEM_CUSTOM == 0 && LV_THREAD_OS != LV_OS_NONE
+static volatile bool reader_run;
+static uint32_t reader_ok_cnt;
+static uint32_t reader_bad_cnt;
+
+/*Read the statistics while the main thread allocates*/
+static void reader_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    while(reader_run) {
+        lv_mem_stat_t stat;
+        if(lv_mem_stat_pool(0, &stat) != LV_RES_OK) continue;
+
+        reader_ok_cnt++;
+        if(class_sum(&stat) != stat.used_cnt || stat.used_size + stat.free_size > stat.total_size) {
+            reader_bad_cnt++;
+        }
+    }
+}
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < BUF_CNT; i++) {
+        lv_mem_free(bufs[i]);
+        bufs[i] = NULL;
+    }
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_mem_stat_random(void)
+{
+#if LV_MEM_CUSTOM == 0
+    lv_mem_stat_t start;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_stat(&start));
+
+    uint32_t i;
+    for(i = 0; i < STEP_CNT; i++) {
+        random_step();
+        /*lv_mem_test() compares the statistics with the walked blocks*/
+        if(i % 1000 == 0) TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+    }
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_test());
+
+    lv_mem_stat_t stat;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_stat(&stat));
+    TEST_ASSERT_EQUAL_UINT32(stat.used_cnt, class_sum(&stat));
+    TEST_ASSERT_GREATER_THAN_UINT32(start.alloc_total, stat.alloc_total);
+    TEST_ASSERT_GREATER_THAN_UINT32(start.free_total, stat.free_total);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stat.used_size, stat.max_used);
+
+    /*Everything is given back*/
+    for(i = 0; i < BUF_CNT; i++) {
+        lv_mem_free(bufs[i]);
+        bufs[i] = NULL;
+    }
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_mem_stat(&stat));
+    TEST_ASSERT_EQUAL_UINT32(start.used_size, stat.used_size);
+    TEST_ASSERT_EQUAL_UINT32(start.used_cnt, stat.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(start.free_size, stat.free_size);
+    TEST_ASSERT_EQUAL_UINT32(stat.alloc_total - start.alloc_total, stat.free_total - start.free_total);
+    TEST_ASSERT_EQUAL_MEMORY(start.size_class_cnt, stat.size_class_cnt, sizeof(stat.size_class_cnt));
+#endif
+}
+
+void test_mem_stat_size_class(void)
+{
+#if LV_MEM_CUSTOM == 0
+    lv_mem_stat_t start;
+    lv_mem_stat(&start);
+
+    /*Blocks of 100..127 bytes are in the class of 64..127*/
+    void * p = lv_mem_alloc(100);
+    lv_mem_stat_t stat;
+    lv_mem_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(start.size_class_cnt[3] + 1, stat.size_class_cnt[3]);
+    TEST_ASSERT_UINT32_WITHIN(8, start.used_size + 104, stat.used_size);
+
+    /*Growing moves it to an other class*/
+    p = lv_mem_realloc(p, 300);
+    lv_mem_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(start.size_class_cnt[3], stat.size_class_cnt[3]);
+    TEST_ASSERT_EQUAL_UINT32(start.size_class_cnt[5] + 1, stat.size_class_cnt[5]);
+    TEST_ASSERT_EQUAL_UINT32(start.alloc_total + 1, stat.alloc_total);
+
+    lv_mem_free(p);
+    lv_mem_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(start.free_total + 1, stat.free_total);
+    TEST_ASSERT_EQUAL_UINT32(start.used_size, stat.used_size);
+#endif
+}
+
+void test_mem_stat_other_thread(void)
+{
+#if LV_MEM_CUSTOM == 0 && LV_THREAD_OS != LV_OS_NONE
+    lv_thread_t reader;
+    reader_run = true;
+    reader_ok_cnt = 0;
+    reader_bad_cnt = 0;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_thread_init(&reader, reader_cb, 0, NULL));
+
+    uint32_t i;
+    for(i = 0; i < STEP_CNT * 5; i++) random_step();
+
+    reader_run = false;
+    lv_thread_delete(&reader);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, reader_ok_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, reader_bad_cnt);
+#endif
+}
+
+void test_mem_stat_bench_monitor(void)
+{
+#if LV_MEM_CUSTOM == 0
+    /*Walking the heap took longer with more blocks. The statistics don't depend on it.*/
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) lv_obj_create(lv_scr_act());
+
+    lv_mem_monitor_t mon;
+    uint32_t t = time_us();
+    for(i = 0; i < MON_CNT; i++) lv_mem_monitor(&mon);
+    uint32_t t_mon = (time_us() - t) * 1000 / MON_CNT;
+
+    t = time_us();
+    for(i = 0; i < MON_CNT; i++) lv_mem_test();
+    uint32_t t_walk = (time_us() - t) * 1000 / MON_CNT;
+
+    TEST_PRINTF("%u used blocks, lv_mem_monitor(): %u ns, lv_mem_test() with walking: %u ns",
+                (unsigned)mon.used_cnt, (unsigned)t_mon, (unsigned)t_walk);
+#endif
+}
+
+#endif
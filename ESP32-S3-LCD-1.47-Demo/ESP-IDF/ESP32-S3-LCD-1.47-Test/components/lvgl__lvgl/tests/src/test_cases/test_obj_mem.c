@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#define OBJ_CNT         50
+#define CHURN_CNT       10000
+#define CHURN_ROUND_CNT 4
+
+typedef struct {
+    const char * name;
+    lv_obj_t * (*create)(lv_obj_t * parent);
+} widget_t;
+
+static lv_obj_t * btn_with_label_create(lv_obj_t * parent)
+{
+    lv_obj_t * btn = lv_btn_create(parent);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text_static(label, "Button");
+    return btn;
+}
+
+static lv_obj_t * label_create(lv_obj_t * parent)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text_static(label, "Label");
+    return label;
+}
+
+static const widget_t widgets[] = {
+    {"obj", lv_obj_create},
+    {"label", label_create},
+    {"btn", lv_btn_create},
+    {"btn+label", btn_with_label_create},
+    {"slider", lv_slider_create},
+    {"switch", lv_switch_create},
+    {"checkbox", lv_checkbox_create},
+};
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t mem_used(void)
+{
+    /*Don't count the empty chunks the slabs keep for later*/
+    lv_obj_class_trim_slabs();
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_obj_mem_per_widget(void)
+{
+#if LV_MEM_CUSTOM == 0
+    TEST_PRINTF("sizeof(lv_obj_t): %u, sizeof(_lv_obj_spec_attr_t): %u",
+                (unsigned)sizeof(lv_obj_t), (unsigned)sizeof(_lv_obj_spec_attr_t));
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+
+    uint32_t i;
+    for(i = 0; i < sizeof(widgets) / sizeof(widgets[0]); i++) {
+        /*Let the container and the widget's class allocate what they keep for later*/
+        widgets[i].create(cont);
+        lv_obj_clean(cont);
+
+        uint32_t used_start = mem_used();
+
+        uint32_t j;
+        for(j = 0; j < OBJ_CNT; j++) widgets[i].create(cont);
+
+        uint32_t used = mem_used() - used_start;
+        TEST_PRINTF("%s: %u bytes", widgets[i].name, (unsigned)(used / OBJ_CNT));
+
+        lv_obj_clean(cont);
+        TEST_ASSERT_EQUAL_UINT32(used_start, mem_used());
+    }
+#endif
+}
+
+/*Fill a list, replace some rows with an other widget as a list update would do and delete the list.
+ *Print the elapsed times and the state of the heap after the last update.*/
+static void churn(const char * name)
+{
+#if LV_MEM_CUSTOM == 0
+    uint32_t used_start = 0;
+    uint32_t t_create = 0;
+    uint32_t t_del = 0;
+    lv_mem_monitor_t mon;
+
+    uint32_t r;
+    for(r = 0; r < CHURN_ROUND_CNT; r++) {
+        lv_obj_t * cont = lv_obj_create(lv_scr_act());
+
+        uint32_t i;
+        uint32_t t = time_us();
+        for(i = 0; i < CHURN_CNT / CHURN_ROUND_CNT; i++) {
+            if(i % 2) label_create(cont);
+            else lv_obj_create(cont);
+        }
+        t_create += time_us() - t;
+
+        for(i = 0; i < CHURN_CNT / CHURN_ROUND_CNT / 4; i++) {
+            lv_obj_del(lv_obj_get_child(cont, i * 2));
+            lv_checkbox_create(cont);
+        }
+        lv_mem_monitor(&mon);
+
+        t = time_us();
+        lv_obj_del(cont);
+        t_del += time_us() - t;
+
+        /*Let the first round allocate what is kept for later*/
+        if(r == 0) used_start = mem_used();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(used_start, mem_used());
+    TEST_PRINTF("%s: create %u widgets: %u us, delete them: %u us, after an update: %u kB used, %u%% fragmentation, %u kB biggest free",
+                name, (unsigned)CHURN_CNT, (unsigned)t_create, (unsigned)t_del,
+                (unsigned)((mon.total_size - mon.free_size) / 1024), (unsigned)mon.frag_pct,
+                (unsigned)(mon.free_biggest_size / 1024));
+#else
+    LV_UNUSED(name);
+#endif
+}
+
+void test_obj_mem_churn(void)
+{
+    lv_obj_class_enable_slab(false);
+    churn("heap");
+    lv_obj_class_enable_slab(true);
+    churn("slab");
+}
+
+#endif
@@ -0,0 +1,198 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+#if LV_OBJ_STYLE_CACHE_SIZE && LV_USE_DEMO_WIDGETS
+extern lv_color_t test_fb[];
+
+static lv_color_t fb_ref[800 * 480];
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+/*Redraw the screen and return the number of style property lookups and the elapsed time in us*/
+static uint32_t render(uint32_t * hit_cnt, uint32_t * time)
+{
+    lv_obj_style_cache_monitor_t mon_start;
+    lv_obj_style_cache_monitor_t mon_end;
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_obj_style_cache_monitor(&mon_start);
+    uint32_t t = time_us();
+    lv_refr_now(NULL);
+    *time = time_us() - t;
+    lv_obj_style_cache_monitor(&mon_end);
+
+    *hit_cnt = mon_end.hit_cnt - mon_start.hit_cnt;
+    return mon_end.lookup_cnt - mon_start.lookup_cnt;
+}
+#endif
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_enable_style_cache(true);
+#endif
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_obj_style_cache_add_style_and_state(void)
+{
+    static lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_bg_color(&style_pr, lv_color_hex(0xff0000));
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    obj->skip_trans = 1;    /*Don't start a transition*/
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_clear_state(obj, LV_STATE_PRESSED);
+    obj->skip_trans = 0;
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style(obj, NULL, LV_STATE_ANY);
+    TEST_ASSERT_EQUAL_COLOR(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color,
+                            lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_shared_style_change(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_border_width(&style, 3);
+
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_obj_create(parent);
+    lv_obj_add_style(child, &style, 0);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(child, LV_PART_MAIN));
+
+    /*Changing the style even without reporting it shouldn't return stale values*/
+    lv_style_set_border_width(&style, 5);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_border_width(child, LV_PART_MAIN));
+
+    lv_style_remove_prop(&style, LV_STYLE_BORDER_WIDTH);
+    lv_obj_remove_style_all(child);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(child, LV_PART_MAIN));
+
+    /*Inherited properties follow the parent*/
+    lv_obj_set_style_text_letter_space(parent, 4, 0);
+    TEST_ASSERT_EQUAL(4, lv_obj_get_style_text_letter_space(child, LV_PART_MAIN));
+    lv_obj_set_style_text_letter_space(parent, 7, 0);
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_text_letter_space(child, LV_PART_MAIN));
+}
+
+void test_obj_style_cache_local_style_change(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE
+    lv_obj_t * obj1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * obj2 = lv_obj_create(lv_scr_act());
+    lv_obj_set_style_border_width(obj1, 2, 0);
+    lv_obj_set_style_border_width(obj2, 3, 0);
+    lv_obj_set_style_border_width(obj2, 4, LV_PART_SCROLLBAR);
+    TEST_ASSERT_EQUAL(2, lv_obj_get_style_border_width(obj1, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj2, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(4, lv_obj_get_style_border_width(obj2, LV_PART_SCROLLBAR));
+
+    /*Changing the local style of `obj1` keeps the cached values of `obj2`*/
+    lv_obj_style_cache_monitor_t mon_start;
+    lv_obj_style_cache_monitor_t mon_end;
+    lv_obj_set_style_border_width(obj1, 5, 0);
+    lv_obj_set_style_bg_color(obj1, lv_color_hex(0x123456), 0);
+    lv_obj_style_cache_monitor(&mon_start);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj2, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(4, lv_obj_get_style_border_width(obj2, LV_PART_SCROLLBAR));
+    lv_obj_style_cache_monitor(&mon_end);
+    TEST_ASSERT_EQUAL_UINT32(2, mon_end.hit_cnt - mon_start.hit_cnt);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_border_width(obj1, LV_PART_MAIN));
+
+    /*The other parts and states of the changed object are refreshed too*/
+    lv_obj_remove_local_style_prop(obj2, LV_STYLE_BORDER_WIDTH, LV_PART_SCROLLBAR);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj2, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj2, LV_PART_SCROLLBAR));
+    lv_obj_set_style_border_width(obj2, 6, LV_PART_SCROLLBAR | LV_STATE_CHECKED);
+    lv_obj_add_state(obj2, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL(6, lv_obj_get_style_border_width(obj2, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj2, LV_PART_MAIN));
+
+    /*A transition changes only the values of its object*/
+    static const lv_style_prop_t props[] = {LV_STYLE_BORDER_WIDTH, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+    lv_obj_set_style_transition(obj1, &tr, LV_STATE_PRESSED);
+    lv_obj_set_style_border_width(obj1, 15, LV_STATE_PRESSED);
+    lv_obj_add_state(obj1, LV_STATE_PRESSED);
+    lv_tick_inc(50);
+    lv_timer_handler();
+    lv_coord_t w = lv_obj_get_style_border_width(obj1, LV_PART_MAIN);
+    TEST_ASSERT_GREATER_THAN(5, w);
+    TEST_ASSERT_LESS_THAN(15, w);
+
+    lv_obj_style_cache_monitor(&mon_start);
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_border_width(obj2, LV_PART_MAIN));
+    lv_obj_style_cache_monitor(&mon_end);
+    TEST_ASSERT_EQUAL_UINT32(1, mon_end.hit_cnt - mon_start.hit_cnt);
+
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(15, lv_obj_get_style_border_width(obj1, LV_PART_MAIN));
+
+    /*The values of a deleted object are dropped*/
+    lv_obj_del(obj1);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * obj3 = lv_obj_create(lv_scr_act());
+        TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj3, LV_PART_SCROLLBAR));
+        lv_obj_del(obj3);
+    }
+#endif
+}
+
+void test_obj_style_cache_demo_widgets(void)
+{
+#if LV_OBJ_STYLE_CACHE_SIZE && LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_refr_now(NULL);
+
+    uint32_t hit_cnt;
+    uint32_t time_off;
+    uint32_t time_on;
+
+    lv_obj_enable_style_cache(false);
+    uint32_t lookup_cnt = render(&hit_cnt, &time_off);
+    lv_memcpy(fb_ref, test_fb, sizeof(fb_ref));
+    TEST_ASSERT_EQUAL_UINT32(0, hit_cnt);
+
+    lv_obj_enable_style_cache(true);
+    render(&hit_cnt, &time_on);     /*Fill the cache*/
+    lookup_cnt = render(&hit_cnt, &time_on);
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, test_fb, sizeof(fb_ref));
+    TEST_ASSERT_GREATER_THAN_UINT32(lookup_cnt / 2, hit_cnt);
+
+    TEST_PRINTF("widgets demo redraw: %u style lookups, %u%% cache hits, %u us without cache, %u us with cache",
+                (unsigned)lookup_cnt, (unsigned)(hit_cnt * 100 / LV_MAX(lookup_cnt, 1)),
+                (unsigned)time_off, (unsigned)time_on);
+
+    lv_demo_widgets_close();
+#endif
+}
+
+#endif
@@ -5,6 +5,16 @@
 
 void test_obj_tree_1(void);
 void test_obj_tree_2(void);
+void test_obj_tree_single_child(void);
+void test_obj_tree_del_order(void);
+
+static char del_order[8];
+static uint32_t del_order_p;
+
+static void del_order_cb(lv_event_t * e)
+{
+    if(del_order_p < sizeof(del_order) - 1) del_order[del_order_p++] = (char)(lv_uintptr_t)lv_event_get_user_data(e);
+}
 
 void test_obj_tree_1(void)
 {
@@ -36,4 +46,57 @@ void test_obj_tree_2(void)
     //TEST_ASSERT_EQUAL_SCREENSHOT("scr1.png")
 }
 
+void test_obj_tree_single_child(void)
+{
+    lv_obj_t * parent1 = lv_obj_create(lv_scr_act());
+    lv_obj_t * parent2 = lv_obj_create(lv_scr_act());
+
+    /*A single child is stored without allocating the child array*/
+    lv_obj_t * c1 = lv_obj_create(parent1);
+    TEST_ASSERT_EQUAL_PTR(&parent1->spec_attr->child_single, parent1->spec_attr->children);
+    TEST_ASSERT_EQUAL_PTR(c1, lv_obj_get_child(parent1, 0));
+
+    lv_obj_t * c2 = lv_obj_create(parent1);
+    lv_obj_t * c3 = lv_obj_create(parent1);
+    TEST_ASSERT_NOT_EQUAL(&parent1->spec_attr->child_single, parent1->spec_attr->children);
+    TEST_ASSERT_EQUAL_PTR(c1, lv_obj_get_child(parent1, 0));
+    TEST_ASSERT_EQUAL_PTR(c2, lv_obj_get_child(parent1, 1));
+    TEST_ASSERT_EQUAL_PTR(c3, lv_obj_get_child(parent1, 2));
+
+    lv_obj_del(c1);
+    lv_obj_set_parent(c2, parent2);
+    TEST_ASSERT_EQUAL_PTR(&parent1->spec_attr->child_single, parent1->spec_attr->children);
+    TEST_ASSERT_EQUAL_PTR(c3, lv_obj_get_child(parent1, 0));
+    TEST_ASSERT_EQUAL_PTR(&parent2->spec_attr->child_single, parent2->spec_attr->children);
+    TEST_ASSERT_EQUAL_PTR(c2, lv_obj_get_child(parent2, 0));
+
+    lv_obj_move_to_index(c3, 0);
+    TEST_ASSERT_EQUAL_PTR(c3, lv_obj_get_child(parent1, 0));
+
+    lv_obj_clean(parent1);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_child_cnt(parent1));
+    TEST_ASSERT_NULL(parent1->spec_attr->children);
+
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_obj_tree_del_order(void)
+{
+    /*The children are deleted from the oldest*/
+    lv_obj_t * parent = lv_obj_create(lv_scr_act());
+    const char * names = "abc";
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_add_event_cb(obj, del_order_cb, LV_EVENT_DELETE, (void *)(lv_uintptr_t)names[i]);
+    }
+
+    lv_memset_00(del_order, sizeof(del_order));
+    del_order_p = 0;
+    lv_obj_clean(parent);
+    TEST_ASSERT_EQUAL_STRING("abc", del_order);
+
+    lv_obj_del(parent);
+}
+
 #endif
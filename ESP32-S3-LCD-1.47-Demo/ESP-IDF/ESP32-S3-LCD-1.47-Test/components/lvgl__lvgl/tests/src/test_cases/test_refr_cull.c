@@ -0,0 +1,189 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+#include "../src/draw/sw/lv_draw_sw.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_helpers.h"
+#include "lv_test_indev.h"
+
+static void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+static void (*blend_ori)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *);
+static lv_color_t fb[800 * 480];
+static lv_color_t fb_ref[800 * 480];
+static uint32_t blend_px;
+static uint32_t draw_cnt;
+
+static void copy_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_coord_t y;
+    lv_coord_t w = lv_area_get_width(area);
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&fb[y * 800 + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+static void counting_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_area_t a;
+    if(_lv_area_intersect(&a, dsc->blend_area, draw_ctx->clip_area)) blend_px += lv_area_get_size(&a);
+    blend_ori(draw_ctx, dsc);
+}
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+void setUp(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    flush_cb_ori = disp->driver->flush_cb;
+    disp->driver->flush_cb = copy_flush_cb;
+
+    lv_draw_sw_ctx_t * draw_ctx = (lv_draw_sw_ctx_t *)disp->driver->draw_ctx;
+    blend_ori = draw_ctx->blend;
+    draw_ctx->blend = counting_blend;
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->flush_cb = flush_cb_ori;
+    disp->driver->cull_occluded = 1;
+    ((lv_draw_sw_ctx_t *)disp->driver->draw_ctx)->blend = blend_ori;
+
+    lv_obj_clean(lv_scr_act());
+}
+
+static void refr_screen(bool cull)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->cull_occluded = cull;
+    blend_px = 0;
+    draw_cnt = 0;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(disp);
+}
+
+static lv_obj_t * create_box(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t size, lv_coord_t radius)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_radius(obj, radius, 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, size, size);
+    return obj;
+}
+
+/*Render with and without culling, the result has to be the same with less or equal blended pixels*/
+static void compare_screen(const char * name)
+{
+    refr_screen(false);
+    uint32_t px_no_cull = blend_px;
+    lv_memcpy(fb_ref, fb, sizeof(fb));
+
+    refr_screen(true);
+    uint32_t px_cull = blend_px;
+
+    TEST_ASSERT_EQUAL_MEMORY(fb_ref, fb, sizeof(fb));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(px_no_cull, px_cull);
+    TEST_PRINTF("%s: %u px blended without culling, %u px with culling (-%u%%)",
+                name, (unsigned)px_no_cull, (unsigned)px_cull,
+                (unsigned)(px_no_cull ? (px_no_cull - px_cull) * 100 / px_no_cull : 0));
+}
+
+void test_refr_cull_covered_sibling(void)
+{
+    lv_obj_t * bottom = create_box(lv_scr_act(), 20, 20, 100, 0);
+    create_box(bottom, 10, 10, 50, 0);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    create_box(lv_scr_act(), 10, 10, 200, 0);
+
+    refr_screen(false);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+}
+
+void test_refr_cull_rounded_sibling(void)
+{
+    lv_obj_t * bottom = create_box(lv_scr_act(), 60, 60, 80, 0);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_t * top = create_box(lv_scr_act(), 10, 10, 200, 30);
+
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+
+    /*In the corner the rounded object doesn't cover*/
+    lv_obj_set_pos(bottom, 12, 12);
+    lv_obj_set_size(bottom, 20, 20);
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*Translucent objects don't cover*/
+    lv_obj_set_pos(bottom, 60, 60);
+    lv_obj_set_style_bg_opa(top, LV_OPA_50, 0);
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+}
+
+void test_refr_cull_many_siblings(void)
+{
+    lv_obj_t * bottom = create_box(lv_scr_act(), 60, 60, 80, 0);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    create_box(lv_scr_act(), 10, 10, 200, 0);
+
+    /*Only the largest opaque siblings are checked, the small ones don't push out the cover*/
+    uint32_t i;
+    for(i = 0; i < 32; i++) create_box(lv_scr_act(), 220 + (i % 8) * 20, 10 + (i / 8) * 20, 10, 0);
+
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(0, draw_cnt);
+
+    compare_screen("many siblings");
+}
+
+void test_refr_cull_partly_covered_sibling(void)
+{
+    lv_obj_t * bottom = create_box(lv_scr_act(), 150, 20, 100, 0);
+    lv_obj_add_event_cb(bottom, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    create_box(lv_scr_act(), 10, 10, 200, 0);
+
+    refr_screen(true);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    compare_screen("partly covered");
+}
+
+void test_refr_cull_demo_widgets(void)
+{
+#if LV_USE_DEMO_WIDGETS
+    lv_demo_widgets();
+    lv_refr_now(NULL);
+    compare_screen("widgets demo");
+    lv_demo_widgets_close();
+#endif
+}
+
+void test_refr_cull_demo_stress(void)
+{
+#if LV_USE_DEMO_STRESS
+    lv_demo_stress();
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        lv_test_indev_wait(LV_DEMO_STRESS_TIME_STEP * 4);
+        compare_screen("stress demo");
+    }
+    lv_demo_stress_close();
+#endif
+}
+
+#endif
@@ -0,0 +1,130 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define TRACE_LEN(t) (sizeof(t) / sizeof((t)[0]))
+
+/*Invalidation traces recorded from the widgets demo and a scrolling list*/
+static const lv_area_t trace_label_and_cursor[] = {
+    {10, 10, 209, 33}, {10, 36, 209, 59}, {211, 12, 212, 31}, {10, 62, 209, 85},
+};
+
+static const lv_area_t trace_list_scroll[] = {
+    {0, 40, 399, 79}, {0, 84, 399, 123}, {0, 128, 399, 167}, {0, 172, 399, 211},
+    {0, 216, 399, 255}, {0, 260, 399, 299}, {402, 40, 409, 299},
+};
+
+static const lv_area_t trace_sparse_icons[] = {
+    {20, 20, 51, 51}, {700, 20, 731, 51}, {20, 400, 51, 431}, {700, 400, 731, 431},
+};
+
+static void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+static uint32_t flush_cnt;
+static uint32_t flush_px;
+static bool drawn[800 * 480];
+
+static void counting_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(color_p);
+    flush_cnt++;
+    flush_px += lv_area_get_size(area);
+
+    lv_coord_t x, y;
+    for(y = area->y1; y <= area->y2; y++) {
+        for(x = area->x1; x <= area->x2; x++) {
+            drawn[y * 800 + x] = true;
+        }
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+void setUp(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    flush_cb_ori = disp->driver->flush_cb;
+    disp->driver->flush_cb = counting_flush_cb;
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->flush_cb = flush_cb_ori;
+    disp->driver->flush_cost = 0;
+}
+
+static void replay(const lv_area_t * trace, uint32_t len, uint32_t flush_cost)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->flush_cost = flush_cost;
+
+    flush_cnt = 0;
+    flush_px = 0;
+    lv_memset_00(drawn, sizeof(drawn));
+
+    uint32_t i;
+    for(i = 0; i < len; i++) _lv_inv_area(disp, &trace[i]);
+    lv_refr_now(disp);
+
+    /*Every invalidated pixel has to be redrawn*/
+    for(i = 0; i < len; i++) {
+        lv_coord_t x, y;
+        for(y = trace[i].y1; y <= trace[i].y2; y++) {
+            for(x = trace[i].x1; x <= trace[i].x2; x++) {
+                TEST_ASSERT_TRUE(drawn[y * 800 + x]);
+            }
+        }
+    }
+}
+
+void test_refr_join_no_cost_keeps_separate_areas(void)
+{
+    replay(trace_label_and_cursor, TRACE_LEN(trace_label_and_cursor), 0);
+    TEST_ASSERT_EQUAL_UINT32(4, flush_cnt);
+}
+
+void test_refr_join_cost_merges_close_areas(void)
+{
+    replay(trace_label_and_cursor, TRACE_LEN(trace_label_and_cursor), 0);
+    uint32_t px_no_cost = flush_px;
+
+    replay(trace_label_and_cursor, TRACE_LEN(trace_label_and_cursor), 2000);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(px_no_cost + 3 * 2000, flush_px);
+}
+
+void test_refr_join_cost_keeps_far_areas(void)
+{
+    replay(trace_sparse_icons, TRACE_LEN(trace_sparse_icons), 2000);
+    TEST_ASSERT_EQUAL_UINT32(4, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4 * 32 * 32, flush_px);
+}
+
+void test_refr_join_list_scroll(void)
+{
+    replay(trace_list_scroll, TRACE_LEN(trace_list_scroll), 0);
+    uint32_t cnt_no_cost = flush_cnt;
+
+    replay(trace_list_scroll, TRACE_LEN(trace_list_scroll), 2000);
+    TEST_ASSERT_LESS_THAN_UINT32(cnt_no_cost, flush_cnt);
+}
+
+void test_refr_join_overflow_does_not_redraw_screen(void)
+{
+    /*More areas than LV_INV_BUF_SIZE, far from each other*/
+    lv_area_t trace[LV_INV_BUF_SIZE + 16];
+    uint32_t i;
+    for(i = 0; i < TRACE_LEN(trace); i++) {
+        lv_coord_t x = (i % 12) * 64;
+        lv_coord_t y = (i / 12) * 64;
+        lv_area_set(&trace[i], x, y, x + 7, y + 7);
+    }
+
+    replay(trace, TRACE_LEN(trace), 0);
+    TEST_ASSERT_LESS_THAN_UINT32(800 * 480 / 4, flush_px);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_INV_BUF_SIZE, flush_cnt);
+}
+
+#endif
@@ -0,0 +1,265 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     800
+#define VER_RES     480
+#define STEP_CNT    20
+
+/*What the display shows. With `scroll_cb` it's a panel which can move its pixels like the hardware scrolling.*/
+static lv_color_t panel[HOR_RES * VER_RES];
+static lv_color_t ref[HOR_RES * VER_RES];
+static uint32_t refr_px;
+static uint32_t scroll_cb_cnt;
+static bool scroll_cb_res;
+static void (*flush_cb_ori)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+static void panel_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*In direct mode the buffer is the whole screen*/
+    lv_coord_t stride = disp_drv->direct_mode ? HOR_RES : lv_area_get_width(area);
+    lv_coord_t ofs = disp_drv->direct_mode ? area->y1 * HOR_RES + area->x1 : 0;
+
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&panel[y * HOR_RES + area->x1], color_p + ofs + (y - area->y1) * stride,
+                  lv_area_get_width(area) * sizeof(lv_color_t));
+    }
+
+    lv_disp_flush_ready(disp_drv);
+}
+
+static bool panel_scroll_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_coord_t dy)
+{
+    LV_UNUSED(disp_drv);
+    scroll_cb_cnt++;
+    if(!scroll_cb_res) return false;
+
+    size_t line_size = lv_area_get_width(area) * sizeof(lv_color_t);
+    lv_coord_t y;
+    if(dy > 0) {
+        for(y = area->y2; y >= area->y1 + dy; y--) {
+            lv_memcpy(&panel[y * HOR_RES + area->x1], &panel[(y - dy) * HOR_RES + area->x1], line_size);
+        }
+    }
+    else {
+        for(y = area->y1; y <= area->y2 + dy; y++) {
+            lv_memcpy(&panel[y * HOR_RES + area->x1], &panel[(y - dy) * HOR_RES + area->x1], line_size);
+        }
+    }
+
+    return true;
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+    refr_px += px;
+}
+
+void setUp(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    flush_cb_ori = disp->driver->flush_cb;
+    disp->driver->flush_cb = panel_flush_cb;
+    disp->driver->monitor_cb = monitor_cb;
+    scroll_cb_res = true;
+    scroll_cb_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->flush_cb = flush_cb_ori;
+    disp->driver->monitor_cb = NULL;
+    disp->driver->scroll_cb = NULL;
+    disp->driver->scroll_copy = 0;
+    disp->driver->direct_mode = 0;
+    lv_obj_clean(lv_scr_act());
+    lv_obj_clean(lv_layer_top());
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+static lv_obj_t * list_create(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, 300, 400);
+    lv_obj_set_pos(cont, 50, 40);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_scrollbar_mode(cont, LV_SCROLLBAR_MODE_ON);
+
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Row %"LV_PRIu32" of the scrolled list", i);
+    }
+
+    return cont;
+}
+
+/*Check that what the panel shows is the same as what a full redraw shows*/
+static void check_panel(void)
+{
+    lv_memcpy(ref, panel, sizeof(panel));
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        if(ref[i].full != panel[i].full) {
+            TEST_PRINTF("different pixel at %u;%u", (unsigned)(i % HOR_RES), (unsigned)(i / HOR_RES));
+            TEST_FAIL();
+        }
+    }
+}
+
+/*Scroll in steps of different sizes and refresh after each. Return the number of redrawn pixels.*/
+static uint32_t scroll_steps(lv_obj_t * cont)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    refr_px = 0;
+
+    uint32_t i;
+    for(i = 0; i < STEP_CNT; i++) {
+        lv_coord_t dy = (lv_coord_t)(i < STEP_CNT / 2 ? -(int32_t)(3 + i * 2) : (int32_t)(2 + i));
+        lv_obj_scroll_by(cont, 0, dy, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+
+    return refr_px;
+}
+
+void test_refr_scroll_direct_mode(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->direct_mode = 1;
+    lv_obj_t * cont = list_create();
+
+    uint32_t px_redraw = scroll_steps(cont);
+    lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+
+    disp->driver->scroll_copy = 1;
+    uint32_t px_copy = scroll_steps(cont);
+    check_panel();
+
+    TEST_PRINTF("redrawn pixels per scroll step: %u without and %u with moving the pixels",
+                (unsigned)(px_redraw / STEP_CNT), (unsigned)(px_copy / STEP_CNT));
+    TEST_ASSERT_LESS_THAN_UINT32(px_redraw / 4, px_copy);
+}
+
+void test_refr_scroll_cb(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->scroll_copy = 1;
+    disp->driver->scroll_cb = panel_scroll_cb;
+    lv_obj_t * cont = list_create();
+
+    uint32_t px_copy = scroll_steps(cont);
+    check_panel();
+    TEST_ASSERT_EQUAL_UINT32(STEP_CNT, scroll_cb_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(STEP_CNT * 300 * 400 / 4, px_copy);
+
+    /*The driver can refuse it*/
+    scroll_cb_res = false;
+    scroll_steps(cont);
+    check_panel();
+}
+
+void test_refr_scroll_multiple_before_refr(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->scroll_copy = 1;
+    disp->driver->scroll_cb = panel_scroll_cb;
+    lv_obj_t * cont = list_create();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*Invalidate, scroll, invalidate again and scroll back partly*/
+    lv_obj_t * label = lv_obj_get_child(cont, 3);
+    lv_label_set_text(label, "Changed before the scroll");
+    lv_obj_scroll_by(cont, 0, -17, LV_ANIM_OFF);
+    lv_label_set_text(lv_obj_get_child(cont, 5), "Changed after the scroll");
+    lv_obj_scroll_by(cont, 0, 9, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, -30, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_panel();
+    TEST_ASSERT_EQUAL_UINT32(1, scroll_cb_cnt);
+
+    /*More than the height is a simple redraw*/
+    lv_obj_scroll_by(cont, 0, -300, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, -300, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_panel();
+    TEST_ASSERT_EQUAL_UINT32(1, scroll_cb_cnt);
+}
+
+void test_refr_scroll_overlays(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->scroll_copy = 1;
+    disp->driver->scroll_cb = panel_scroll_cb;
+    lv_obj_t * cont = list_create();
+
+    /*Drawn over the scrolled content but don't move with it*/
+    lv_obj_t * floating = lv_btn_create(cont);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_align(floating, LV_ALIGN_RIGHT_MID, -20, 0);
+
+    lv_obj_t * sibling = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(sibling, 200, 60);
+    lv_obj_set_pos(sibling, 250, 200);
+
+    lv_obj_t * top = lv_label_create(lv_layer_top());
+    lv_label_set_text(top, "On the top layer");
+    lv_obj_set_pos(top, 100, 100);
+
+    scroll_steps(cont);
+    check_panel();
+    TEST_ASSERT_EQUAL_UINT32(STEP_CNT, scroll_cb_cnt);
+}
+
+void test_refr_scroll_not_solid_bg(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->scroll_copy = 1;
+    disp->driver->scroll_cb = panel_scroll_cb;
+    lv_obj_t * cont = list_create();
+    lv_obj_set_style_bg_grad_color(cont, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_grad_dir(cont, LV_GRAD_DIR_VER, 0);
+
+    scroll_steps(cont);
+    check_panel();
+    TEST_ASSERT_EQUAL_UINT32(0, scroll_cb_cnt);
+}
+
+#if LV_USE_VLIST
+void test_refr_scroll_vlist(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    disp->driver->scroll_copy = 1;
+    disp->driver->scroll_cb = panel_scroll_cb;
+
+    lv_obj_t * vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 300, 400);
+    lv_obj_set_style_bg_opa(vlist, LV_OPA_COVER, 0);
+    lv_vlist_set_row_height(vlist, 30);
+    lv_vlist_set_row_cnt(vlist, 10000);
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*Go through some moves of the window too*/
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_obj_scroll_by(vlist, 0, -37, LV_ANIM_OFF);
+        lv_refr_now(NULL);
+    }
+    check_panel();
+    TEST_ASSERT_GREATER_THAN_UINT32(100, scroll_cb_cnt);
+}
+#endif
+
+#endif
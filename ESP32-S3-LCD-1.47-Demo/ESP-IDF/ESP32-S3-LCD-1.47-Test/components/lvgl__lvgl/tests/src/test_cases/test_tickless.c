@@ -0,0 +1,135 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define RUN_TIME        10000   /*[ms]*/
+#define POLL_PERIOD     10
+#define TICK_PERIOD     2
+
+#if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
+    /*The monitors update their labels periodically*/
+    #define MONITOR_WAKEUPS(t)  ((t) / 300 + 1)
+#else
+    #define MONITOR_WAKEUPS(t)  0
+#endif
+
+/*The monotonic clock of the simulated system*/
+static uint32_t virt_time;
+static uint32_t virt_time_start;
+static uint32_t refr_cnt;
+static uint32_t wakeup_cnt;
+static lv_obj_t * label;
+static lv_timer_t * update_timer;
+
+static uint32_t virt_tick_get(void)
+{
+    return virt_time;
+}
+
+static void monitor_cb(lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    LV_UNUSED(disp_drv);
+    LV_UNUSED(time);
+    LV_UNUSED(px);
+    refr_cnt++;
+}
+
+static void label_update_cb(lv_timer_t * timer)
+{
+    lv_label_set_text_fmt(label, "Update %"LV_PRIu32, (uint32_t)(lv_uintptr_t)timer->user_data);
+}
+
+/*Sleep until the deadline returned by `lv_timer_handler()` or until `wake_time`*/
+static void tickless_run(uint32_t end_time, uint32_t wake_time)
+{
+    while(virt_time < end_time) {
+        uint32_t time_till_next = lv_timer_handler();
+        wakeup_cnt++;
+
+        uint32_t sleep_end = LV_MIN(end_time, wake_time);
+        if(time_till_next != LV_NO_TIMER_READY) sleep_end = LV_MIN(sleep_end, virt_time + LV_MAX(time_till_next, 1));
+        if(sleep_end <= virt_time) sleep_end = end_time;
+        virt_time = sleep_end;
+    }
+}
+
+void setUp(void)
+{
+    /*The input devices of the tests would be read periodically*/
+    lv_indev_t * indev = NULL;
+    while((indev = lv_indev_get_next(indev)) != NULL) lv_timer_pause(indev->driver->read_timer);
+
+    label = lv_label_create(lv_scr_act());
+    lv_refr_now(NULL);
+
+    virt_time = lv_tick_get();
+    virt_time_start = virt_time;
+    lv_tick_set_cb(virt_tick_get);
+    lv_disp_get_default()->driver->monitor_cb = monitor_cb;
+    refr_cnt = 0;
+    wakeup_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /*Continue from the virtual time with the counted ticks*/
+    lv_tick_set_cb(NULL);
+    lv_tick_inc(virt_time - virt_time_start);
+
+    if(update_timer) {
+        lv_timer_del(update_timer);
+        update_timer = NULL;
+    }
+    lv_disp_get_default()->driver->monitor_cb = NULL;
+    lv_obj_clean(lv_scr_act());
+
+    lv_indev_t * indev = NULL;
+    while((indev = lv_indev_get_next(indev)) != NULL) lv_timer_resume(indev->driver->read_timer);
+}
+
+void test_tickless_static_screen(void)
+{
+    /*Nothing to do, so no wake up needed*/
+    uint32_t end = virt_time + RUN_TIME;
+    tickless_run(end, end);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, refr_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 + MONITOR_WAKEUPS(RUN_TIME), wakeup_cnt);
+    uint32_t wakeup_static = wakeup_cnt;
+
+    /*A periodic update wakes up the loop only for itself and the refresh it causes*/
+    update_timer = lv_timer_create(label_update_cb, 1000, NULL);
+    wakeup_cnt = 0;
+    end = virt_time + RUN_TIME + 1;
+    tickless_run(end, end);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(RUN_TIME / 1000, refr_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(RUN_TIME / 1000 * 2 + 1 + MONITOR_WAKEUPS(RUN_TIME), wakeup_cnt);
+
+    TEST_PRINTF("wakeups in %u ms: %u on a static screen, %u with an update in every second, %u with polling",
+                (unsigned)RUN_TIME, (unsigned)wakeup_static, (unsigned)wakeup_cnt,
+                (unsigned)(RUN_TIME / POLL_PERIOD + RUN_TIME / TICK_PERIOD));
+}
+
+void test_tickless_external_wake(void)
+{
+    /*Something is to show because another task woke up the loop*/
+    uint32_t wake = virt_time + 1234;
+    tickless_run(wake, wake);
+    lv_label_set_text(label, "Woken up");
+    refr_cnt = 0;
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, refr_cnt);
+    TEST_ASSERT_TRUE(lv_disp_get_default()->refr_timer->paused);
+
+    /*The animation keeps the loop running with the refresh period until it's ready*/
+    lv_obj_fade_out(label, 300, 0);
+    refr_cnt = 0;
+    wakeup_cnt = 0;
+    uint32_t end = virt_time + 1000;
+    tickless_run(end, end);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(300 / LV_DISP_DEF_REFR_PERIOD - 1, refr_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(300 / LV_DISP_DEF_REFR_PERIOD + 3 + MONITOR_WAKEUPS(1000), wakeup_cnt);
+    TEST_ASSERT_EQUAL_UINT16(0, lv_anim_count_running());
+}
+
+#endif
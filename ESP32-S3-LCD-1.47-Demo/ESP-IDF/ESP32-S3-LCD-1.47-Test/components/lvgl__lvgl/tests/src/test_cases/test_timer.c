@@ -0,0 +1,262 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_indev.h"
+#include "../../src/misc/lv_gc.h"
+
+#include <time.h>
+
+#define TIMER_CNT       1000
+#define RUN_TIME        500
+
+static lv_timer_t * timers[TIMER_CNT];
+static uint32_t run_cnt;
+static char order[16];
+static uint32_t order_p;
+
+static uint32_t time_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+static void count_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+/*Write the user data of the timer into `order`*/
+static void order_cb(lv_timer_t * timer)
+{
+    if(order_p < sizeof(order) - 1) order[order_p++] = (char)(lv_uintptr_t)timer->user_data;
+}
+
+static void del_other_cb(lv_timer_t * timer)
+{
+    order_cb(timer);
+    lv_timer_del(timers[1]);
+}
+
+static void create_cb(lv_timer_t * timer)
+{
+    order_cb(timer);
+    timers[2] = lv_timer_create(order_cb, 0, (void *)'c');
+    lv_timer_set_repeat_count(timers[2], 1);
+}
+
+static void del_self_cb(lv_timer_t * timer)
+{
+    order_cb(timer);
+    lv_timer_del(timer);
+}
+
+/*Run the timers in the same tick*/
+static void timer_handler_now(void)
+{
+    lv_memset_00(order, sizeof(order));
+    order_p = 0;
+    lv_timer_handler();
+}
+
+void setUp(void)
+{
+    run_cnt = 0;
+    /*Let the timers of the display and the input devices run*/
+    lv_test_indev_wait(50);
+}
+
+void tearDown(void)
+{
+    /*Delete the timers of the test even if it failed*/
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        lv_timer_t * t_next = lv_timer_get_next(t);
+        if(t->timer_cb == order_cb || t->timer_cb == del_other_cb || t->timer_cb == create_cb ||
+           t->timer_cb == del_self_cb || t->timer_cb == count_cb || t->timer_cb == (lv_timer_cb_t)lv_timer_ready) {
+            lv_timer_del(t);
+        }
+        else {
+            lv_timer_resume(t);
+        }
+        t = t_next;
+    }
+}
+
+void test_timer_same_deadline(void)
+{
+    /*Timers due in the same tick run in the order of their creation*/
+    timers[0] = lv_timer_create(order_cb, 20, (void *)'a');
+    timers[1] = lv_timer_create(order_cb, 10, (void *)'b');
+    timers[2] = lv_timer_create(order_cb, 20, (void *)'c');
+    lv_tick_inc(10);
+    lv_timer_reset(timers[1]);
+    lv_tick_inc(10);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("abc", order);
+
+    /*The one with the earlier deadline runs first*/
+    lv_timer_ready(timers[2]);
+    lv_tick_inc(5);
+    lv_timer_ready(timers[0]);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("ca", order);
+
+    lv_timer_del(timers[0]);
+    lv_timer_del(timers[1]);
+    lv_timer_del(timers[2]);
+}
+
+void test_timer_create_del_in_cb(void)
+{
+    timers[0] = lv_timer_create(del_other_cb, 10, (void *)'a');
+    timers[1] = lv_timer_create(order_cb, 10, (void *)'b');
+    lv_tick_inc(10);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    /*A new timer with 0 period runs in the same call. With repeat count 1 it deletes itself.*/
+    lv_timer_set_cb(timers[0], create_cb);
+    lv_tick_inc(10);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("ac", order);
+    lv_timer_set_cb(timers[0], order_cb);
+    lv_tick_inc(10);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    lv_timer_set_cb(timers[0], del_self_cb);
+    lv_tick_inc(10);
+    timer_handler_now();
+    lv_tick_inc(10);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("", order);
+}
+
+void test_timer_pause_resume(void)
+{
+    timers[0] = lv_timer_create(order_cb, 10, (void *)'a');
+    lv_timer_pause(timers[0]);
+    lv_tick_inc(20);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("", order);
+
+    /*It's late already so runs on resume*/
+    lv_timer_resume(timers[0]);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    /*Changing the period moves its deadline*/
+    lv_timer_set_period(timers[0], 100);
+    lv_tick_inc(50);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("", order);
+    lv_timer_set_period(timers[0], 50);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    lv_timer_del(timers[0]);
+}
+
+void test_timer_heap_kept(void)
+{
+    /*No reallocation when scheduling, not even if all timers are paused*/
+    _lv_timer_heap_t * heap = &LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t ** heap_timers = heap->timers;
+    uint32_t heap_size = heap->size;
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) lv_timer_pause(t);
+    TEST_ASSERT_EQUAL_UINT32(0, heap->cnt);
+    TEST_ASSERT_EQUAL_PTR(heap_timers, heap->timers);
+
+    while((t = lv_timer_get_next(t)) != NULL) lv_timer_resume(t);
+    TEST_ASSERT_EQUAL_PTR(heap_timers, heap->timers);
+
+    /*Creating and deleting a few timers doesn't resize the array back and forth*/
+    uint32_t i;
+    for(i = 0; i < heap_size; i++) timers[i] = lv_timer_create(count_cb, 10, NULL);
+    uint32_t grown_size = heap->size;
+    TEST_ASSERT_GREATER_THAN_UINT32(heap_size, grown_size);
+    lv_timer_del(timers[heap_size - 1]);
+    timers[heap_size - 1] = lv_timer_create(count_cb, 10, NULL);
+    TEST_ASSERT_EQUAL_UINT32(grown_size, heap->size);
+
+    for(i = 0; i < heap_size; i++) lv_timer_del(timers[i]);
+    TEST_ASSERT_EQUAL_UINT32(heap->reserved, heap->cnt);
+}
+
+void test_timer_period_0(void)
+{
+    /*Runs once in every tick even if it's made ready again in its callback*/
+    timers[0] = lv_timer_create(order_cb, 0, (void *)'a');
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("", order);
+    lv_tick_inc(1);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    lv_timer_set_cb(timers[0], (lv_timer_cb_t)lv_timer_ready);
+    lv_tick_inc(1);
+    lv_timer_handler();
+    lv_timer_set_cb(timers[0], order_cb);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("", order);
+    lv_tick_inc(1);
+    timer_handler_now();
+    TEST_ASSERT_EQUAL_STRING("a", order);
+
+    lv_timer_del(timers[0]);
+}
+
+void test_timer_time_till_next(void)
+{
+    /*The display and input device timers are due earlier*/
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) lv_timer_pause(t);
+
+    timers[0] = lv_timer_create(order_cb, 30, (void *)'a');
+    timers[1] = lv_timer_create(order_cb, 70, (void *)'b');
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    lv_tick_inc(30);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    lv_timer_del(timers[0]);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_handler());
+    lv_timer_del(timers[1]);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    while((t = lv_timer_get_next(t)) != NULL) lv_timer_resume(t);
+}
+
+void test_timer_bench(void)
+{
+    uint32_t t = time_us();
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        /*Periods between 50 and 1000 ms*/
+        timers[i] = lv_timer_create(count_cb, 50 + (i * 7919) % 950, NULL);
+    }
+    uint32_t t_create = time_us() - t;
+
+    /*Call the handler once in every millisecond*/
+    t = time_us();
+    for(i = 0; i < RUN_TIME; i++) {
+        lv_timer_handler();
+        lv_tick_inc(1);
+    }
+    uint32_t t_handler = (time_us() - t) * 1000 / RUN_TIME;
+
+    t = time_us();
+    for(i = 0; i < TIMER_CNT; i++) lv_timer_del(timers[i]);
+    uint32_t t_del = time_us() - t;
+
+    TEST_PRINTF("%u timers, create: %u us, lv_timer_handler(): %u ns, delete: %u us, %u runs",
+                (unsigned)TIMER_CNT, (unsigned)t_create, (unsigned)t_handler, (unsigned)t_del,
+                (unsigned)run_cnt);
+}
+
+#endif
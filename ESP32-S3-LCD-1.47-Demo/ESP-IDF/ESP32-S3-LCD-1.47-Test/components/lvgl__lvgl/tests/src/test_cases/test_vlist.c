@@ -0,0 +1,236 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_indev.h"
+
+#define ROW_CNT         100000
+#define ROW_H           30
+#define SCROLL_STEP     97
+#define MEM_TOLERANCE   1024
+
+static lv_obj_t * vlist;
+static uint32_t update_cnt;
+
+static void row_update_cb(lv_obj_t * obj, lv_obj_t * row, uint32_t id)
+{
+    LV_UNUSED(obj);
+    lv_label_set_text_fmt(row, "%"LV_PRIu32, id);
+    update_cnt++;
+}
+
+#if LV_MEM_CUSTOM == 0
+static uint32_t mem_used(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.total_size - mon.free_size;
+}
+#endif
+
+/*Position of the viewport in the whole list*/
+static int32_t get_list_pos(void)
+{
+    lv_vlist_t * vl = (lv_vlist_t *)vlist;
+    return vl->win_ofs + lv_obj_get_scroll_y(vlist);
+}
+
+/*Check that the row objects show the rows which should be on their position*/
+static void check_rows(void)
+{
+    lv_obj_update_layout(vlist);
+
+    lv_coord_t content_y1 = vlist->coords.y1 + lv_obj_get_style_pad_top(vlist, LV_PART_MAIN) +
+                            lv_obj_get_style_border_width(vlist, LV_PART_MAIN);
+    int32_t pos = get_list_pos();
+    char buf[16];
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(vlist); i++) {
+        lv_obj_t * row = lv_obj_get_child(vlist, i);
+        uint32_t id = lv_vlist_get_row_id(vlist, row);
+        TEST_ASSERT_NOT_EQUAL(LV_VLIST_ROW_NONE, id);
+        TEST_ASSERT_EQUAL_INT32((int32_t)id * ROW_H, row->coords.y1 - content_y1 + pos);
+        lv_snprintf(buf, sizeof(buf), "%"LV_PRIu32, id);
+        TEST_ASSERT_EQUAL_STRING(buf, lv_label_get_text(row));
+    }
+
+    /*The top row is bound*/
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, pos > 0 ? pos / ROW_H : 0));
+}
+
+void setUp(void)
+{
+    vlist = lv_vlist_create(lv_scr_act());
+    lv_obj_set_size(vlist, 200, 300);
+    lv_vlist_set_row_cb(vlist, NULL, row_update_cb);
+    lv_vlist_set_row_height(vlist, ROW_H);
+    lv_vlist_set_row_cnt(vlist, ROW_CNT);
+    update_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_vlist_row_pool(void)
+{
+    lv_coord_t view_h = lv_obj_get_content_height(vlist);
+    uint32_t pool_cnt = view_h / ROW_H + 2;
+    TEST_ASSERT_EQUAL_UINT32(pool_cnt, lv_obj_get_child_cnt(vlist));
+    check_rows();
+
+    /*Less rows than what fits*/
+    lv_vlist_set_row_cnt(vlist, 3);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_cnt(vlist));
+    check_rows();
+
+    lv_vlist_set_row_cnt(vlist, ROW_CNT);
+    TEST_ASSERT_EQUAL_UINT32(pool_cnt, lv_obj_get_child_cnt(vlist));
+
+    lv_obj_set_height(vlist, 150);
+    lv_obj_update_layout(vlist);
+    view_h = lv_obj_get_content_height(vlist);
+    TEST_ASSERT_EQUAL_UINT32(view_h / ROW_H + 2, lv_obj_get_child_cnt(vlist));
+    check_rows();
+}
+
+void test_vlist_scroll_through(void)
+{
+    lv_obj_update_layout(vlist);
+    uint32_t child_cnt = lv_obj_get_child_cnt(vlist);
+    int32_t pos_max = ROW_CNT * ROW_H - lv_obj_get_content_height(vlist);
+
+#if LV_MEM_CUSTOM == 0
+    uint32_t used_min = mem_used();
+    uint32_t used_max = used_min;
+#endif
+
+    int32_t pos = 0;
+    uint32_t i = 0;
+    while(pos < pos_max) {
+        lv_coord_t step = (lv_coord_t)LV_MIN(SCROLL_STEP, pos_max - pos);
+        lv_obj_scroll_by(vlist, 0, -step, LV_ANIM_OFF);
+        pos += step;
+        TEST_ASSERT_EQUAL_INT32(pos, get_list_pos());
+
+        i++;
+        if(i % 1000 == 0) {
+            check_rows();
+            lv_refr_now(NULL);
+#if LV_MEM_CUSTOM == 0
+            uint32_t used = mem_used();
+            used_min = LV_MIN(used_min, used);
+            used_max = LV_MAX(used_max, used);
+#endif
+        }
+    }
+
+    check_rows();
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_cnt(vlist));
+
+    /*Every row was bound only once*/
+    TEST_ASSERT_UINT32_WITHIN(child_cnt, ROW_CNT, update_cnt);
+
+    /*Can't be scrolled further*/
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_bottom(vlist));
+    TEST_ASSERT_NOT_NULL(lv_vlist_get_row(vlist, ROW_CNT - 1));
+
+#if LV_MEM_CUSTOM == 0
+    TEST_PRINTF("scrolled through %u rows, heap usage varied by %u bytes", (unsigned)ROW_CNT,
+                (unsigned)(used_max - used_min));
+    TEST_ASSERT_LESS_THAN_UINT32(MEM_TOLERANCE, used_max - used_min);
+#endif
+
+    /*And back*/
+    while(pos > 0) {
+        lv_coord_t step = (lv_coord_t)LV_MIN(SCROLL_STEP * 10, pos);
+        lv_obj_scroll_by(vlist, 0, step, LV_ANIM_OFF);
+        pos -= step;
+    }
+    TEST_ASSERT_EQUAL_INT32(0, get_list_pos());
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_top(vlist));
+    check_rows();
+}
+
+void test_vlist_scroll_to_row(void)
+{
+    lv_vlist_scroll_to_row(vlist, 50000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(50000 * ROW_H, get_list_pos());
+    check_rows();
+
+    lv_vlist_scroll_to_row(vlist, 50010, LV_ANIM_ON);
+    lv_test_indev_wait(1000);
+    TEST_ASSERT_EQUAL_INT32(50010 * ROW_H, get_list_pos());
+    check_rows();
+
+    /*Far, so the window is moved first*/
+    lv_vlist_scroll_to_row(vlist, 12345, LV_ANIM_ON);
+    lv_test_indev_wait(1000);
+    TEST_ASSERT_EQUAL_INT32(12345 * ROW_H, get_list_pos());
+    check_rows();
+
+    /*The last rows can't be scrolled to the top*/
+    lv_vlist_scroll_to_row(vlist, ROW_CNT - 1, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(ROW_CNT * ROW_H - lv_obj_get_content_height(vlist), get_list_pos());
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_bottom(vlist));
+    check_rows();
+
+    lv_vlist_scroll_to_row(vlist, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(0, get_list_pos());
+    check_rows();
+}
+
+void test_vlist_huge_row_cnt(void)
+{
+    /*The whole list would be higher than INT32_MAX, so only the rows above it are shown*/
+    lv_vlist_set_row_cnt(vlist, UINT32_MAX);
+    lv_vlist_scroll_to_row(vlist, UINT32_MAX - 1, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX / ROW_H * ROW_H - lv_obj_get_content_height(vlist), get_list_pos());
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_bottom(vlist));
+    check_rows();
+
+    lv_vlist_scroll_to_row(vlist, 1000, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(1000 * ROW_H, get_list_pos());
+    check_rows();
+}
+
+void test_vlist_drag(void)
+{
+    lv_obj_update_layout(vlist);
+    lv_coord_t x = (vlist->coords.x1 + vlist->coords.x2) / 2;
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_test_mouse_move_to(x, vlist->coords.y2 - 10);
+        lv_test_mouse_press();
+        lv_test_indev_wait(50);
+
+        uint32_t j;
+        for(j = 0; j < 28; j++) {
+            lv_test_mouse_move_by(0, -10);
+            lv_test_indev_wait(10);
+        }
+
+        lv_test_mouse_release();
+        lv_test_indev_wait(1000);
+        check_rows();
+    }
+
+    /*Went through several windows*/
+    TEST_ASSERT_GREATER_THAN_INT32(20 * 250, get_list_pos());
+    TEST_ASSERT_EQUAL(0, lv_obj_get_scroll_x(vlist));
+}
+
+void test_vlist_refresh(void)
+{
+    lv_vlist_scroll_to_row(vlist, 777, LV_ANIM_OFF);
+    update_cnt = 0;
+    lv_vlist_refresh(vlist);
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_child_cnt(vlist), update_cnt);
+    check_rows();
+}
+
+#endif
@@ -0,0 +1,11 @@
+/**
+ * @file sdkconfig.h
+ * @brief The app's sdkconfig for the host build, without the options that need ESP-IDF
+ */
+
+#pragma once
+
+#include "sdkconfig_app.h"
+
+// The blend workers are FreeRTOS tasks
+#undef CONFIG_LV_USE_DRAW_SW_PARALLEL
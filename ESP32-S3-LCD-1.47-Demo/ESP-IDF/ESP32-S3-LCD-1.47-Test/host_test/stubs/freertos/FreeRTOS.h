@@ -0,0 +1,12 @@
+/**
+ * @file FreeRTOS.h
+ * @brief The parts of FreeRTOS main/ uses, for the single threaded host tests
+ */
+
+#pragma once
+
+typedef int portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void)(mux))
+#define portEXIT_CRITICAL(mux)          ((void)(mux))
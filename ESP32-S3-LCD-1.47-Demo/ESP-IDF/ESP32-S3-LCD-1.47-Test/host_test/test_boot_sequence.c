@@ -0,0 +1,81 @@
+/**
+ * @file test_boot_sequence.c
+ * @brief The panel and the UI have to be up before the radio stack starts
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "Boot_Sequence.h"
+
+typedef struct {
+    const char *name;
+    boot_kind_t kind;
+} boot_step_t;
+
+static const boot_step_t steps[] = {
+#define BOOT_STEP_ENTRY(step, kind) { #step, kind },
+    BOOT_SEQUENCE(BOOT_STEP_ENTRY)
+#undef BOOT_STEP_ENTRY
+};
+
+#define STEP_NUM (int)(sizeof(steps) / sizeof(steps[0]))
+
+static int step_index(const char *name)
+{
+    for (int i = 0; i < STEP_NUM; i++) {
+        if (strcmp(steps[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_boot_display_first(void)
+{
+    TEST_ASSERT_EQUAL_STRING("LCD_Init", steps[0].name);
+}
+
+void test_boot_kinds_in_order(void)
+{
+    // Display, UI, radio, others: a step never comes after a later kind
+    for (int i = 1; i < STEP_NUM; i++) {
+        TEST_ASSERT_TRUE_MESSAGE(steps[i - 1].kind <= steps[i].kind, steps[i].name);
+    }
+}
+
+void test_boot_first_frame_before_radio(void)
+{
+    int first_frame = step_index("Boot_First_Frame");
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, first_frame);
+    TEST_ASSERT_LESS_THAN_INT(step_index("Wireless_Init"), first_frame);
+    TEST_ASSERT_LESS_THAN_INT(first_frame, step_index("Lvgl_Example1"));
+    TEST_ASSERT_LESS_THAN_INT(step_index("Lvgl_Example1"), step_index("LVGL_Init"));
+}
+
+void test_boot_wifi_before_espnow(void)
+{
+    TEST_ASSERT_LESS_THAN_INT(step_index("WLED_ESPNOW_Init"), step_index("Boot_Wireless_Settle"));
+    TEST_ASSERT_LESS_THAN_INT(step_index("Boot_Wireless_Settle"), step_index("Wireless_Init"));
+}
+
+void test_boot_memory_report_last(void)
+{
+    TEST_ASSERT_EQUAL_STRING("Memory_Plan_Report", steps[STEP_NUM - 1].name);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_display_first);
+    RUN_TEST(test_boot_kinds_in_order);
+    RUN_TEST(test_boot_first_frame_before_radio);
+    RUN_TEST(test_boot_wifi_before_espnow);
+    RUN_TEST(test_boot_memory_report_last);
+    return UNITY_END();
+}
@@ -0,0 +1,112 @@
+/**
+ * @file test_memory_plan.c
+ * @brief The buffers of MEMORY_PLAN fit the internal RAM budget of the sdkconfig
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "Memory_Plan.h"
+
+typedef struct {
+    const char *name;
+    size_t size;
+    mem_place_t place;
+} plan_entry_t;
+
+static const plan_entry_t plan[MEM_ID_NUM] = {
+#define PLAN_ENTRY(id, name, size, place) [id] = { name, size, place },
+    MEMORY_PLAN(PLAN_ENTRY)
+#undef PLAN_ENTRY
+};
+
+static const char *place_names[] = {
+    [MEM_PLACE_DMA]      = "DMA",
+    [MEM_PLACE_INTERNAL] = "internal",
+    [MEM_PLACE_PSRAM]    = "PSRAM",
+};
+
+#define BUDGET_BYTES (CONFIG_MEMORY_DMA_BUDGET_KILOBYTES * 1024)
+
+// Size on the device: host_test/sdkconfig.h drops the blend workers, which are FreeRTOS tasks
+static size_t device_size(mem_id_t id)
+{
+#ifdef CONFIG_LV_DRAW_SW_PARALLEL_STACK_SIZE
+    if (id == MEM_LVGL_WORKERS) {
+        return CONFIG_LV_DRAW_SW_PARALLEL_STACK_SIZE * CONFIG_LV_DRAW_SW_PARALLEL_WORKER_CNT;
+    }
+#endif
+    return plan[id].size;
+}
+
+static size_t place_bytes(mem_place_t place)
+{
+    size_t sum = 0;
+    for (int i = 0; i < MEM_ID_NUM; i++) {
+        if (plan[i].place == place) sum += device_size(i);
+    }
+    return sum;
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_memory_plan_names_unique(void)
+{
+    for (int i = 0; i < MEM_ID_NUM; i++) {
+        TEST_ASSERT_NOT_NULL(plan[i].name);
+        for (int j = i + 1; j < MEM_ID_NUM; j++) {
+            TEST_ASSERT_FALSE_MESSAGE(strcmp(plan[i].name, plan[j].name) == 0, plan[j].name);
+        }
+    }
+}
+
+void test_memory_plan_sizes(void)
+{
+    // Everything but the optional LVGL features is always allocated
+    for (int i = 0; i < MEM_ID_NUM; i++) {
+        if (i == MEM_LVGL_WORKERS || i == MEM_LVGL_STYLES) continue;
+        TEST_ASSERT_TRUE_MESSAGE(plan[i].size > 0, plan[i].name);
+    }
+    TEST_ASSERT_EQUAL_UINT32(LVGL_BUF_LEN * sizeof(lv_color_t), plan[MEM_LVGL_BUF1].size);
+    TEST_ASSERT_EQUAL_UINT32(plan[MEM_LVGL_BUF1].size, plan[MEM_LVGL_BUF2].size);
+}
+
+void test_memory_plan_draw_buffers_dma(void)
+{
+    // SPI DMA reads the draw buffers on every flush
+    TEST_ASSERT_EQUAL_INT(MEM_PLACE_DMA, plan[MEM_LVGL_BUF1].place);
+    TEST_ASSERT_EQUAL_INT(MEM_PLACE_DMA, plan[MEM_LVGL_BUF2].place);
+    TEST_ASSERT_EQUAL_INT(MEM_PLACE_INTERNAL, plan[MEM_LVGL_HEAP].place);
+}
+
+void test_memory_plan_internal_budget(void)
+{
+    printf("%-20s %8s  %s\n", "Buffer", "Bytes", "Place");
+    for (int i = 0; i < MEM_ID_NUM; i++) {
+        printf("%-20s %8zu  %s\n", plan[i].name, device_size(i), place_names[plan[i].place]);
+    }
+
+    // On the ESP32-S3 DMA and internal buffers come out of the same RAM, as in Memory_Plan.c
+    size_t internal = place_bytes(MEM_PLACE_DMA) + place_bytes(MEM_PLACE_INTERNAL);
+    printf("DMA %zu, internal %zu, PSRAM %zu bytes\n",
+           place_bytes(MEM_PLACE_DMA), place_bytes(MEM_PLACE_INTERNAL), place_bytes(MEM_PLACE_PSRAM));
+    printf("Internal budget %d bytes, headroom %ld bytes\n", BUDGET_BYTES, (long)BUDGET_BYTES - (long)internal);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(BUDGET_BYTES, internal);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_memory_plan_names_unique);
+    RUN_TEST(test_memory_plan_sizes);
+    RUN_TEST(test_memory_plan_draw_buffers_dma);
+    RUN_TEST(test_memory_plan_internal_budget);
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+/**
+ * @file test_status_screen.c
+ * @brief The status screen is redrawn only when a value it shows changes
+ */
+
+#include "unity.h"
+#include "lvgl.h"
+#include "LVGL_Example.h"
+#include "Status_Bus.h"
+
+#define HOR_RES     172
+#define VER_RES     320
+#define STEADY_CNT  100
+
+static lv_disp_t * disp;
+static uint32_t flush_px;
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(color_p);
+    flush_px += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+static void publish_all(uint32_t ble_num)
+{
+    Status_Publish_U32(STATUS_IP, 0x0101a8c0);  // 192.168.1.1
+    Status_Publish_Str(STATUS_MAC, "AA:BB:CC:DD:EE:FF");
+    Status_Publish_U32(STATUS_WIFI_NUM, 7);
+    Status_Publish_U32(STATUS_BLE_NUM, ble_num);
+    Status_Publish_U32(STATUS_WLED_TOTAL, 13);
+    Status_Publish_U32(STATUS_WLED, 13);
+}
+
+// Dispatch the status values, return the number of areas they invalidated and redraw them
+static uint32_t dispatch(void)
+{
+    Status_Dispatch();
+    uint32_t inv_cnt = disp->inv_p;
+    lv_refr_now(disp);
+    return inv_cnt;
+}
+
+void setUp(void)
+{
+    static lv_color_t buf[HOR_RES * 20];
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t disp_drv;
+
+    lv_init();
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HOR_RES * 20);
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = HOR_RES;
+    disp_drv.ver_res = VER_RES;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.draw_buf = &draw_buf;
+    disp = lv_disp_drv_register(&disp_drv);
+
+    Lvgl_Example1();
+    publish_all(3);
+    dispatch();
+    flush_px = 0;
+}
+
+void tearDown(void)
+{
+    lv_deinit();
+}
+
+void test_status_screen_steady(void)
+{
+    // Publishing the same values again doesn't touch the widgets
+    uint32_t inv_cnt = 0;
+    for (int i = 0; i < STEADY_CNT; i++) {
+        publish_all(3);
+        inv_cnt += dispatch();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, inv_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, flush_px);
+}
+
+void test_status_screen_change(void)
+{
+    // A changed value redraws only the label showing it
+    publish_all(4);
+    TEST_ASSERT_EQUAL_UINT32(1, dispatch());
+    TEST_ASSERT_GREATER_THAN_UINT32(0, flush_px);
+    TEST_ASSERT_LESS_THAN_UINT32(HOR_RES * VER_RES / 8, flush_px);
+
+    flush_px = 0;
+    publish_all(4);
+    TEST_ASSERT_EQUAL_UINT32(0, dispatch());
+    TEST_ASSERT_EQUAL_UINT32(0, flush_px);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_status_screen_steady);
+    RUN_TEST(test_status_screen_change);
+    return UNITY_END();
+}
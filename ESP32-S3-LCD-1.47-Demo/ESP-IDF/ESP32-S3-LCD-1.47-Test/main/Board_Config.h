@@ -0,0 +1,17 @@
+/**
+ * @file Board_Config.h
+ * @brief Sizes of the board's display and LEDs and of the buffers derived from them
+ *
+ * Kept free of ESP-IDF headers: Memory_Plan.h sizes its buffers with these and
+ * host_test/test_memory_plan.c checks the plan on the host.
+ */
+
+#pragma once
+
+// The pixel number in horizontal and vertical
+#define EXAMPLE_LCD_H_RES              172
+#define EXAMPLE_LCD_V_RES              320
+
+#define LVGL_BUF_LEN  (EXAMPLE_LCD_H_RES * 20)                                     // Pixels per draw buffer, placed by Memory_Plan
+
+#define RGB_LED_NUM 1
@@ -0,0 +1,50 @@
+/**
+ * @file Boot_Sequence.h
+ * @brief Order of the boot steps of app_main
+ *
+ * The panel and the UI come up first, so the user sees a frame while the
+ * radio stack is still starting. main.c calls the steps in this order and
+ * host_test/test_boot_sequence.c checks the order without the hardware.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BOOT_DISPLAY,       // Panel, backlight and LVGL
+    BOOT_UI,            // Builds or draws the UI
+    BOOT_RADIO,         // Wi-Fi, ESP-NOW, BLE and the services on top of them
+    BOOT_OTHER,         // Everything else, after the radio
+} boot_kind_t;
+
+/*
+ * X(step, kind), each step is called without arguments, a return value is ignored
+ *
+ * - LCD_Init pushes the splash, Boot_First_Frame replaces it with the UI.
+ * - Boot_Wireless_Settle lets Wi-Fi start before ESP-NOW is used.
+ * - Memory_Plan_Report comes last, its minimum free values cover the whole boot.
+ */
+#define BOOT_SEQUENCE(X) \
+    X(LCD_Init,                 BOOT_DISPLAY) \
+    X(Boot_Backlight,           BOOT_DISPLAY) \
+    X(LVGL_Init,                BOOT_DISPLAY) \
+    X(Flash_FS_Init,            BOOT_DISPLAY) \
+    X(Lvgl_Example1,            BOOT_UI)      \
+    X(Boot_First_Frame,         BOOT_UI)      \
+    X(Wireless_Init,            BOOT_RADIO)   \
+    X(Boot_Wireless_Settle,     BOOT_RADIO)   \
+    X(WLED_ESPNOW_Init,         BOOT_RADIO)   \
+    X(WLED_ESPNOW_TriggerAlarm, BOOT_RADIO)   \
+    X(WebServer_Init,           BOOT_RADIO)   \
+    X(Flash_Searching,          BOOT_OTHER)   \
+    X(RGB_Init,                 BOOT_OTHER)   \
+    X(RGB_Example,              BOOT_OTHER)   \
+    X(SD_Init,                  BOOT_OTHER)   \
+    X(Memory_Plan_Report,       BOOT_OTHER)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file Flash_FS.c
+ * @brief Read-only LVGL file system on raw data partitions, mapped with esp_partition_mmap()
+ */
+
+#include "Flash_FS.h"
+#include <string.h>
+#include "esp_partition.h"
+#include "esp_log.h"
+#include "lvgl.h"
+
+static const char *TAG = "FLASH_FS";
+
+typedef struct {
+    const esp_partition_t *part;
+    uint32_t pos;
+    esp_partition_mmap_handle_t map_handle;
+} flash_file_t;
+
+static void *fs_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+    if (mode != LV_FS_MODE_RD) return NULL;
+
+    if (path[0] == '/') path++;
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, path);
+    if (part == NULL) return NULL;
+
+    flash_file_t *file = lv_mem_alloc(sizeof(flash_file_t));
+    if (file == NULL) return NULL;
+    file->part = part;
+    file->pos = 0;
+    return file;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t *drv, void *file_p)
+{
+    LV_UNUSED(drv);
+    lv_mem_free(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br)
+{
+    LV_UNUSED(drv);
+    flash_file_t *file = file_p;
+    uint32_t left = file->part->size - file->pos;
+    if (btr > left) btr = left;
+
+    *br = 0;
+    if (btr > 0 && esp_partition_read(file->part, file->pos, buf, btr) != ESP_OK) return LV_FS_RES_HW_ERR;
+    file->pos += btr;
+    *br = btr;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+    flash_file_t *file = file_p;
+    if (whence == LV_FS_SEEK_CUR) pos += file->pos;
+    else if (whence == LV_FS_SEEK_END) pos += file->part->size;
+    if (pos > file->part->size) return LV_FS_RES_INV_PARAM;
+
+    file->pos = pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p)
+{
+    LV_UNUSED(drv);
+    *pos_p = ((flash_file_t *)file_p)->pos;
+    return LV_FS_RES_OK;
+}
+
+// The whole partition is mapped into the data address space, LVGL reads the images and glyphs from there
+static const void *fs_mmap(lv_fs_drv_t *drv, void *file_p, uint32_t *size)
+{
+    LV_UNUSED(drv);
+    flash_file_t *file = file_p;
+    const void *addr;
+    esp_err_t err = esp_partition_mmap(file->part, 0, file->part->size, ESP_PARTITION_MMAP_DATA,
+                                       &addr, &file->map_handle);
+    if (err != ESP_OK) {
+        // Out of MMU pages: LVGL falls back to reading the file
+        ESP_LOGW(TAG, "Mapping %s failed: %s", file->part->label, esp_err_to_name(err));
+        return NULL;
+    }
+
+    *size = file->part->size;
+    return addr;
+}
+
+static void fs_munmap(lv_fs_drv_t *drv, void *file_p, const void *addr, uint32_t size)
+{
+    LV_UNUSED(drv);
+    LV_UNUSED(addr);
+    LV_UNUSED(size);
+    esp_partition_munmap(((flash_file_t *)file_p)->map_handle);
+}
+
+void Flash_FS_Init(void)
+{
+    static lv_fs_drv_t fs_drv;
+    lv_fs_drv_init(&fs_drv);
+
+    fs_drv.letter = FLASH_FS_LETTER;
+    fs_drv.open_cb = fs_open;
+    fs_drv.close_cb = fs_close;
+    fs_drv.read_cb = fs_read;
+    fs_drv.seek_cb = fs_seek;
+    fs_drv.tell_cb = fs_tell;
+    fs_drv.mmap_cb = fs_mmap;
+    fs_drv.munmap_cb = fs_munmap;
+
+    lv_fs_drv_register(&fs_drv);
+}
@@ -0,0 +1,30 @@
+/**
+ * @file Flash_FS.h
+ * @brief LVGL file system driver for raw data partitions of the flash
+ *
+ * Each data partition is one file, named by its label: "F:assets" opens the
+ * partition labelled "assets". Images and fonts stored in such a partition
+ * are used in place through the flash cache (esp_partition_mmap()), so they
+ * don't take any RAM. Write the content with e.g.
+ * `parttool.py write_partition --partition-name assets --input assets.bin`.
+ *
+ * The file size is the size of the partition, the content has to describe
+ * its own size as LVGL's image and font files do.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLASH_FS_LETTER 'F'         // Drive letter of the partitions in LVGL's paths
+
+/**
+ * @brief Register the driver in LVGL, call after LVGL_Init()
+ */
+void Flash_FS_Init(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -46,8 +46,10 @@ void LCD_Init(void)
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_mirror(panel_handle, true, false));
 
-    // user can flush pre-defined pattern to the screen before we turn on the screen or backlight
+    // flush the splash to the screen before we turn on the screen or backlight
+    LCD_Splash(io_handle);
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
+    ESP_LOGI(TAG_LCD, "First frame on screen %lld ms after boot", esp_timer_get_time() / 1000);
 
     ESP_LOGI(TAG_LCD, "Turn on LCD backlight");
     // gpio_set_level(EXAMPLE_PIN_NUM_BK_LIGHT, EXAMPLE_LCD_BK_LIGHT_ON_LEVEL);
@@ -57,6 +59,51 @@ void LCD_Init(void)
 
 }
 
+_Static_assert(LV_COLOR_DEPTH == 16, "The splash is stored in RGB565");
+
+// Expand the runs of whole rows into px pixels, return the first run of the next row
+static const uint16_t *splash_decode(const uint16_t *run, const uint16_t *run_end, lv_color_t *dst, size_t px)
+{
+    lv_color_t *dst_end = dst + px;
+    while (dst < dst_end && run < run_end) {
+        uint16_t v = run[1];
+        lv_color_t c;
+        c.full = LV_COLOR_16_SWAP ? (uint16_t)((v >> 8) | (v << 8)) : v;
+        for (uint16_t i = 0; i < run[0] && dst < dst_end; i++) {
+            *dst++ = c;
+        }
+        run += 2;
+    }
+    return run;
+}
+
+void LCD_Splash(esp_lcd_panel_io_handle_t io_handle)
+{
+    const size_t band_len = EXAMPLE_LCD_H_RES * LCD_SPLASH_LINES;
+    lv_color_t *bands[2];
+    bands[0] = heap_caps_malloc(2 * band_len * sizeof(lv_color_t), MALLOC_CAP_DMA);
+    if (bands[0] == NULL) {
+        ESP_LOGW(TAG_LCD, "No DMA memory for the splash, skipping it");
+        return;
+    }
+    bands[1] = bands[0] + band_len;
+
+    // Decode a band while the previous one is being sent from the other buffer. Drawing a band starts with
+    // parameter writes, which wait for the queued color transfers, so the band before the previous one is done.
+    const uint16_t *run = splash_rle;
+    const uint16_t *run_end = splash_rle + splash_rle_len;
+    for (int y = 0, i = 0; y < EXAMPLE_LCD_V_RES; y += LCD_SPLASH_LINES, i ^= 1) {
+        int y_end = y + LCD_SPLASH_LINES;
+        if (y_end > EXAMPLE_LCD_V_RES) y_end = EXAMPLE_LCD_V_RES;
+        run = splash_decode(run, run_end, bands[i], (size_t)(y_end - y) * EXAMPLE_LCD_H_RES);
+        esp_lcd_panel_draw_bitmap(panel_handle, Offset_X, y + Offset_Y, EXAMPLE_LCD_H_RES + Offset_X, y_end + Offset_Y, bands[i]);
+    }
+
+    // Wait for the last band too before releasing the buffers
+    esp_lcd_panel_io_tx_param(io_handle, LCD_CMD_NOP, NULL, 0);
+    free(bands[0]);
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Backlight program
 static ledc_channel_config_t ledc_channel;
@@ -6,6 +6,8 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
+#include "esp_heap_caps.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "esp_err.h"
@@ -14,7 +16,9 @@
 #include "driver/ledc.h"
 
 #include "Vernon_ST7789T.h"
+#include "Board_Config.h"
 #include "LVGL_Driver.h"
+#include "Splash_Image.h"
 // LCD SPI GPIO
 // Using SPI2 
 #define LCD_HOST  SPI3_HOST
@@ -30,9 +34,7 @@
 #define EXAMPLE_PIN_NUM_LCD_CS         42
 #define EXAMPLE_PIN_NUM_BK_LIGHT       48
 #define EXAMPLE_PIN_NUM_TOUCH_CS       -1
-// The pixel number in horizontal and vertical
-#define EXAMPLE_LCD_H_RES              172
-#define EXAMPLE_LCD_V_RES              320
+// The pixel number in horizontal and vertical, EXAMPLE_LCD_H_RES and EXAMPLE_LCD_V_RES, is in Board_Config.h
 // Bit number used to represent command and parameter
 #define EXAMPLE_LCD_CMD_BITS           8
 #define EXAMPLE_LCD_PARAM_BITS         8
@@ -40,6 +42,10 @@
 #define Offset_X 34
 #define Offset_Y 0
 
+// Boot splash (Splash_Image.c), pushed straight to the panel before LVGL and the radio stack are up.
+// Its background is the LVGL screen background, regenerate it with make_splash.py if that changes.
+#define LCD_SPLASH_LINES               20                               // Lines per splash transfer
+
 
 #define LEDC_HS_TIMER          LEDC_TIMER_0
 #define LEDC_LS_MODE           LEDC_LOW_SPEED_MODE
@@ -55,4 +61,5 @@ extern esp_lcd_panel_handle_t panel_handle;
 void BK_Init(void);                             // Initialize the LCD backlight, which has been called in the LCD_Init function, ignore it                                                         
 void BK_Light(uint8_t Light);                   // Call this function to adjust the brightness of the backlight. The value of the parameter Light ranges from 0 to 100
 
+void LCD_Splash(esp_lcd_panel_io_handle_t io_handle);   // Draw the pre-rendered splash, called from LCD_Init before the display is switched on
 void LCD_Init(void);                     // Call this function to initialize the screen (must be called in the main function) !!!!!
\ No newline at end of file
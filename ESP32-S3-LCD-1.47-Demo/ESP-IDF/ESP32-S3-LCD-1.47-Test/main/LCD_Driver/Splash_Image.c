@@ -0,0 +1,273 @@
+/**
+ * @file Splash_Image.c
+ * @brief Boot splash, generated by make_splash.py, don't edit
+ */
+
+#include "Splash_Image.h"
+
+// 172x320, RGB565, pairs of (run length, colour), 1562 runs
+const uint16_t splash_rle[] = {
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x002c, 0x24be, 0x0002, 0xffff, 0x0002, 0xffdf,
+    0x0002, 0xef5d, 0x0002, 0xdedb, 0x0042, 0xd69a, 0x0002, 0xdedb, 0x0002, 0xef5d, 0x0002, 0xffdf,
+    0x0004, 0xffff, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xffff, 0x0002, 0xffdf, 0x0002, 0xef5d,
+    0x0002, 0xdedb, 0x0042, 0xd69a, 0x0002, 0xdedb, 0x0002, 0xef5d, 0x0002, 0xffdf, 0x0004, 0xffff,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xffdf, 0x0002, 0xd6db, 0x0002, 0xa514, 0x0002, 0x6b6d,
+    0x0002, 0x52ab, 0x003e, 0x52aa, 0x0002, 0x52ab, 0x0002, 0x632d, 0x0002, 0x9cd3, 0x0002, 0xce79,
+    0x0002, 0xf7be, 0x0002, 0xffff, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xffdf, 0x0002, 0xd6db,
+    0x0002, 0xa514, 0x0002, 0x6b6d, 0x0002, 0x52ab, 0x003e, 0x52aa, 0x0002, 0x52ab, 0x0002, 0x632d,
+    0x0002, 0x9cd3, 0x0002, 0xce79, 0x0002, 0xf7be, 0x0002, 0xffff, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xdf1c, 0x0002, 0x7bcf, 0x0002, 0x2986, 0x0046, 0x18e4, 0x0002, 0x2145, 0x0002, 0x6b4d,
+    0x0002, 0xce59, 0x0002, 0xffff, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xdf1c, 0x0002, 0x7bcf,
+    0x0002, 0x2986, 0x0046, 0x18e4, 0x0002, 0x2145, 0x0002, 0x6b4d, 0x0002, 0xce59, 0x0002, 0xffff,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x9cf3, 0x0002, 0x39c7, 0x0002, 0x1904, 0x003e, 0x18e4,
+    0x0004, 0x2104, 0x0002, 0x1904, 0x0002, 0x18e4, 0x0002, 0x1904, 0x0002, 0x2966, 0x0002, 0x8451,
+    0x0002, 0xf7be, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x9cf3, 0x0002, 0x39c7, 0x0002, 0x1904,
+    0x003e, 0x18e4, 0x0004, 0x2104, 0x0002, 0x1904, 0x0002, 0x18e4, 0x0002, 0x1904, 0x0002, 0x2966,
+    0x0002, 0x8451, 0x0002, 0xf7be, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x632c, 0x0002, 0x2125,
+    0x003c, 0x18e4, 0x0002, 0x1904, 0x0002, 0x2966, 0x0002, 0x4208, 0x0002, 0x39e8, 0x0002, 0x2965,
+    0x0002, 0x2104, 0x0002, 0x18e4, 0x0002, 0x2104, 0x0002, 0x630c, 0x0002, 0xe73c, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0x632c, 0x0002, 0x2125, 0x003c, 0x18e4, 0x0002, 0x1904, 0x0002, 0x2966,
+    0x0002, 0x4208, 0x0002, 0x39e8, 0x0002, 0x2965, 0x0002, 0x2104, 0x0002, 0x18e4, 0x0002, 0x2104,
+    0x0002, 0x630c, 0x0002, 0xe73c, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x528a, 0x0002, 0x2104,
+    0x003a, 0x18e4, 0x0002, 0x1904, 0x0002, 0x2145, 0x0002, 0x6b6d, 0x0002, 0xa514, 0x0002, 0x9cf3,
+    0x0002, 0x5aec, 0x0002, 0x2945, 0x0002, 0x1904, 0x0002, 0x18e4, 0x0002, 0x52cb, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x528a, 0x0002, 0x2104, 0x003a, 0x18e4, 0x0002, 0x1904,
+    0x0002, 0x2145, 0x0002, 0x6b6d, 0x0002, 0xa514, 0x0002, 0x9cf3, 0x0002, 0x5aec, 0x0002, 0x2945,
+    0x0002, 0x1904, 0x0002, 0x18e4, 0x0002, 0x52cb, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0x4a6a, 0x0002, 0x2104, 0x003a, 0x18e4, 0x0002, 0x2104, 0x0002, 0x39c7, 0x0002, 0xbe18,
+    0x0002, 0xf79e, 0x0002, 0xef5d, 0x0002, 0x9cf4, 0x0002, 0x39e8, 0x0002, 0x2104, 0x0002, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104,
+    0x003a, 0x18e4, 0x0002, 0x2104, 0x0002, 0x39c7, 0x0002, 0xbe18, 0x0002, 0xf79e, 0x0002, 0xef5d,
+    0x0002, 0x9cf4, 0x0002, 0x39e8, 0x0002, 0x2104, 0x0002, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104, 0x003a, 0x18e4, 0x0002, 0x1904,
+    0x0002, 0x39e8, 0x0002, 0xdefb, 0x0002, 0xffff, 0x0002, 0xf7be, 0x0002, 0xb596, 0x0002, 0x4229,
+    0x0002, 0x2104, 0x0002, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0x4a6a, 0x0002, 0x2104, 0x003a, 0x18e4, 0x0002, 0x1904, 0x0002, 0x39e8, 0x0002, 0xdefb,
+    0x0002, 0xffff, 0x0002, 0xf7be, 0x0002, 0xb596, 0x0002, 0x4229, 0x0002, 0x2104, 0x0002, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104,
+    0x003c, 0x18e4, 0x0002, 0x2965, 0x0002, 0x9492, 0x0002, 0xce79, 0x0002, 0xce59, 0x0002, 0x7bef,
+    0x0002, 0x2986, 0x0002, 0x1904, 0x0002, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104, 0x003c, 0x18e4, 0x0002, 0x2965, 0x0002, 0x9492,
+    0x0002, 0xce79, 0x0002, 0xce59, 0x0002, 0x7bef, 0x0002, 0x2986, 0x0002, 0x1904, 0x0002, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104,
+    0x003c, 0x18e4, 0x0002, 0x2104, 0x0002, 0x39c7, 0x0002, 0x52aa, 0x0002, 0x528a, 0x0002, 0x31a6,
+    0x0002, 0x2104, 0x0004, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0x4a6a, 0x0002, 0x2104, 0x003c, 0x18e4, 0x0002, 0x2104, 0x0002, 0x39c7, 0x0002, 0x52aa,
+    0x0002, 0x528a, 0x0002, 0x31a6, 0x0002, 0x2104, 0x0004, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a, 0x0002, 0x2104, 0x0040, 0x18e4, 0x0004, 0x2104,
+    0x0008, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x4a6a,
+    0x0002, 0x2104, 0x0040, 0x18e4, 0x0004, 0x2104, 0x0008, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x52ab, 0x0002, 0x2124, 0x0014, 0x1904, 0x0038, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x52ab, 0x0002, 0x2124,
+    0x0014, 0x1904, 0x0038, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0x8430, 0x0002, 0x4228, 0x0014, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2945, 0x0002, 0x2104,
+    0x0032, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0x8430,
+    0x0002, 0x4228, 0x0014, 0x31a6, 0x0002, 0x3186, 0x0002, 0x2945, 0x0002, 0x2104, 0x0032, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe71c, 0x0002, 0xad75,
+    0x0002, 0x94d3, 0x0012, 0x94b2, 0x0002, 0x8c71, 0x0002, 0x634d, 0x0002, 0x31a6, 0x0032, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe71c, 0x0002, 0xad75,
+    0x0002, 0x94d3, 0x0012, 0x94b2, 0x0002, 0x8c71, 0x0002, 0x634d, 0x0002, 0x31a6, 0x0032, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xff9e, 0x0002, 0xf71c,
+    0x0012, 0xeedb, 0x0002, 0xeefb, 0x0002, 0xef3c, 0x0002, 0xce79, 0x0002, 0x6b6d, 0x0002, 0x2104,
+    0x0030, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xff9e,
+    0x0002, 0xf71c, 0x0012, 0xeedb, 0x0002, 0xeefb, 0x0002, 0xef3c, 0x0002, 0xce79, 0x0002, 0x6b6d,
+    0x0002, 0x2104, 0x0030, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xf5d7, 0x0002, 0xec51, 0x0012, 0xec10, 0x0002, 0xec92, 0x0002, 0xfeba, 0x0002, 0xef5d,
+    0x0002, 0x8c71, 0x0002, 0x2124, 0x0030, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0xf5d7, 0x0002, 0xec51, 0x0012, 0xec10, 0x0002, 0xec92, 0x0002, 0xfeba,
+    0x0002, 0xef5d, 0x0002, 0x8c71, 0x0002, 0x2124, 0x0030, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe2eb, 0x0002, 0xd904, 0x0012, 0xd8c3, 0x0002, 0xd945,
+    0x0002, 0xf514, 0x0002, 0xf75d, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4, 0x0002, 0x52ab,
+    0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe2eb, 0x0002, 0xd904, 0x0012, 0xd8c3,
+    0x0002, 0xd945, 0x0002, 0xf514, 0x0002, 0xf75d, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec71, 0x0002, 0xf73c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec71, 0x0002, 0xf73c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xf71c, 0x0002, 0x94b2, 0x0002, 0x2125, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec71, 0x0002, 0xf73c, 0x0002, 0x94b2, 0x0002, 0x2145, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec71, 0x0002, 0xf73c, 0x0002, 0x94b2, 0x0002, 0x2145, 0x0030, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe249, 0x0002, 0xd882,
+    0x0012, 0xd861, 0x0002, 0xd8c3, 0x0002, 0xf4d3, 0x0002, 0xf75d, 0x0002, 0xa535, 0x0002, 0x39e7,
+    0x0014, 0x2945, 0x0002, 0x2145, 0x0002, 0x2124, 0x0002, 0x2104, 0x0016, 0x18e4, 0x0002, 0x52ab,
+    0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe249, 0x0002, 0xd882, 0x0012, 0xd861,
+    0x0002, 0xd8c3, 0x0002, 0xf4d3, 0x0002, 0xf75d, 0x0002, 0xa535, 0x0002, 0x39e7, 0x0014, 0x2945,
+    0x0002, 0x2145, 0x0002, 0x2124, 0x0002, 0x2104, 0x0016, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xf4f3, 0x0002, 0xe30c, 0x0012, 0xe2aa, 0x0002, 0xeb4d,
+    0x0002, 0xf638, 0x0002, 0xffbe, 0x0002, 0xd6ba, 0x0002, 0x8c92, 0x0002, 0x738e, 0x0012, 0x6b4d,
+    0x0002, 0x632d, 0x0002, 0x528a, 0x0002, 0x3186, 0x0002, 0x2104, 0x0014, 0x18e4, 0x0002, 0x52ab,
+    0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xf4f3, 0x0002, 0xe30c, 0x0012, 0xe2aa,
+    0x0002, 0xeb4d, 0x0002, 0xf638, 0x0002, 0xffbe, 0x0002, 0xd6ba, 0x0002, 0x8c92, 0x0002, 0x738e,
+    0x0012, 0x6b4d, 0x0002, 0x632d, 0x0002, 0x528a, 0x0002, 0x3186, 0x0002, 0x2104, 0x0014, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xff7d, 0x0002, 0xfeba,
+    0x0012, 0xfe9a, 0x0002, 0xfedb, 0x0002, 0xffbe, 0x0002, 0xffff, 0x0002, 0xffdf, 0x0002, 0xe73d,
+    0x0002, 0xdedb, 0x0002, 0xd6db, 0x0010, 0xd6bb, 0x0002, 0xd6ba, 0x0002, 0xbdf7, 0x0002, 0x6b6d,
+    0x0002, 0x2945, 0x0014, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xff7d, 0x0002, 0xfeba, 0x0012, 0xfe9a, 0x0002, 0xfedb, 0x0002, 0xffbe, 0x0002, 0xffff,
+    0x0002, 0xffdf, 0x0002, 0xe73d, 0x0002, 0xdedb, 0x0002, 0xd6db, 0x0010, 0xd6bb, 0x0002, 0xd6ba,
+    0x0002, 0xbdf7, 0x0002, 0x6b6d, 0x0002, 0x2945, 0x0014, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xfefb, 0x0002, 0xf5b6, 0x0012, 0xf555, 0x0002, 0xf5d7,
+    0x0002, 0xff7d, 0x0002, 0xffff, 0x0002, 0xff3c, 0x0002, 0xf5f7, 0x0012, 0xf555, 0x0002, 0xf5b6,
+    0x0002, 0xff1c, 0x0002, 0xf7be, 0x0002, 0x9cd3, 0x0002, 0x31a6, 0x0002, 0x1904, 0x0012, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xfefb, 0x0002, 0xf5b6,
+    0x0012, 0xf555, 0x0002, 0xf5d7, 0x0002, 0xff7d, 0x0002, 0xffff, 0x0002, 0xff3c, 0x0002, 0xf5f7,
+    0x0012, 0xf555, 0x0002, 0xf5b6, 0x0002, 0xff1c, 0x0002, 0xf7be, 0x0002, 0x9cd3, 0x0002, 0x31a6,
+    0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xebcf, 0x0002, 0xe1e7, 0x0012, 0xe186, 0x0002, 0xe228, 0x0002, 0xf5b6, 0x0002, 0xff9e,
+    0x0002, 0xf575, 0x0002, 0xe228, 0x0012, 0xe186, 0x0002, 0xe1e7, 0x0002, 0xecb2, 0x0002, 0xff7d,
+    0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xebcf, 0x0002, 0xe1e7, 0x0012, 0xe186, 0x0002, 0xe228,
+    0x0002, 0xf5b6, 0x0002, 0xff9e, 0x0002, 0xf575, 0x0002, 0xe228, 0x0012, 0xe186, 0x0002, 0xe1e7,
+    0x0002, 0xecb2, 0x0002, 0xff7d, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1c7, 0x0002, 0xd820,
+    0x0012, 0xd800, 0x0002, 0xd861, 0x0002, 0xec71, 0x0002, 0xff3c, 0x0002, 0xec51, 0x0002, 0xd861,
+    0x0012, 0xd800, 0x0002, 0xd841, 0x0002, 0xeb4d, 0x0002, 0xff1c, 0x0002, 0xa534, 0x0002, 0x39c7,
+    0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xe1c7, 0x0002, 0xd820, 0x0012, 0xd800, 0x0002, 0xd861, 0x0002, 0xec71, 0x0002, 0xff3c,
+    0x0002, 0xec51, 0x0002, 0xd861, 0x0012, 0xd800, 0x0002, 0xd841, 0x0002, 0xeb4d, 0x0002, 0xff1c,
+    0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51,
+    0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c,
+    0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab,
+    0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841,
+    0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820,
+    0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800,
+    0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904,
+    0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6,
+    0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841,
+    0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7,
+    0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30,
+    0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534,
+    0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c,
+    0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb,
+    0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51,
+    0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c,
+    0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab,
+    0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841,
+    0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820,
+    0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4,
+    0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800,
+    0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904,
+    0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6,
+    0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841,
+    0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7,
+    0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30,
+    0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534,
+    0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c,
+    0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb,
+    0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0012, 0x18e4, 0x0002, 0x52ab, 0x0002, 0xdefb,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51,
+    0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c,
+    0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0010, 0x18e4, 0x0002, 0x1904,
+    0x0002, 0x5acb, 0x0002, 0xe71c, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800,
+    0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800,
+    0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904,
+    0x0010, 0x18e4, 0x0002, 0x1904, 0x0002, 0x5acb, 0x0002, 0xe71c, 0x002c, 0x24be, 0x002c, 0x24be,
+    0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51, 0x0002, 0xff1c, 0x0002, 0xec30,
+    0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c, 0x0002, 0xfefb, 0x0002, 0xa534,
+    0x0002, 0x39c7, 0x0002, 0x1904, 0x0010, 0x18e4, 0x0002, 0x2125, 0x0002, 0x73ae, 0x0002, 0xf79e,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1a6, 0x0014, 0xd800, 0x0002, 0xd841, 0x0002, 0xec51,
+    0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb2c,
+    0x0002, 0xfefb, 0x0002, 0xa534, 0x0002, 0x39c7, 0x0002, 0x1904, 0x0010, 0x18e4, 0x0002, 0x2125,
+    0x0002, 0x73ae, 0x0002, 0xf79e, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xe1c7, 0x0014, 0xd800,
+    0x0002, 0xd861, 0x0002, 0xec71, 0x0002, 0xff1c, 0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800,
+    0x0002, 0xd820, 0x0002, 0xeb4d, 0x0002, 0xfefb, 0x0002, 0xad55, 0x0002, 0x39e8, 0x0002, 0x2104,
+    0x000e, 0x18e4, 0x0002, 0x2124, 0x0002, 0x528a, 0x0002, 0xb5b6, 0x0002, 0xffdf, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0xe1c7, 0x0014, 0xd800, 0x0002, 0xd861, 0x0002, 0xec71, 0x0002, 0xff1c,
+    0x0002, 0xec30, 0x0002, 0xd841, 0x0012, 0xd800, 0x0002, 0xd820, 0x0002, 0xeb4d, 0x0002, 0xfefb,
+    0x0002, 0xad55, 0x0002, 0x39e8, 0x0002, 0x2104, 0x000e, 0x18e4, 0x0002, 0x2124, 0x0002, 0x528a,
+    0x0002, 0xb5b6, 0x0002, 0xffdf, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xebae, 0x0002, 0xe186,
+    0x0012, 0xd945, 0x0002, 0xe1c7, 0x0002, 0xf596, 0x0002, 0xff7d, 0x0002, 0xf555, 0x0002, 0xe1e7,
+    0x0012, 0xd945, 0x0002, 0xe1a6, 0x0002, 0xec92, 0x0002, 0xff7d, 0x0002, 0xd69a, 0x0002, 0x73ae,
+    0x0002, 0x4249, 0x000c, 0x4208, 0x0002, 0x4a49, 0x0002, 0x6b4d, 0x0002, 0xad76, 0x0002, 0xef5d,
+    0x0002, 0xffff, 0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xebae, 0x0002, 0xe186, 0x0012, 0xd945,
+    0x0002, 0xe1c7, 0x0002, 0xf596, 0x0002, 0xff7d, 0x0002, 0xf555, 0x0002, 0xe1e7, 0x0012, 0xd945,
+    0x0002, 0xe1a6, 0x0002, 0xec92, 0x0002, 0xff7d, 0x0002, 0xd69a, 0x0002, 0x73ae, 0x0002, 0x4249,
+    0x000c, 0x4208, 0x0002, 0x4a49, 0x0002, 0x6b4d, 0x0002, 0xad76, 0x0002, 0xef5d, 0x0002, 0xffff,
+    0x002c, 0x24be, 0x002c, 0x24be, 0x0002, 0xfedb, 0x0002, 0xf5d7, 0x0012, 0xf575, 0x0002, 0xf5f7,
+    0x0002, 0xff5d, 0x0002, 0xffdf, 0x0002, 0xff3c, 0x0002, 0xf5f7, 0x0012, 0xf575, 0x0002, 0xf5d7,
+    0x0002, 0xfefb, 0x0002, 0xffdf, 0x0002, 0xf7be, 0x0002, 0xdedb, 0x0002, 0xbdf7, 0x000a, 0xb5b7,
+    0x0002, 0xbdd7, 0x0002, 0xbe18, 0x0002, 0xdedb, 0x0002, 0xf79e, 0x0004, 0xffff, 0x002c, 0x24be,
+    0x002c, 0x24be, 0x0002, 0xfedb, 0x0002, 0xf5d7, 0x0012, 0xf575, 0x0002, 0xf5f7, 0x0002, 0xff5d,
+    0x0002, 0xffdf, 0x0002, 0xff3c, 0x0002, 0xf5f7, 0x0012, 0xf575, 0x0002, 0xf5d7, 0x0002, 0xfefb,
+    0x0002, 0xffdf, 0x0002, 0xf7be, 0x0002, 0xdedb, 0x0002, 0xbdf7, 0x000a, 0xb5b7, 0x0002, 0xbdd7,
+    0x0002, 0xbe18, 0x0002, 0xdedb, 0x0002, 0xf79e, 0x0004, 0xffff, 0x002c, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be, 0x00ac, 0x24be,
+    0x00ac, 0x24be, 0x00ac, 0x24be,
+};
+
+const uint32_t splash_rle_len = sizeof(splash_rle) / sizeof(splash_rle[0]);
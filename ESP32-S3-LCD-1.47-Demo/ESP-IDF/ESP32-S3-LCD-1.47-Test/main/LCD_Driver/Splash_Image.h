@@ -0,0 +1,12 @@
+/**
+ * @file Splash_Image.h
+ * @brief Pre-rendered boot splash, see make_splash.py
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Full screen, RGB565, pairs of (run length, colour). No run crosses a row.
+extern const uint16_t splash_rle[];
+extern const uint32_t splash_rle_len;
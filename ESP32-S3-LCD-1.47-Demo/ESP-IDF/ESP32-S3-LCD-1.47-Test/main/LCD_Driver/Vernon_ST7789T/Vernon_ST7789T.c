@@ -27,6 +27,8 @@
 
 static const char *TAG = "lcd_panel.st7789t";
 
+#define ST7789T_MEM_LINES   320     // Lines of the frame memory, the scroll definition has to cover all of them
+
 static esp_err_t panel_st7789t_del(esp_lcd_panel_t *panel);
 static esp_err_t panel_st7789t_reset(esp_lcd_panel_t *panel);
 static esp_err_t panel_st7789t_init(esp_lcd_panel_t *panel);
@@ -124,6 +126,33 @@ err:
     return ret;
 }
 
+esp_err_t esp_lcd_panel_st7789t_set_vscroll(esp_lcd_panel_handle_t panel, int top, int height, int start_line)
+{
+    st7789t_panel_t *st7789t = __containerof(panel, st7789t_panel_t, base);
+    esp_lcd_panel_io_handle_t io = st7789t->io;
+
+    top += st7789t->y_gap;
+    start_line += st7789t->y_gap;
+    ESP_RETURN_ON_FALSE(top >= 0 && height > 0 && top + height <= ST7789T_MEM_LINES, ESP_ERR_INVALID_ARG, TAG, "invalid scroll area");
+    ESP_RETURN_ON_FALSE(start_line >= top && start_line < top + height, ESP_ERR_INVALID_ARG, TAG, "invalid start line");
+
+    int bottom = ST7789T_MEM_LINES - top - height;
+    esp_lcd_panel_io_tx_param(io, LCD_CMD_VSCRDEF, (uint8_t[]) {
+        (top >> 8) & 0xFF,
+        top & 0xFF,
+        (height >> 8) & 0xFF,
+        height & 0xFF,
+        (bottom >> 8) & 0xFF,
+        bottom & 0xFF,
+    }, 6);
+    esp_lcd_panel_io_tx_param(io, LCD_CMD_VSCSAD, (uint8_t[]) {
+        (start_line >> 8) & 0xFF,
+        start_line & 0xFF,
+    }, 2);
+
+    return ESP_OK;
+}
+
 static esp_err_t panel_st7789t_del(esp_lcd_panel_t *panel)
 {
     st7789t_panel_t *st7789t = __containerof(panel, st7789t_panel_t, base);
@@ -42,6 +42,22 @@ typedef struct {
  */
 esp_err_t esp_lcd_new_panel_st7789t(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_st7789t_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
 
+/**
+ * @brief Set the vertical scrolling of the panel
+ *
+ * @note The lines above and below the scroll area show the frame memory unchanged.
+ *       The lines of the scroll area show the frame memory from `start_line`, wrapping around inside the area.
+ *
+ * @param[in] panel LCD panel handle, returned from `esp_lcd_new_panel_st7789t`
+ * @param[in] top First line of the scroll area
+ * @param[in] height Number of lines in the scroll area
+ * @param[in] start_line Line of the frame memory shown on the first line of the scroll area, in [top, top + height)
+ * @return
+ *          - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *          - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_st7789t_set_vscroll(esp_lcd_panel_handle_t panel, int top, int height, int start_line);
+
 #ifdef __cplusplus
 }
 #endif
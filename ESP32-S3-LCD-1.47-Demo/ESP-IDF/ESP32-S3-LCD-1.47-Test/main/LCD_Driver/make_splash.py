@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Pre-render the boot splash into Splash_Image.c
+
+The splash is the LVGL screen background with the LVGL logo (2x) in the middle,
+stored as run-length encoded RGB565 rows: pairs of (run length, colour).
+Run from this directory after changing the colour, the logo or the resolution:
+
+    python3 make_splash.py
+"""
+
+import re
+from pathlib import Path
+
+H_RES = 172                 # EXAMPLE_LCD_H_RES of Board_Config.h
+V_RES = 320                 # EXAMPLE_LCD_V_RES
+BG = 0x2196F3               # Screen background of Lvgl_Example1
+SCALE = 2
+
+HERE = Path(__file__).resolve().parent
+LOGO = HERE / "../../components/lvgl__lvgl/demos/widgets/assets/img_lvgl_logo.c"
+LOGO_W, LOGO_H = 42, 43
+
+
+def read_logo():
+    """BGRA pixels of the 32 bit colour depth variant of the logo"""
+    src = LOGO.read_text()
+    part = src.split("#if LV_COLOR_DEPTH == 32", 1)[1].split("#endif", 1)[0]
+    data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", part)]
+    assert len(data) == LOGO_W * LOGO_H * 4
+    return [data[i:i + 4] for i in range(0, len(data), 4)]
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def render():
+    bg = ((BG >> 16) & 0xff, (BG >> 8) & 0xff, BG & 0xff)
+    logo = read_logo()
+    x0 = (H_RES - LOGO_W * SCALE) // 2
+    y0 = (V_RES - LOGO_H * SCALE) // 2
+    rows = []
+    for y in range(V_RES):
+        row = []
+        for x in range(H_RES):
+            lx = (x - x0) // SCALE
+            ly = (y - y0) // SCALE
+            if 0 <= lx < LOGO_W and 0 <= ly < LOGO_H and x >= x0 and y >= y0:
+                b, g, r, a = logo[ly * LOGO_W + lx]
+                px = tuple((c * a + k * (255 - a)) // 255 for c, k in zip((r, g, b), bg))
+            else:
+                px = bg
+            row.append(rgb565(*px))
+        rows.append(row)
+    return rows
+
+
+def encode(rows):
+    """Runs never cross a row so a band of lines can be decoded on its own"""
+    runs = []
+    for row in rows:
+        x = 0
+        while x < len(row):
+            n = 1
+            while x + n < len(row) and row[x + n] == row[x]:
+                n += 1
+            runs += [n, row[x]]
+            x += n
+    return runs
+
+
+def main():
+    runs = encode(render())
+    lines = []
+    for i in range(0, len(runs), 12):
+        lines.append("    " + " ".join("0x%04x," % v for v in runs[i:i + 12]))
+
+    out = HERE / "Splash_Image.c"
+    out.write_text(
+        "/**\n"
+        " * @file Splash_Image.c\n"
+        " * @brief Boot splash, generated by make_splash.py, don't edit\n"
+        " */\n"
+        "\n"
+        "#include \"Splash_Image.h\"\n"
+        "\n"
+        "// %dx%d, RGB565, pairs of (run length, colour), %d runs\n"
+        "const uint16_t splash_rle[] = {\n"
+        "%s\n"
+        "};\n"
+        "\n"
+        "const uint32_t splash_rle_len = sizeof(splash_rle) / sizeof(splash_rle[0]);\n"
+        % (H_RES, V_RES, len(runs) // 2, "\n".join(lines)))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,25 +1,41 @@
+#include <stdlib.h>
 #include "LVGL_Driver.h"
+#include "Memory_Plan.h"
+#if CONFIG_LVGL_AUTO_LIGHT_SLEEP
+#include "esp_pm.h"
+#endif
 
 static const char *TAG_LVGL = "WS_LVGL";
 
-static lv_color_t buf1[ LVGL_BUF_LEN ];
-static lv_color_t buf2[ LVGL_BUF_LEN];
-// static lv_color_t* buf1 = (lv_color_t*) heap_caps_malloc(LVGL_BUF_LEN , MALLOC_CAP_SPIRAM);
-// static lv_color_t* buf2 = (lv_color_t*) heap_caps_malloc(LVGL_BUF_LEN , MALLOC_CAP_SPIRAM);
-    
 
 lv_disp_draw_buf_t disp_buf;                                                 // contains internal graphic buffer(s) called draw buffer(s)
 lv_disp_drv_t disp_drv;                                                      // contains callback functions
-    
-void example_increase_lvgl_tick(void *arg)
+
+// Vertical scrolling of the panel: the lines of [vs_top, vs_top + vs_height) show the frame memory rotated by vs_ofs lines
+static lv_coord_t vs_top = 0;
+static lv_coord_t vs_height = EXAMPLE_LCD_V_RES;
+static lv_coord_t vs_ofs = 0;
+static bool vs_changed = false;                                              // The new scroll is sent to the panel after the last flush of the frame
+static volatile int flush_parts_left = 0;                                    // Color transfers of the current flush still in progress
+
+static TaskHandle_t lvgl_task = NULL;                                        // The task calling lv_timer_handler, woken by LVGL_Wake
+
+
+/* LVGL reads the time from the monotonic clock, so no periodic timer has to wake up the CPU */
+static uint32_t lvgl_tick_get_cb(void)
 {
-    /* Tell LVGL how many milliseconds has elapsed */
-    lv_tick_inc(EXAMPLE_LVGL_TICK_PERIOD_MS);
+    return (uint32_t)(esp_timer_get_time() / 1000);
 }
 
 bool example_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
     lv_disp_drv_t *disp_driver = (lv_disp_drv_t *)user_ctx;
+    // The splash is pushed before LVGL_Init, there is no draw buffer to release yet
+    if (disp_driver->draw_buf == NULL)
+        return false;
+    // A flush crossing the wrap line of the scroll area is sent in more parts
+    if (--flush_parts_left > 0)
+        return false;
     lv_disp_flush_ready(disp_driver);
     return false;
 }
@@ -31,8 +47,76 @@ void example_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
-    // copy a buffer's content to a specific area of the display
-    esp_lcd_panel_draw_bitmap(panel_handle, offsetx1 + Offset_X, offsety1 + Offset_Y, offsetx2 + Offset_X + 1, offsety2 + Offset_Y + 1, color_map);
+    int w = offsetx2 - offsetx1 + 1;
+
+    // Split the lines by where they are in the frame memory: above, in (before and after the wrap line) and below the scroll area
+    int wrap = vs_top + vs_height - vs_ofs;
+    int parts[5] = {offsety1, vs_top, wrap, vs_top + vs_height, offsety2 + 1};
+    int ys[4];
+    int ye[4];
+    int cnt = 0;
+    for (int i = 0; i < 4; i++) {
+        int y1 = LV_MAX(offsety1, parts[i]);
+        int y2 = LV_MIN(offsety2 + 1, parts[i + 1]);
+        if (y1 >= y2) continue;
+        ys[cnt] = y1;
+        ye[cnt] = y2;
+        cnt++;
+    }
+
+    flush_parts_left = cnt;
+    for (int i = 0; i < cnt; i++) {
+        int mem_y = ys[i];
+        if (mem_y >= vs_top && mem_y < vs_top + vs_height) mem_y = vs_top + (mem_y - vs_top + vs_ofs) % vs_height;
+        // copy a buffer's content to a specific area of the display
+        esp_lcd_panel_draw_bitmap(panel_handle, offsetx1 + Offset_X, mem_y + Offset_Y, offsetx2 + Offset_X + 1, mem_y + ye[i] - ys[i] + Offset_Y,
+                                  color_map + (ys[i] - offsety1) * w);
+    }
+
+    // Scroll the panel only when the uncovered lines and the scrollbar are in the frame memory, else the lines wrapped
+    // around from the other end of the scroll area would be visible until they are sent.
+    // The command waits for the color transfers queued above.
+    if (vs_changed && lv_disp_flush_is_last(drv)) {
+        vs_changed = false;
+        if (esp_lcd_panel_st7789t_set_vscroll(panel_handle, vs_top, vs_height, vs_top + vs_ofs) != ESP_OK)
+            ESP_LOGE(TAG_LVGL, "Vertical scroll failed");
+    }
+}
+
+/* The panel scrolls whole lines, so the hardware is used when LVGL isn't rotated and the scrolled area is at least half
+ * as wide as the screen. The lines of the area are scrolled on the full width and the parts beside the area are redrawn,
+ * which is less than redrawing the area. Else LVGL redraws the area. */
+bool example_lvgl_scroll_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_coord_t dy)
+{
+    lv_coord_t w = lv_area_get_width(area);
+    if (drv->rotated != LV_DISP_ROT_NONE || drv->hor_res - w >= w)
+        return false;
+
+    lv_coord_t h = lv_area_get_height(area);
+    if (area->y1 != vs_top || h != vs_height) {
+        // The old area shows the frame memory rotated, redraw it in the order of the new one
+        if (vs_ofs != 0) {
+            lv_area_t old = {0, vs_top, drv->hor_res - 1, vs_top + vs_height - 1};
+            lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &old);
+        }
+        vs_top = area->y1;
+        vs_height = h;
+        vs_ofs = 0;
+    }
+
+    vs_ofs = ((vs_ofs - dy) % vs_height + vs_height) % vs_height;
+    vs_changed = true;
+
+    // The parts of the lines beside the area are moved too
+    lv_area_t side = {0, area->y1, area->x1 - 1, area->y2};
+    if (side.x2 >= side.x1)
+        lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &side);
+    side.x1 = area->x2 + 1;
+    side.x2 = drv->hor_res - 1;
+    if (side.x2 >= side.x1)
+        lv_obj_invalidate_area(lv_disp_get_scr_act(disp), &side);
+
+    return true;
 }
 
 /* Rotate display and touch, when rotated screen in LVGL. Called when driver parameters are updated. */
@@ -70,8 +154,21 @@ void LVGL_Init(void)
 {
     ESP_LOGI(TAG_LVGL, "Initialize LVGL library");
     lv_init();
+    lv_tick_set_cb(lvgl_tick_get_cb);
+    lvgl_task = xTaskGetCurrentTaskHandle();
+
+    if (Memory_Plan_Size(MEM_LVGL_LARGE_POOL) > 0) {
+        void *pool = Memory_Plan_Alloc(MEM_LVGL_LARGE_POOL);                                            // Image, font and canvas data, see Memory_Plan.h
+        if (pool == NULL || lv_mem_add_pool(pool, Memory_Plan_Size(MEM_LVGL_LARGE_POOL), LV_MEM_HINT_LARGE) < 0) {
+            ESP_LOGW(TAG_LVGL, "No LVGL large pool, its data is allocated from the LVGL heap");
+            free(pool);
+        }
+    }
     
-    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, EXAMPLE_LCD_H_RES * 20);                              // initialize LVGL draw buffers
+    lv_color_t *buf1 = Memory_Plan_Alloc(MEM_LVGL_BUF1);                                                // SPI DMA reads the draw buffers, see Memory_Plan.h
+    lv_color_t *buf2 = Memory_Plan_Alloc(MEM_LVGL_BUF2);
+    ESP_ERROR_CHECK((buf1 && buf2) ? ESP_OK : ESP_ERR_NO_MEM);
+    lv_disp_draw_buf_init(&disp_buf, buf1, buf2, LVGL_BUF_LEN);                                         // initialize LVGL draw buffers
 
     ESP_LOGI(TAG_LVGL, "Register display driver to LVGL");
     lv_disp_drv_init(&disp_drv);                                                                        // Create a new screen object and initialize the associated device
@@ -81,20 +178,46 @@ void LVGL_Init(void)
     disp_drv.flush_cb = example_lvgl_flush_cb;                                                          // Function : copy a buffer's content to a specific area of the display
     disp_drv.drv_update_cb = example_lvgl_port_update_callback;                                         // Function : Rotate display and touch, when rotated screen in LVGL. Called when driver parameters are updated. 
     disp_drv.draw_buf = &disp_buf;                                                                      // LVGL will use this buffer(s) to draw the screens contents
+    disp_drv.flush_cost = EXAMPLE_LCD_H_RES * 8;                                                        // CASET/RASET/RAMWR and the DMA setup cost about as much as 8 lines of pixels at 12 MHz
+    disp_drv.scroll_copy = 1;                                                                           // Scrolled lists are moved by the panel, only the uncovered lines are sent
+    disp_drv.scroll_cb = example_lvgl_scroll_cb;
     disp_drv.user_data = panel_handle;                
     ESP_LOGI(TAG_LVGL,"Register display indev to LVGL");                                                  // Custom display driver user data
     disp = lv_disp_drv_register(&disp_drv);                                                  // Create screen objects
-    
-    /********************* LVGL *********************/
-    ESP_LOGI(TAG_LVGL, "Install LVGL tick timer");
-    // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
-    const esp_timer_create_args_t lvgl_tick_timer_args = {
-        .callback = &example_increase_lvgl_tick,
-        .name = "lvgl_tick"
+
+#if CONFIG_LVGL_AUTO_LIGHT_SLEEP
+    // The SPI driver holds a PM lock while a transfer is in progress, so a flush is never cut by the sleep
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = CONFIG_XTAL_FREQ,
+        .light_sleep_enable = true,
     };
-    
-    esp_timer_handle_t lvgl_tick_timer = NULL;
-    ESP_ERROR_CHECK(esp_timer_create(&lvgl_tick_timer_args, &lvgl_tick_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, EXAMPLE_LVGL_TICK_PERIOD_MS * 1000));
+    ESP_ERROR_CHECK(esp_pm_configure(&pm_config));
+#endif
+}
+
+void LVGL_Wait(uint32_t wait_ms)
+{
+    TickType_t ticks = portMAX_DELAY;                                                                   // No timer scheduled, sleep until woken
+    if (wait_ms != LV_NO_TIMER_READY)
+        ticks = (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;                                // Round up, waking up too early only costs another wait
+    ulTaskNotifyTake(pdTRUE, ticks);
 
+#if LVGL_WAKEUP_LOG_PERIOD_MS
+    static uint32_t wakeup_cnt = 0;
+    static int64_t log_start = 0;
+    int64_t now = esp_timer_get_time();
+    wakeup_cnt++;
+    if (now - log_start >= LVGL_WAKEUP_LOG_PERIOD_MS * 1000LL) {
+        ESP_LOGI(TAG_LVGL, "%"PRIu32" wakeups in %"PRIu32" ms", wakeup_cnt, (uint32_t)((now - log_start) / 1000));
+        wakeup_cnt = 0;
+        log_start = now;
+    }
+#endif
+}
+
+void LVGL_Wake(void)
+{
+    if (lvgl_task)
+        xTaskNotifyGive(lvgl_task);
 }
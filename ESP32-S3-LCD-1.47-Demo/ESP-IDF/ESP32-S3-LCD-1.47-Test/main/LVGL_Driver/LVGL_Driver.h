@@ -8,10 +8,10 @@
 #include "lvgl.h"
 #include "demos/lv_demos.h"
 
+#include "Board_Config.h"                                                       // LVGL_BUF_LEN
 #include "ST7789.h"
 
-#define LVGL_BUF_LEN  (EXAMPLE_LCD_H_RES * EXAMPLE_LCD_V_RES / 10)
-#define EXAMPLE_LVGL_TICK_PERIOD_MS    2
+#define LVGL_WAKEUP_LOG_PERIOD_MS      0                                            // Log the wakeups of the LVGL task this often, 0: never
 
 extern lv_disp_draw_buf_t disp_buf;                                                 // contains internal graphic buffer(s) called draw buffer(s)
 extern lv_disp_drv_t disp_drv;                                                      // contains callback functions
@@ -19,8 +19,13 @@ extern lv_disp_t *disp;
 
 bool example_notify_lvgl_flush_ready(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx);
 void example_lvgl_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_map);
+/* Move the pixels of a full-width area with the vertical scrolling of the panel instead of redrawing them. */
+bool example_lvgl_scroll_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_coord_t dy);
 /* Rotate display and touch, when rotated screen in LVGL. Called when driver parameters are updated. */
 void example_lvgl_port_update_callback(lv_disp_drv_t *drv);
-void example_increase_lvgl_tick(void *arg);
 
-void LVGL_Init(void);                     // Call this function to initialize the screen (must be called in the main function) !!!!!
\ No newline at end of file
+void LVGL_Init(void);                     // Call this function to initialize the screen (must be called in the main function) !!!!!
+/* Block the LVGL task for wait_ms (the return value of lv_timer_handler) or until LVGL_Wake is called. */
+void LVGL_Wait(uint32_t wait_ms);
+/* Wake up the LVGL task from LVGL_Wait, safe to call from any task. */
+void LVGL_Wake(void);
\ No newline at end of file
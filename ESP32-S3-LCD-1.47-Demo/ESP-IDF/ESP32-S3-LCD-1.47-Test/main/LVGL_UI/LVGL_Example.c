@@ -1,18 +1,18 @@
 #include "LVGL_Example.h"
-#include "esp_netif.h"
-#include "../WLED/WLED_Controller.h"
+#include "Status_Bus.h"
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static lv_obj_t * ip_label;
-static lv_timer_t * update_timer;
+static lv_obj_t * scan_label;
 static const lv_font_t * font_large;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void update_ip_display(lv_timer_t * timer);
+static void ip_label_event_cb(lv_event_t * e);
+static void scan_label_event_cb(lv_event_t * e);
 
 void Lvgl_Example1(void)
 {
@@ -38,48 +38,71 @@ void Lvgl_Example1(void)
     
     // Center the label on screen
     lv_obj_align(ip_label, LV_ALIGN_CENTER, 0, 0);
+
+    // The labels are only relabelled when a value they show is published with a new value
+    lv_obj_add_event_cb(ip_label, ip_label_event_cb, LV_EVENT_MSG_RECEIVED, NULL);
+    lv_msg_subscribe_obj(STATUS_IP, ip_label, NULL);
+    lv_msg_subscribe_obj(STATUS_MAC, ip_label, NULL);
+
+    // Scan results and WLED broadcast status along the bottom edge
+    scan_label = lv_label_create(lv_scr_act());
+    lv_label_set_text(scan_label, "Scanning...");
+    lv_obj_set_style_text_color(scan_label, lv_color_white(), 0);
+    lv_obj_align(scan_label, LV_ALIGN_BOTTOM_MID, 0, -10);
+    lv_obj_add_event_cb(scan_label, scan_label_event_cb, LV_EVENT_MSG_RECEIVED, NULL);
+    lv_msg_subscribe_obj(STATUS_WIFI_NUM, scan_label, NULL);
+    lv_msg_subscribe_obj(STATUS_BLE_NUM, scan_label, NULL);
+    lv_msg_subscribe_obj(STATUS_WLED, scan_label, NULL);
+    lv_msg_subscribe_obj(STATUS_WLED_TOTAL, scan_label, NULL);
     
     // Set background color
     lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x2196F3), 0);
     
-    // Create timer to update IP display every 500ms
-    update_timer = lv_timer_create(update_ip_display, 500, NULL);
+    // The LVGL task forwards the changed status values, nothing is redrawn while they stay the same
+    Status_Resend();
 }
 
 void Lvgl_Example1_close(void)
 {
-    if (update_timer) {
-        lv_timer_del(update_timer);
-        update_timer = NULL;
-    }
     lv_obj_clean(lv_scr_act());
 }
 
-static void update_ip_display(lv_timer_t * timer)
+static void ip_label_event_cb(lv_event_t * e)
 {
-    char buf[256] = {0};
-    char mac_str[18] = {0};
-    
-    // Get MAC address
-    WLED_ESPNOW_GetMAC(mac_str);
-    
-    // Get IP address if WiFi is connected
-    esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
-    if (netif) {
-        esp_netif_ip_info_t ip_info;
-        if (esp_netif_get_ip_info(netif, &ip_info) == ESP_OK) {
-            // Check if we have a valid IP (not 0.0.0.0)
-            if (ip_info.ip.addr != 0) {
-                snprintf(buf, sizeof(buf), "IP: " IPSTR "\nMAC: %s", IP2STR(&ip_info.ip), mac_str);
-            } else {
-                snprintf(buf, sizeof(buf), "IP: Not Connected\nMAC: %s", mac_str);
-            }
-        } else {
-            snprintf(buf, sizeof(buf), "IP: No WiFi\nMAC: %s", mac_str);
-        }
+    static uint32_t ip;     // In network order, the first byte is the lowest
+    static bool ip_known;
+    static char mac_str[STATUS_STR_LEN] = "Loading...";
+    char buf[64];
+
+    lv_msg_t * m = lv_event_get_msg(e);
+    const status_value_t * v = lv_msg_get_payload(m);
+    if (lv_msg_get_id(m) == STATUS_IP) {
+        ip = v->u32;
+        ip_known = true;
     } else {
-        snprintf(buf, sizeof(buf), "IP: Initializing...\nMAC: %s", mac_str);
+        lv_snprintf(mac_str, sizeof(mac_str), "%s", v->str);
+    }
+
+    if (!ip_known) {
+        lv_snprintf(buf, sizeof(buf), "IP: Connecting...\nMAC: %s", mac_str);
+    } else if (ip != 0) {
+        lv_snprintf(buf, sizeof(buf), "IP: %u.%u.%u.%u\nMAC: %s", (unsigned)(ip & 0xff), (unsigned)((ip >> 8) & 0xff),
+                    (unsigned)((ip >> 16) & 0xff), (unsigned)(ip >> 24), mac_str);
+    } else {
+        lv_snprintf(buf, sizeof(buf), "IP: Not Connected\nMAC: %s", mac_str);
     }
-    
     lv_label_set_text(ip_label, buf);
 }
+
+static void scan_label_event_cb(lv_event_t * e)
+{
+    static uint32_t counts[STATUS_NUM];
+
+    lv_msg_t * m = lv_event_get_msg(e);
+    const status_value_t * v = lv_msg_get_payload(m);
+    counts[lv_msg_get_id(m)] = v->u32;
+
+    lv_label_set_text_fmt(scan_label, "WiFi %u  BLE %u  WLED %u/%u",
+                          (unsigned)counts[STATUS_WIFI_NUM], (unsigned)counts[STATUS_BLE_NUM],
+                          (unsigned)counts[STATUS_WLED], (unsigned)counts[STATUS_WLED_TOTAL]);
+}
@@ -1,11 +1,6 @@
 #pragma once
 
 #include "lvgl.h"
-#include "demos/lv_demos.h"
-
-#include "LVGL_Driver.h"
-#include "SD_MMC.h"
-#include "Wireless.h"
 
 #define EXAMPLE1_LVGL_TICK_PERIOD_MS  1000
 
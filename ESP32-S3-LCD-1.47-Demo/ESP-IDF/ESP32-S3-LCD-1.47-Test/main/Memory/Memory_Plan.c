@@ -0,0 +1,102 @@
+/**
+ * @file Memory_Plan.c
+ * @brief Memory placement table, allocation and boot-time report
+ */
+
+#include "Memory_Plan.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "MEM_PLAN";
+
+typedef struct {
+    const char *name;
+    size_t size;
+    mem_place_t place;
+} mem_plan_entry_t;
+
+static const mem_plan_entry_t mem_plan[MEM_ID_NUM] = {
+#define MEMORY_PLAN_ENTRY(id, name, size, place) [id] = { name, size, place },
+    MEMORY_PLAN(MEMORY_PLAN_ENTRY)
+#undef MEMORY_PLAN_ENTRY
+};
+
+// On the ESP32-S3 all internal data RAM is DMA capable, so DMA and internal
+// buffers come out of the same budget
+#define MEMORY_PLAN_INTERNAL_BYTES(id, name, size, place) + ((place) != MEM_PLACE_PSRAM ? (size) : 0)
+_Static_assert((0 MEMORY_PLAN(MEMORY_PLAN_INTERNAL_BYTES)) <= CONFIG_MEMORY_DMA_BUDGET_KILOBYTES * 1024,
+               "Memory plan exceeds CONFIG_MEMORY_DMA_BUDGET_KILOBYTES, move buffers to PSRAM or raise the budget");
+#undef MEMORY_PLAN_INTERNAL_BYTES
+
+static const char *place_names[] = {
+    [MEM_PLACE_DMA]      = "DMA",
+    [MEM_PLACE_INTERNAL] = "internal",
+    [MEM_PLACE_PSRAM]    = "PSRAM",
+};
+
+static uint32_t place_caps(mem_place_t place)
+{
+    switch (place) {
+    case MEM_PLACE_DMA:
+        return MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL;
+    case MEM_PLACE_PSRAM:
+        return MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+    case MEM_PLACE_INTERNAL:
+    default:
+        return MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    }
+}
+
+size_t Memory_Plan_Size(mem_id_t id)
+{
+    return mem_plan[id].size;
+}
+
+void *Memory_Plan_Alloc(mem_id_t id)
+{
+    const mem_plan_entry_t *entry = &mem_plan[id];
+    void *buf = heap_caps_malloc(entry->size, place_caps(entry->place));
+    if (buf == NULL && entry->place == MEM_PLACE_PSRAM) {
+        ESP_LOGW(TAG, "%s: no PSRAM left, using internal RAM", entry->name);
+        buf = heap_caps_malloc(entry->size, place_caps(MEM_PLACE_INTERNAL));
+    }
+    if (buf == NULL) {
+        ESP_LOGE(TAG, "%s: failed to allocate %u bytes", entry->name, (unsigned)entry->size);
+    }
+    return buf;
+}
+
+static void report_caps(const char *name, uint32_t caps)
+{
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, caps);
+    ESP_LOGI(TAG, "%-9s free %7u B, min free %7u B, largest block %7u B",
+             name, (unsigned)info.total_free_bytes, (unsigned)info.minimum_free_bytes,
+             (unsigned)info.largest_free_block);
+}
+
+void Memory_Plan_Report(void)
+{
+    size_t planned[MEM_PLACE_PSRAM + 1] = {0};
+
+    ESP_LOGI(TAG, "Planned buffers:");
+    for (int i = 0; i < MEM_ID_NUM; i++) {
+        ESP_LOGI(TAG, "  %-20s %7u B  %s", mem_plan[i].name, (unsigned)mem_plan[i].size,
+                 place_names[mem_plan[i].place]);
+        planned[mem_plan[i].place] += mem_plan[i].size;
+    }
+    ESP_LOGI(TAG, "Planned: DMA %u B, internal %u B (budget %u B), PSRAM %u B",
+             (unsigned)planned[MEM_PLACE_DMA], (unsigned)planned[MEM_PLACE_INTERNAL],
+             CONFIG_MEMORY_DMA_BUDGET_KILOBYTES * 1024U, (unsigned)planned[MEM_PLACE_PSRAM]);
+
+    report_caps("DMA", MALLOC_CAP_DMA);
+    report_caps("internal", MALLOC_CAP_INTERNAL);
+    report_caps("PSRAM", MALLOC_CAP_SPIRAM);
+
+    for (uint32_t i = 0; i < lv_mem_get_pool_cnt(); i++) {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor_pool(i, &mon);
+        ESP_LOGI(TAG, "LVGL pool %u: used %u%%, max used %u B, fragmentation %u%%",
+                 (unsigned)i, mon.used_pct, (unsigned)mon.max_used, mon.frag_pct);
+    }
+}
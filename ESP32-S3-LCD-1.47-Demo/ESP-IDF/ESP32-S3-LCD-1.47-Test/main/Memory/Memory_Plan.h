@@ -0,0 +1,101 @@
+/**
+ * @file Memory_Plan.h
+ * @brief Placement of the app's large buffers in internal/DMA RAM or PSRAM
+ *
+ * Every buffer worth more than a few hundred bytes is listed once in
+ * MEMORY_PLAN, together with the memory it has to live in. Buffers owned by
+ * the app are allocated through Memory_Plan_Alloc(); buffers owned by IDF
+ * components are listed so they count against the internal RAM budget.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "lvgl.h"
+
+#include "Board_Config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    MEM_PLACE_DMA,          // Internal RAM that a peripheral reads with DMA
+    MEM_PLACE_INTERNAL,     // Internal RAM, accessed with the flash cache disabled or every frame
+    MEM_PLACE_PSRAM,        // External RAM, for cold or large data
+} mem_place_t;
+
+/*
+ * X(id, name, size in bytes, placement)
+ *
+ * - LVGL draw buffers: rendered every frame and read by SPI DMA on every flush.
+ * - LVGL heap: static array in lv_mem.c, objects and styles are read on every frame.
+ * - LVGL large pool: second LVGL heap for image, font and canvas data, see lv_mem_add_pool().
+ * - httpd stack: the task is created by esp_http_server, which only uses internal RAM.
+ * - Wi-Fi and BLE stacks: esp_wifi and Bluedroid write NVS, which disables the
+ *   cache, so their stacks can not live in PSRAM.
+ * - RGB stack: the pulse loop never touches flash.
+ * - LED strip pixels: calloc'd by led_strip, below CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL.
+ * - LVGL blend workers: tasks created by LVGL with xTaskCreate(), stacks in internal RAM.
+ * - LVGL style cache: static array in lv_obj_style.c, about 20 bytes per entry.
+ */
+#ifdef CONFIG_LV_USE_DRAW_SW_PARALLEL
+#define LVGL_WORKER_STACK_BYTES (CONFIG_LV_DRAW_SW_PARALLEL_STACK_SIZE * CONFIG_LV_DRAW_SW_PARALLEL_WORKER_CNT)
+#else
+#define LVGL_WORKER_STACK_BYTES 0
+#endif
+
+#ifdef CONFIG_LV_OBJ_STYLE_CACHE_SIZE
+#define LVGL_STYLE_CACHE_BYTES (CONFIG_LV_OBJ_STYLE_CACHE_SIZE * 20)
+#else
+#define LVGL_STYLE_CACHE_BYTES 0
+#endif
+
+#define MEMORY_PLAN(X) \
+    X(MEM_LVGL_BUF1,       "LVGL draw buffer 1", LVGL_BUF_LEN * sizeof(lv_color_t), MEM_PLACE_DMA)      \
+    X(MEM_LVGL_BUF2,       "LVGL draw buffer 2", LVGL_BUF_LEN * sizeof(lv_color_t), MEM_PLACE_DMA)      \
+    X(MEM_LVGL_HEAP,       "LVGL heap",          LV_MEM_SIZE,                       MEM_PLACE_INTERNAL) \
+    X(MEM_LVGL_LARGE_POOL, "LVGL large pool",    CONFIG_LVGL_LARGE_POOL_KILOBYTES * 1024U, MEM_PLACE_PSRAM) \
+    X(MEM_HTTPD_STACK,     "httpd stack",        8192,                              MEM_PLACE_INTERNAL) \
+    X(MEM_WIFI_STACK,      "Wi-Fi task stack",   8192,                              MEM_PLACE_INTERNAL) \
+    X(MEM_BLE_STACK,       "BLE task stack",     4096,                              MEM_PLACE_INTERNAL) \
+    X(MEM_RGB_STACK,       "RGB task stack",     4096,                              MEM_PLACE_PSRAM)    \
+    X(MEM_LED_STRIP,       "LED strip pixels",   RGB_LED_NUM * 3,                   MEM_PLACE_INTERNAL) \
+    X(MEM_LVGL_WORKERS,    "LVGL blend workers", LVGL_WORKER_STACK_BYTES,           MEM_PLACE_INTERNAL) \
+    X(MEM_LVGL_STYLES,     "LVGL style cache",   LVGL_STYLE_CACHE_BYTES,            MEM_PLACE_INTERNAL)
+
+typedef enum {
+#define MEMORY_PLAN_ID(id, name, size, place) id,
+    MEMORY_PLAN(MEMORY_PLAN_ID)
+#undef MEMORY_PLAN_ID
+    MEM_ID_NUM
+} mem_id_t;
+
+/**
+ * @brief Size in bytes planned for a buffer
+ */
+size_t Memory_Plan_Size(mem_id_t id);
+
+/**
+ * @brief Allocate a buffer in the memory chosen by the plan
+ *
+ * PSRAM buffers fall back to internal RAM when PSRAM is exhausted.
+ *
+ * @return Pointer to the buffer, NULL if no suitable memory is left
+ */
+void *Memory_Plan_Alloc(mem_id_t id);
+
+/**
+ * @brief Log the plan and the free / minimum free heap of each capability
+ *
+ * Call at the end of the boot sequence, the minimum free values are the
+ * high-water marks since reset.
+ */
+void Memory_Plan_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include "RGB.h"
+#include "Memory_Plan.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
@@ -39,7 +40,7 @@ void RGB_Init(void)
     /* LED strip initialization with the GPIO and pixels number*/
     led_strip_config_t strip_config = {
         .strip_gpio_num = BLINK_GPIO,
-        .max_leds = 1, // at least one LED on board
+        .max_leds = RGB_LED_NUM, // at least one LED on board
     };
     led_strip_rmt_config_t rmt_config = {
         .resolution_hz = 10 * 1000 * 1000, // 10MHz
@@ -84,13 +85,18 @@ void _RGB_Example(void *arg)
 }
 void RGB_Example(void)
 {
-    // RGB
-    xTaskCreatePinnedToCore(
+    // RGB, the stack goes to PSRAM (see Memory_Plan.h), the TCB has to stay internal
+    static StaticTask_t rgb_task_tcb;
+    StackType_t *rgb_task_stack = Memory_Plan_Alloc(MEM_RGB_STACK);
+    if (rgb_task_stack == NULL)
+        return;
+    xTaskCreateStaticPinnedToCore(
         _RGB_Example, 
         "RGB Demo",
-        4096, 
+        Memory_Plan_Size(MEM_RGB_STACK), 
         NULL, 
         4, 
-        NULL, 
+        rgb_task_stack, 
+        &rgb_task_tcb, 
         0);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "driver/gpio.h"
 #include "led_strip.h"
+#include "Board_Config.h"                                                       // RGB_LED_NUM
 
 #define BLINK_GPIO 38
 
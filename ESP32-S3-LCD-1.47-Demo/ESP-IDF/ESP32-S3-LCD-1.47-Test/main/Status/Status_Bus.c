@@ -0,0 +1,88 @@
+/**
+ * @file Status_Bus.c
+ * @brief Change-notification bus implementation
+ */
+
+#include "Status_Bus.h"
+#include <string.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "lvgl.h"
+
+static status_value_t values[STATUS_NUM];
+static uint32_t dirty_mask;
+static uint32_t published_mask;
+static portMUX_TYPE status_lock = portMUX_INITIALIZER_UNLOCKED;
+static void (*volatile notify)(void);
+
+static void publish(status_id_t id, const status_value_t *value)
+{
+    bool first_dirty = false;
+
+    portENTER_CRITICAL(&status_lock);
+    if (!(published_mask & (1U << id)) || memcmp(&values[id], value, sizeof(status_value_t)) != 0) {
+        values[id] = *value;
+        first_dirty = dirty_mask == 0;
+        dirty_mask |= 1U << id;
+        published_mask |= 1U << id;
+    }
+    portEXIT_CRITICAL(&status_lock);
+
+    // Outside the lock, it may switch to the woken task
+    void (*notify_cb)(void) = notify;
+    if (first_dirty && notify_cb)
+        notify_cb();
+}
+
+void Status_Publish_U32(status_id_t id, uint32_t value)
+{
+    status_value_t v;
+    memset(&v, 0, sizeof(v));   // Unused bytes take part in the comparison
+    v.u32 = value;
+    publish(id, &v);
+}
+
+void Status_Publish_Str(status_id_t id, const char *str)
+{
+    status_value_t v;
+    memset(&v, 0, sizeof(v));
+    strncpy(v.str, str, STATUS_STR_LEN - 1);
+    publish(id, &v);
+}
+
+void Status_Resend(void)
+{
+    portENTER_CRITICAL(&status_lock);
+    dirty_mask = published_mask;
+    portEXIT_CRITICAL(&status_lock);
+
+    void (*notify_cb)(void) = notify;
+    if (notify_cb)
+        notify_cb();
+}
+
+void Status_Set_Notify(void (*notify_cb)(void))
+{
+    notify = notify_cb;
+}
+
+void Status_Dispatch(void)
+{
+    status_value_t changed[STATUS_NUM];
+    uint32_t dirty;
+
+    portENTER_CRITICAL(&status_lock);
+    dirty = dirty_mask;
+    dirty_mask = 0;
+    for (int id = 0; id < STATUS_NUM; id++) {
+        if (dirty & (1U << id))
+            changed[id] = values[id];
+    }
+    portEXIT_CRITICAL(&status_lock);
+
+    // Subscribers run outside the lock, they may call back into the bus
+    for (int id = 0; id < STATUS_NUM; id++) {
+        if (dirty & (1U << id))
+            lv_msg_send(id, &changed[id]);
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Status_Bus.h
+ * @brief Change-notification bus between the subsystems and the status screen
+ *
+ * Subsystems publish typed values from any task. A value that differs from
+ * the last published one is marked dirty; Status_Dispatch() (LVGL task only)
+ * forwards the dirty values with lv_msg_send(), using the status_id_t as the
+ * message ID and a status_value_t as the payload. Widgets bind to a value with
+ * lv_msg_subscribe_obj() and are only touched when it changes. The notify
+ * callback lets the LVGL task sleep until there is something to dispatch.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STATUS_STR_LEN  18      // Fits "AA:BB:CC:DD:EE:FF"
+
+typedef enum {
+    STATUS_IP,          // u32: IPv4 address, 0 while not connected
+    STATUS_MAC,         // str: station MAC address
+    STATUS_WIFI_NUM,    // u32: access points found by the last scan
+    STATUS_BLE_NUM,     // u32: BLE devices found by the last scan
+    STATUS_WLED,        // u32: channels the last WLED broadcast reached
+    STATUS_WLED_TOTAL,  // u32: channels the last WLED broadcast was sent on
+    STATUS_NUM
+} status_id_t;
+
+typedef union {
+    uint32_t u32;
+    char str[STATUS_STR_LEN];
+} status_value_t;
+
+/**
+ * @brief Publish a numeric value, safe to call from any task
+ */
+void Status_Publish_U32(status_id_t id, uint32_t value);
+
+/**
+ * @brief Publish a string value (truncated to STATUS_STR_LEN - 1), safe to call from any task
+ */
+void Status_Publish_Str(status_id_t id, const char *str);
+
+/**
+ * @brief Mark every value published so far as changed
+ *
+ * Call after binding new widgets, so they receive the current values on the
+ * next Status_Dispatch().
+ */
+void Status_Resend(void);
+
+/**
+ * @brief Set the function to call when a value becomes dirty, e.g. to wake up the LVGL task
+ *
+ * It's called from the publishing task, only when nothing was waiting for
+ * Status_Dispatch() before. NULL disables it.
+ */
+void Status_Set_Notify(void (*notify_cb)(void));
+
+/**
+ * @brief Send the values changed since the last call to their subscribers
+ *
+ * Must be called from the task running lv_timer_handler().
+ */
+void Status_Dispatch(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
  */
 
 #include "WLED_Controller.h"
+#include "Status_Bus.h"
 #include "esp_log.h"
 #include "esp_now.h"
 #include "esp_wifi.h"
@@ -134,16 +135,18 @@ esp_err_t WLED_ESPNOW_SendButton(uint8_t button_code)
         .flags = 0
     };
     
-    // Broadcast on channels 1-13 (all WiFi channels)
+    // Broadcast on all WiFi channels
     // This ensures WLED devices on any channel will receive the message
     int success_count = 0;
-    for (uint8_t channel = 1; channel <= 13; channel++) {
+    for (uint8_t channel = 1; channel <= WLED_CHANNEL_NUM; channel++) {
         if (broadcast_on_channel(channel, &msg) == ESP_OK) {
             success_count++;
         }
     }
     
-    ESP_LOGI(TAG, "Button %d broadcast on %d/13 channels", button_code, success_count);
+    ESP_LOGI(TAG, "Button %d broadcast on %d/%d channels", button_code, success_count, WLED_CHANNEL_NUM);
+    Status_Publish_U32(STATUS_WLED_TOTAL, WLED_CHANNEL_NUM);
+    Status_Publish_U32(STATUS_WLED, success_count);
     
     return (success_count > 0) ? ESP_OK : ESP_FAIL;
 }
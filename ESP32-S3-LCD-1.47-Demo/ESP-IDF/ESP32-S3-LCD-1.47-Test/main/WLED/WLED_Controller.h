@@ -17,6 +17,8 @@
 extern "C" {
 #endif
 
+#define WLED_CHANNEL_NUM    13      // The button codes are broadcast on the Wi-Fi channels 1..WLED_CHANNEL_NUM
+
 /**
  * @brief Initialize WLED ESP-NOW controller
  * 
@@ -29,7 +31,7 @@ esp_err_t WLED_ESPNOW_Init(void);
 /**
  * @brief Send button code to all WLED devices
  * 
- * Broadcasts WizMote-compatible button code across all WiFi channels (1-13).
+ * Broadcasts WizMote-compatible button code across all WiFi channels (1-WLED_CHANNEL_NUM).
  * Non-blocking - returns immediately after queuing sends.
  * 
  * @param button_code WizMote button code (0=toggle, 1-3=presets, 8/9=brightness)
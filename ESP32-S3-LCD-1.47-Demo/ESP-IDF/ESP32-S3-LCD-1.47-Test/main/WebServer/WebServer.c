@@ -2,6 +2,7 @@
 #include "SD_MMC.h"
 #include "Wireless.h"
 #include "WLED_Controller.h"
+#include "Memory_Plan.h"
 #include <esp_wifi.h>
 #include <esp_netif.h>
 #include <sys/param.h>
@@ -62,6 +63,7 @@ static const char* html_page =
 "<div class='info-row'><span class='label'>WiFi Networks:</span><span class='value' id='wifi'>Loading...</span></div>"
 "<div class='info-row'><span class='label'>BLE Devices:</span><span class='value' id='ble'>Loading...</span></div>"
 "<div class='info-row'><span class='label'>Scan Status:</span><span class='value' id='scan'>Loading...</span></div>"
+"<div class='info-row'><span class='label'>LVGL Heap:</span><span class='value' id='lvgl'>Loading...</span></div>"
 "</div>"
 "<div class='section'>"
 "<h2>⚙️ WLED ESP-NOW Remote</h2>"
@@ -127,6 +129,7 @@ static const char* html_page =
 "      document.getElementById('wifi').textContent = data.wifi_count;"
 "      document.getElementById('ble').textContent = data.ble_count;"
 "      document.getElementById('scan').textContent = data.scan_complete ? '✓ Complete' : '⟳ Scanning...';"
+"      document.getElementById('lvgl').textContent = (data.lvgl_used / 1024).toFixed(1) + ' / ' + (data.lvgl_total / 1024).toFixed(1) + ' kB, ' + data.lvgl_frag + '% frag.';"
 "      document.getElementById('last-update').textContent = new Date().toLocaleTimeString();"
 "      document.getElementById('last-update').classList.remove('loading');"
 "    })"
@@ -170,6 +173,10 @@ static esp_err_t data_get_handler(httpd_req_t *req)
     
     // Get uptime in seconds
     uint32_t uptime = esp_log_timestamp() / 1000;
+
+    // The LVGL heap statistics can be read from this task without locking LVGL
+    lv_mem_stat_t lvgl_stat;
+    lv_mem_stat(&lvgl_stat);
     
     // Build JSON response
     char json_response[512];
@@ -182,7 +189,10 @@ static esp_err_t data_get_handler(httpd_req_t *req)
         "\"flash_size\":%lu,"
         "\"wifi_count\":%u,"
         "\"ble_count\":%u,"
-        "\"scan_complete\":%s"
+        "\"scan_complete\":%s,"
+        "\"lvgl_total\":%lu,"
+        "\"lvgl_used\":%lu,"
+        "\"lvgl_frag\":%u"
         "}",
         ip_str,
         hostname,
@@ -191,7 +201,10 @@ static esp_err_t data_get_handler(httpd_req_t *req)
         (unsigned long)Flash_Size,
         WIFI_NUM,
         BLE_NUM,
-        Scan_finish ? "true" : "false"
+        Scan_finish ? "true" : "false",
+        (unsigned long)lvgl_stat.total_size,
+        (unsigned long)lvgl_stat.used_size,
+        (unsigned)lvgl_stat.frag_pct
     );
     
     httpd_resp_set_type(req, "application/json");
@@ -302,7 +315,7 @@ static httpd_handle_t start_webserver(void)
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.task_priority = 3;  // Lower priority than LVGL (typically 5)
     config.core_id = 0;        // Run on core 0
-    config.stack_size = 8192;  // Increased stack size for JSON formatting
+    config.stack_size = Memory_Plan_Size(MEM_HTTPD_STACK);  // Increased stack size for JSON formatting
     config.max_uri_handlers = 8;
     config.lru_purge_enable = true;
     
@@ -1,4 +1,7 @@
 #include "Wireless.h"
+#include "Memory_Plan.h"
+#include "Status_Bus.h"
+#include "WLED_Controller.h"
 #include "wifi_config.h"  // WiFi credentials (gitignored for security)
 
 uint16_t BLE_NUM = 0;
@@ -21,7 +24,7 @@ void Wireless_Init(void)
     xTaskCreatePinnedToCore(
         WIFI_Init, 
         "WIFI task",
-        8192, 
+        Memory_Plan_Size(MEM_WIFI_STACK), 
         NULL, 
         1, 
         NULL, 
@@ -30,7 +33,7 @@ void Wireless_Init(void)
     xTaskCreatePinnedToCore(
         BLE_Init, 
         "BLE task",
-        4096, 
+        Memory_Plan_Size(MEM_BLE_STACK), 
         NULL, 
         2, 
         NULL, 
@@ -46,10 +49,12 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         printf("WiFi disconnected, reconnecting...\n");
         esp_wifi_connect();
         wifi_connected = false;
+        Status_Publish_U32(STATUS_IP, 0);
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         printf("WiFi connected! IP: " IPSTR "\n", IP2STR(&event->ip_info.ip));
         wifi_connected = true;
+        Status_Publish_U32(STATUS_IP, event->ip_info.ip.addr);
     }
 }
 
@@ -86,6 +91,10 @@ void WIFI_Init(void *arg)
     esp_wifi_set_mode(WIFI_MODE_STA);
     esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
     esp_wifi_start();
+
+    char mac_str[18];
+    if (WLED_ESPNOW_GetMAC(mac_str) == ESP_OK)
+        Status_Publish_Str(STATUS_MAC, mac_str);
     
     printf("Connecting to WiFi SSID: %s\n", WIFI_SSID);
     
@@ -105,6 +114,7 @@ void WIFI_Init(void *arg)
     // Do WiFi scan after connection attempt
     WIFI_NUM = WIFI_Scan();
     printf("WIFI networks found: %d\r\n", WIFI_NUM);
+    Status_Publish_U32(STATUS_WIFI_NUM, WIFI_NUM);
     
     // Keep task alive to maintain connection
     while(1) {
@@ -275,5 +285,6 @@ uint16_t BLE_Scan(void)
     BLE_Scan_Finish = 1;
     if(WiFi_Scan_Finish == 1)
         Scan_finish = 1;
+    Status_Publish_U32(STATUS_BLE_NUM, BLE_NUM);
     return BLE_NUM;
 }
\ No newline at end of file
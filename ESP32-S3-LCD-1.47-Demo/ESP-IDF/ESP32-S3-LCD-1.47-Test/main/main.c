@@ -11,42 +11,53 @@
 #include "LVGL_Example.h"
 #include "WebServer.h"
 #include "WLED_Controller.h"
+#include "Memory_Plan.h"
+#include "Status_Bus.h"
+#include "Flash_FS.h"
+#include "Boot_Sequence.h"
 
-void app_main(void)
+static const char *TAG = "BOOT";
+
+static void Boot_Backlight(void)
 {
-    // Initialize WiFi first (required for ESP-NOW)
-    Wireless_Init();
-    
-    // Small delay to let WiFi stabilize
-    vTaskDelay(pdMS_TO_TICKS(500));
-    
-    // Initialize ESP-NOW and trigger alarm (works without WiFi CONNECTION)
-    WLED_ESPNOW_Init();
-    WLED_ESPNOW_TriggerAlarm();  // Broadcast alarm immediately
-    
-    // Continue with normal initialization
-    WebServer_Init();      // Start web server after WiFi initialization
-    Flash_Searching();
-    RGB_Init();
-    RGB_Example();
-    SD_Init();
-    LCD_Init();
     BK_Light(50);
-    LVGL_Init();   // returns the screen object
+}
 
+static void Boot_First_Frame(void)
+{
 /********************* Demo *********************/
-    Lvgl_Example1();
-
+    // To show a demo instead, call it here and remove Lvgl_Example1 from Boot_Sequence.h
     // lv_demo_widgets();
     // lv_demo_keypad_encoder();
     // lv_demo_benchmark();
     // lv_demo_stress();
     // lv_demo_music();
 
+    lv_refr_now(disp);   // Draw the UI now instead of waiting for the radio stack
+}
+
+static void Boot_Wireless_Settle(void)
+{
+    // Small delay to let WiFi stabilize before ESP-NOW (works without WiFi CONNECTION)
+    vTaskDelay(pdMS_TO_TICKS(500));
+}
+
+void app_main(void)
+{
+    // The order is in Boot_Sequence.h: the panel and the UI first, then the radio stack
+#define BOOT_STEP_RUN(step, kind) \
+    step(); \
+    ESP_LOGI(TAG, "%s done at %lld ms", #step, esp_timer_get_time() / 1000);
+    BOOT_SEQUENCE(BOOT_STEP_RUN)
+#undef BOOT_STEP_RUN
+
+    // A published status value wakes up the loop below, it doesn't poll
+    Status_Set_Notify(LVGL_Wake);
+
     while (1) {
-        // raise the task priority of LVGL and/or reduce the handler period can improve the performance
-        vTaskDelay(pdMS_TO_TICKS(10));
-        // The task running lv_timer_handler should have lower priority than that running `lv_tick_inc`
-        lv_timer_handler();
+        // Forward the changed status values, then sleep until the next LVGL timer is due or a value changes
+        Status_Dispatch();
+        uint32_t wait_ms = lv_timer_handler();
+        LVGL_Wait(wait_ms);
     }
 }